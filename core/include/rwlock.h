@@ -0,0 +1,135 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    core_sync_rwlock Reader-Writer Lock
+ * @ingroup     core_sync
+ * @brief       Lock allowing many readers or a single writer
+ *
+ * A reader-writer lock protects data that is read much more often than it is
+ * modified. Any number of threads may hold the lock for reading at the same
+ * time, a writer gets exclusive access.
+ *
+ * Readers are preferred: a read lock is granted whenever no writer holds the
+ * lock, even if writers are waiting. Acquiring and releasing a read lock is
+ * therefore a counter update in a short critical section and never walks a
+ * list of waiters. A thread may also acquire a read lock it already holds
+ * again. The downside is that a constant stream of readers can starve
+ * writers.
+ *
+ * Waiting threads are queued by priority, like with @ref core_sync_mutex.
+ * Releasing a lock hands it over directly: when the last reader leaves, the
+ * waiting writer with the highest priority gets the lock. When a writer
+ * leaves, either all waiting readers or the waiting writer with the highest
+ * priority get the lock, whichever has the highest priority.
+ *
+ * @note    There is no priority inheritance. A high priority writer may be
+ *          blocked by low priority readers for as long as they hold the lock.
+ *
+ * @warning A thread holding a read lock must not acquire the write lock of
+ *          the same lock, as this will block forever.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Reader-writer lock interface
+ */
+
+#include <stdbool.h>
+
+#include "list.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Reader-writer lock structure
+ */
+typedef struct {
+    list_node_t readers_waiting;    /**< waiting readers, sorted by priority */
+    list_node_t writers_waiting;    /**< waiting writers, sorted by priority */
+    unsigned readers;               /**< number of read locks held */
+    kernel_pid_t writer;            /**< holder of the write lock, or
+                                         KERNEL_PID_UNDEF */
+} rwlock_t;
+
+/**
+ * @brief   Static initializer for rwlock_t
+ */
+#define RWLOCK_INIT { .readers_waiting = { NULL }, \
+                      .writers_waiting = { NULL }, \
+                      .readers = 0, .writer = KERNEL_PID_UNDEF }
+
+/**
+ * @brief   Initialize a reader-writer lock
+ *
+ * @param[out]  rwlock  lock to initialize
+ */
+static inline void rwlock_init(rwlock_t *rwlock)
+{
+    *rwlock = (rwlock_t)RWLOCK_INIT;
+}
+
+/**
+ * @brief   Acquire a read lock, blocking while a writer holds the lock
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ */
+void rwlock_read_lock(rwlock_t *rwlock);
+
+/**
+ * @brief   Try to acquire a read lock
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ *
+ * @return  true, if the read lock was acquired
+ * @return  false, if a writer holds the lock
+ */
+bool rwlock_try_read_lock(rwlock_t *rwlock);
+
+/**
+ * @brief   Release a read lock
+ *
+ * @pre     The calling thread holds a read lock on @p rwlock
+ *
+ * @param[in,out]   rwlock  lock to release
+ */
+void rwlock_read_unlock(rwlock_t *rwlock);
+
+/**
+ * @brief   Acquire the write lock, blocking while the lock is held
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ */
+void rwlock_write_lock(rwlock_t *rwlock);
+
+/**
+ * @brief   Try to acquire the write lock
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ *
+ * @return  true, if the write lock was acquired
+ * @return  false, if the lock is held
+ */
+bool rwlock_try_write_lock(rwlock_t *rwlock);
+
+/**
+ * @brief   Release the write lock
+ *
+ * @pre     The calling thread holds the write lock on @p rwlock
+ *
+ * @param[in,out]   rwlock  lock to release
+ */
+void rwlock_write_unlock(rwlock_t *rwlock);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
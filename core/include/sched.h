@@ -344,6 +344,26 @@ static inline void sched_runq_advance(uint8_t prio)
 extern void sched_runq_callback(uint8_t prio);
 #endif
 
+#if (IS_USED(MODULE_SCHED_STATUS_CALLBACK)) || defined(DOXYGEN)
+/**
+ * @brief   Scheduler status (change) callback
+ *
+ * @details Function has to be provided by the user of this API.
+ *          It will be called by @ref sched_set_status() after the status of
+ *          @p thread was changed, with interrupts disabled.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   thread      the thread whose status changed
+ * @param   old_status  status of @p thread before the change
+ * @param   new_status  status of @p thread after the change
+ */
+extern void sched_status_callback(thread_t *thread, thread_status_t old_status,
+                                  thread_status_t new_status);
+#endif
+
 /**
  * @brief   Tell if the number of threads in a runqueue is 0
  *
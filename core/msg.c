@@ -35,6 +35,7 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#include "trace_events.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -107,6 +108,8 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
 
     thread_t *me = thread_get_active();
 
+    TRACE_EVENT(TRACE_EVENT_MSG_SEND, target_pid, m->type);
+
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
           ". block=%i src->state=%i target->state=%i\n", __FILE__,
           __LINE__, thread_getpid(), target_pid,
@@ -209,6 +212,8 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+    TRACE_EVENT(TRACE_EVENT_MSG_SEND, target_pid, m->type);
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -345,12 +350,20 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+    if (res > 0) {
+        TRACE_EVENT(TRACE_EVENT_MSG_RECV, m->sender_pid, m->type);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+    TRACE_EVENT(TRACE_EVENT_MSG_RECV, m->sender_pid, m->type);
+    return res;
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -30,6 +30,7 @@
 #include "sched.h"
 #include "irq.h"
 #include "list.h"
+#include "trace_events.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -65,6 +66,12 @@ void _block(mutex_t *mutex,
     /* Fail visibly even if a blocking action is called from somewhere where
      * it's subtly not allowed, eg. board_init */
     assert(me != NULL);
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) \
+    || defined(MODULE_CORE_MUTEX_DEBUG)
+    TRACE_EVENT(TRACE_EVENT_MUTEX_CONTENDED, mutex->owner, mutex);
+#else
+    TRACE_EVENT(TRACE_EVENT_MUTEX_CONTENDED, KERNEL_PID_UNDEF, mutex);
+#endif
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock() Adding node to mutex queue: "
           "prio: %" PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
     sched_set_status(me, STATUS_MUTEX_BLOCKED);
@@ -0,0 +1,162 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     core_sync_rwlock
+ * @{
+ *
+ * @file
+ * @brief       Reader-writer lock implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <inttypes.h>
+
+#include "irq.h"
+#include "list.h"
+#include "rwlock.h"
+#include "sched.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static inline thread_t *_thread(list_node_t *node)
+{
+    return container_of((clist_node_t *)node, thread_t, rq_entry);
+}
+
+/**
+ * @pre     IRQs are disabled
+ * @post    IRQs are restored to @p irq_state and the calling thread holds
+ *          the lock
+ */
+static void _block(list_node_t *queue, unsigned irq_state)
+{
+    thread_t *me = thread_get_active();
+
+    /* Fail visibly even if a blocking action is called from somewhere where
+     * it's subtly not allowed, eg. board_init */
+    assert(me != NULL);
+    DEBUG("PID[%" PRIkernel_pid "] rwlock: waiting\n", me->pid);
+
+    sched_set_status(me, STATUS_MUTEX_BLOCKED);
+    thread_add_to_list(queue, me);
+    irq_restore(irq_state);
+    thread_yield_higher();
+    /* The waker removed us from the queue and handed the lock over to us */
+}
+
+/**
+ * @brief   Hand the lock over to waiting threads after it was released
+ *
+ * Readers only wait while a writer holds the lock. So once the lock is free,
+ * either the waiting writer with the highest priority or all waiting readers
+ * get it, whichever has the highest priority.
+ *
+ * @pre     IRQs are disabled and the lock is free
+ * @return  priority of the woken thread with the highest priority, or
+ *          THREAD_PRIORITY_MIN + 1 if no thread was woken
+ */
+static uint16_t _wake(rwlock_t *rwlock)
+{
+    list_node_t *writer = rwlock->writers_waiting.next;
+    list_node_t *reader = rwlock->readers_waiting.next;
+
+    if (writer && (!reader ||
+                   (_thread(writer)->priority <= _thread(reader)->priority))) {
+        thread_t *thread = _thread(list_remove_head(&rwlock->writers_waiting));
+        rwlock->writer = thread->pid;
+        sched_set_status(thread, STATUS_PENDING);
+        return thread->priority;
+    }
+    if (!reader) {
+        return THREAD_PRIORITY_MIN + 1;
+    }
+
+    uint16_t prio = _thread(reader)->priority;
+    while ((reader = list_remove_head(&rwlock->readers_waiting))) {
+        rwlock->readers++;
+        sched_set_status(_thread(reader), STATUS_PENDING);
+    }
+    return prio;
+}
+
+static void _unlock(rwlock_t *rwlock, unsigned irq_state)
+{
+    uint16_t prio = _wake(rwlock);
+
+    irq_restore(irq_state);
+    if (prio <= THREAD_PRIORITY_MIN) {
+        sched_switch(prio);
+    }
+}
+
+bool rwlock_try_read_lock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+    bool locked = (rwlock->writer == KERNEL_PID_UNDEF);
+    if (locked) {
+        rwlock->readers++;
+    }
+    irq_restore(irq_state);
+    return locked;
+}
+
+void rwlock_read_lock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+    if (rwlock->writer == KERNEL_PID_UNDEF) {
+        rwlock->readers++;
+        irq_restore(irq_state);
+        return;
+    }
+    _block(&rwlock->readers_waiting, irq_state);
+}
+
+void rwlock_read_unlock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+    assert(rwlock->readers > 0);
+    if (--rwlock->readers > 0) {
+        irq_restore(irq_state);
+        return;
+    }
+    _unlock(rwlock, irq_state);
+}
+
+bool rwlock_try_write_lock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+    bool locked = (rwlock->writer == KERNEL_PID_UNDEF) &&
+                  (rwlock->readers == 0);
+    if (locked) {
+        rwlock->writer = thread_getpid();
+    }
+    irq_restore(irq_state);
+    return locked;
+}
+
+void rwlock_write_lock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+    if ((rwlock->writer == KERNEL_PID_UNDEF) && (rwlock->readers == 0)) {
+        rwlock->writer = thread_getpid();
+        irq_restore(irq_state);
+        return;
+    }
+    assert(rwlock->writer != thread_getpid());
+    _block(&rwlock->writers_waiting, irq_state);
+}
+
+void rwlock_write_unlock(rwlock_t *rwlock)
+{
+    unsigned irq_state = irq_disable();
+    assert(rwlock->writer == thread_getpid());
+    rwlock->writer = KERNEL_PID_UNDEF;
+    _unlock(rwlock, irq_state);
+}
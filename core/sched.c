@@ -31,6 +31,7 @@
 #include "sched.h"
 #include "thread.h"
 #include "panic.h"
+#include "trace_events.h"
 
 #ifdef MODULE_MPU_STACK_GUARD
 #include "mpu.h"
@@ -201,6 +202,9 @@ thread_t *__attribute__((used)) sched_run(void)
         sched_active_pid = next_thread->pid;
         sched_active_thread = next_thread;
 
+        TRACE_EVENT(TRACE_EVENT_SCHED_SWITCH, next_thread->pid,
+                    previous_thread ? previous_thread->pid : KERNEL_PID_UNDEF);
+
 #ifdef MODULE_SCHED_CB
         if (sched_cb) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
@@ -264,6 +268,10 @@ static inline __attribute__((always_inline)) void _runqueue_pop(thread_t *thread
 
 void sched_set_status(thread_t *process, thread_status_t status)
 {
+#if (IS_USED(MODULE_SCHED_STATUS_CALLBACK))
+    thread_status_t old_status = process->status;
+#endif
+
     if (status >= STATUS_ON_RUNQUEUE) {
         if (!(process->status >= STATUS_ON_RUNQUEUE)) {
             _runqueue_push(process, process->priority);
@@ -276,6 +284,10 @@ void sched_set_status(thread_t *process, thread_status_t status)
     }
 
     process->status = status;
+
+#if (IS_USED(MODULE_SCHED_STATUS_CALLBACK))
+    sched_status_callback(process, old_status, status);
+#endif
 }
 
 void sched_switch(uint16_t other_prio)
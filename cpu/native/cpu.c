@@ -14,7 +14,9 @@
  * (ucontext provides for architecture independent stack handling)
  */
 
+#include <assert.h>
 #include <err.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <unistd.h>
 #include <stdlib.h>
@@ -42,6 +44,18 @@ extern netdev_tap_t netdev_tap;
 
 static ucontext_t _end_context;
 
+#if defined(MODULE_NATIVE_IRQ_VIRTUAL) && !USE_LIBUCONTEXT
+/* _native_ctx_swap and _native_ctx_set in native.S hardcode these offsets */
+static_assert(offsetof(ucontext_t, uc_mcontext.gregs[REG_R8]) == 40,
+              "unexpected ucontext_t layout");
+static_assert(offsetof(ucontext_t, uc_mcontext.gregs[REG_RIP]) == 168,
+              "unexpected ucontext_t layout");
+static_assert(offsetof(ucontext_t, uc_mcontext.fpregs) == 224,
+              "unexpected ucontext_t layout");
+static_assert(offsetof(ucontext_t, __fpregs_mem.mxcsr) == 448,
+              "unexpected ucontext_t layout");
+#endif
+
 /**
  * TODO: implement
  */
@@ -70,7 +84,9 @@ void _isr_switch_to_user(void) {
     DEBUG_CPU("... ISR: switching to user thread, calling setcontext(PID %" PRIkernel_pid ")\n\n", thread_getpid());
 
     ucontext_t *context = _native_user_context();
-    _native_interrupts_enabled = true;
+    /* with native_irq_virtual, _native_isr_leave enables interrupts once it
+     * left the ISR context, so signals arriving in between are not missed */
+    _native_interrupts_enabled = !IS_USED(MODULE_NATIVE_IRQ_VIRTUAL);
 
     /* Get PC/LR. This is where we will resume execution on the userspace thread. */
     _native_user_fptr = (uintptr_t)_context_get_fptr(context);
@@ -78,7 +94,7 @@ void _isr_switch_to_user(void) {
     /* Now we want to go to _native_isr_leave before resuming execution at _native_user_fptr. */
     _context_set_fptr(context, (uintptr_t)_native_isr_leave);
 
-    if (setcontext(context) == -1) {
+    if (_native_setcontext(context) == -1) {
         err(EXIT_FAILURE, "_isr_schedule_and_switch: setcontext");
     }
     errx(EXIT_FAILURE, "2 this should have never been reached!!");
@@ -123,7 +139,7 @@ void cpu_switch_context_exit(void)
         _native_in_isr = 1;
 
         _native_isr_context_make(_isr_context_switch_exit);
-        if (setcontext(_native_isr_context) == -1) {
+        if (_native_setcontext(_native_isr_context) == -1) {
             err(EXIT_FAILURE, "cpu_switch_context_exit: setcontext");
         }
         errx(EXIT_FAILURE, "1 this should have never been reached!!");
@@ -175,7 +191,7 @@ void thread_yield_higher(void)
 
         /* Create the ISR context, will execute isr_thread_yield */
         _native_isr_context_make(_isr_thread_yield);
-        if (swapcontext(_native_user_context(), _native_isr_context) == -1) {
+        if (_native_swapcontext(_native_user_context(), _native_isr_context) == -1) {
             err(EXIT_FAILURE, "thread_yield_higher: swapcontext");
         }
         irq_enable();
@@ -124,6 +124,26 @@ int native_register_interrupt(int sig, _native_callback_t handler);
  */
 int native_unregister_interrupt(int sig);
 
+/**
+ * @brief Records a signal to be handled in ISR context
+ * @private
+ *
+ * Writes @p sig into the signal pipe and increments @ref _native_pending_signals.
+ * Safe to call from signal handlers.
+ *
+ * @param sig Signal number
+ */
+void _native_signal_post(int sig);
+
+/**
+ * @brief Switches to ISR context to handle pending signals, if interrupts allow it
+ * @pre Intended to be called from **userspace**
+ * @private
+ *
+ * Returns once the calling thread is scheduled again.
+ */
+void _native_handle_pending_signals(void);
+
 /**
  * @brief Calls signal handlers for pending signal, then exits ISR context and performs context switch
  * @pre Intended to be called from **ISR context**
@@ -143,6 +163,34 @@ void _native_call_sig_handlers_and_switch(void);
 extern void _native_sig_leave_tramp(void);
 /** @} */
 
+/* MARK: - Virtual Time */
+/**
+ * @name Virtual Time
+ *
+ * With the `native_virtual_time` module, the peripheral timer and the RTC
+ * are driven by a simulated clock instead of the host clock. The clock only
+ * advances when the idle thread runs, which makes it jump straight to the
+ * next timer deadline.
+ * @{
+ */
+
+/**
+ * @brief Returns the simulated time since boot in microseconds
+ */
+uint64_t _native_virtual_time_now(void);
+
+/**
+ * @brief Advances the simulated clock to the next timer deadline
+ * @pre Called from the idle thread with @ref _native_pending_syscalls raised
+ * @private
+ *
+ * Posts the timer interrupt if a deadline was pending.
+ *
+ * @returns true if the clock advanced, false if no timer is armed
+ */
+bool _native_virtual_time_advance(void);
+/** @} */
+
 /* MARK: - System Calls */
 /**
  * @name System Calls
@@ -14,6 +14,13 @@
  * @file
  * @brief  Definitions for @ref netdev ethernet driver for host system's
  *         TAP interfaces
+ *
+ * On Linux, the pseudomodule `netdev_tap_csum_offload` opens the TAP interface
+ * with a virtio-net header (`IFF_VNET_HDR`). The host kernel then calculates
+ * the UDP, TCP and ICMPv6 checksums of outgoing packets and reports the
+ * checksums of incoming packets it already verified, see
+ * @ref NETOPT_CSUM_OFFLOAD.
+ *
  * @author Kaspar Schleiser <kaspar@schleiser.de>
  */
 
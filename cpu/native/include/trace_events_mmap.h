@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup     cpu_native
+ * @{
+ *
+ * @file
+ * @brief       Memory mapped file backend for the binary event tracer
+ *
+ * With the `trace_events_mmap` module, the ring of @ref sys_trace_events is
+ * stored in a file that is mapped into the process. The file name can be
+ * set with the `--trace-file` command line option. Use
+ * `dist/tools/trace_events/trace_events.py` to convert it.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Default file name of the trace
+ */
+#ifndef CONFIG_TRACE_EVENTS_MMAP_FILE
+#define CONFIG_TRACE_EVENTS_MMAP_FILE   "riot.trace"
+#endif
+
+/**
+ * @brief   File name of the trace, set from the command line
+ */
+extern const char *trace_events_mmap_file;
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -123,6 +123,64 @@ static inline void makecontext64(ucontext_t *context, void (*func)(void), void*
 }
 /** @} */
 
+/* MARK: - Context switching */
+/**
+ * @name Context switching
+ *
+ * With `native_irq_virtual`, interrupts are masked in user space and the
+ * signal mask of the process never changes, so there is no need to save and
+ * restore it on every context switch. The C library implementation always
+ * does, which costs one system call per switch. On x86_64 with glibc, native
+ * provides its own implementation (see `native.S`) working on the same
+ * `ucontext_t` layout, libucontext never touches the signal mask.
+ * @{
+ */
+#if defined(MODULE_NATIVE_IRQ_VIRTUAL) && !defined(__x86_64__)
+# error "native_irq_virtual is only supported on x86_64"
+#endif
+#if defined(MODULE_NATIVE_IRQ_VIRTUAL) && !USE_LIBUCONTEXT
+# if !(defined(__linux__) && defined(__GLIBC__))
+#  error "native_irq_virtual requires glibc or libucontext"
+# endif
+/**
+ * @brief Native implementation of `swapcontext`, does not touch the signal mask
+ */
+extern int _native_ctx_swap(ucontext_t *oucp, const ucontext_t *ucp);
+
+/**
+ * @brief Native implementation of `setcontext`, does not touch the signal mask
+ */
+extern int _native_ctx_set(const ucontext_t *ucp);
+#endif
+
+/**
+ * @brief Saves the current context in @p oucp and activates @p ucp
+ * @param oucp Storage for the current context
+ * @param ucp Context to activate
+ * @returns -1 on error, 0 when @p oucp is activated again
+ */
+static inline int _native_swapcontext(ucontext_t *oucp, const ucontext_t *ucp) {
+#if defined(MODULE_NATIVE_IRQ_VIRTUAL) && !USE_LIBUCONTEXT
+    return _native_ctx_swap(oucp, ucp);
+#else
+    return swapcontext(oucp, ucp);
+#endif
+}
+
+/**
+ * @brief Activates @p ucp
+ * @param ucp Context to activate
+ * @returns -1 on error, does not return otherwise
+ */
+static inline int _native_setcontext(const ucontext_t *ucp) {
+#if defined(MODULE_NATIVE_IRQ_VIRTUAL) && !USE_LIBUCONTEXT
+    return _native_ctx_set(ucp);
+#else
+    return setcontext(ucp);
+#endif
+}
+/** @} */
+
 /** @} */
 
 #ifdef __cplusplus
@@ -21,6 +21,8 @@
 #include "irq.h"
 #include "cpu.h"
 #include "periph/pm.h"
+#include "sched_accounting.h"
+#include "trace_events.h"
 
 #include "native_internal.h"
 #include "test_utils/expect.h"
@@ -145,6 +147,13 @@ unsigned irq_disable(void)
 {
     unsigned int prev_state;
 
+    if (IS_USED(MODULE_NATIVE_IRQ_VIRTUAL)) {
+        /* signal handlers only record signals while this is false */
+        prev_state = _native_interrupts_enabled;
+        _native_interrupts_enabled = false;
+        return prev_state;
+    }
+
     _native_syscall_enter();
     DEBUG_IRQ("irq_disable(): _native_in_isr == %i\n", _native_in_isr);
 
@@ -180,6 +189,21 @@ unsigned irq_enable(void)
 #     endif
     }
 
+    if (IS_USED(MODULE_NATIVE_IRQ_VIRTUAL)) {
+        prev_state = _native_interrupts_enabled;
+        _native_interrupts_enabled = true;
+
+        /* replay the signals that arrived while interrupts were disabled */
+        if (_native_pending_signals > 0) {
+            _native_handle_pending_signals();
+        }
+        if (_native_in_isr == 0 && sched_context_switch_request) {
+            thread_yield_higher();
+        }
+
+        return prev_state;
+    }
+
     _native_syscall_enter();
     DEBUG_IRQ("irq_enable()\n");
 
@@ -257,11 +281,19 @@ void _native_call_sig_handlers_and_switch(void)
 
     while (_native_pending_signals > 0) {
         int sig = _native_pop_sig();
-        _native_pending_signals--;
+        __atomic_fetch_sub(&_native_pending_signals, 1, __ATOMIC_SEQ_CST);
 
         if (_native_irq_handlers[sig]) {
             DEBUG_IRQ("call sig handlers + switch: calling interrupt handler for %i\n", sig);
+            TRACE_EVENT(TRACE_EVENT_ISR_ENTER, sig, 0);
+            if (IS_USED(MODULE_SCHED_ACCOUNTING)) {
+                sched_accounting_isr_enter();
+            }
             _native_irq_handlers[sig]();
+            if (IS_USED(MODULE_SCHED_ACCOUNTING)) {
+                sched_accounting_isr_exit();
+            }
+            TRACE_EVENT(TRACE_EVENT_ISR_EXIT, sig, 0);
         }
         else if (sig == SIGUSR1) {
             warnx("call sig handlers + switch: ignoring SIGUSR1");
@@ -277,15 +309,42 @@ void _native_call_sig_handlers_and_switch(void)
     cpu_switch_context_exit();
 }
 
+void _native_signal_post(int sig)
+{
+    if (real_write(_signal_pipe_fd[1], &sig, sizeof(int)) == -1) {
+        err(EXIT_FAILURE, "_native_signal_post: real_write()");
+    }
+    /* with native_irq_virtual, a signal handler may interrupt the ISR
+     * context while it decrements the counter */
+    __atomic_fetch_add(&_native_pending_signals, 1, __ATOMIC_SEQ_CST);
+}
+
+void _native_handle_pending_signals(void)
+{
+    if (
+            (_native_pending_signals > 0)
+            && (_native_in_isr == 0)
+            && (_native_pending_syscalls == 0)
+            && (_native_interrupts_enabled)
+            && (thread_get_active() != NULL)
+       )
+    {
+        _native_in_isr = 1;
+        _native_interrupts_enabled = false;
+
+        _native_isr_context_make(_native_call_sig_handlers_and_switch);
+        if (_native_swapcontext(_native_user_context(), _native_isr_context) == -1) {
+            err(EXIT_FAILURE, "_native_handle_pending_signals: swapcontext");
+        }
+    }
+}
+
 void native_signal_action(int sig, siginfo_t *info, void *context)
 {
     (void) info; /* unused at the moment */
 
     /* save the signal */
-    if (real_write(_signal_pipe_fd[1], &sig, sizeof(int)) == -1) {
-        err(EXIT_FAILURE, "native_signal_action: real_write()");
-    }
-    _native_pending_signals++;
+    _native_signal_post(sig);
 
     if (context == NULL) {
         errx(EXIT_FAILURE, "native_signal_action: context is null - unhandled");
@@ -319,7 +378,13 @@ void native_signal_action(int sig, siginfo_t *info, void *context)
 
     DEBUG_IRQ("\n\n\t\tnative_signal_action: return to _native_sig_leave_tramp\n\n");
     /* disable interrupts in context */
-    _set_sigmask((ucontext_t *)context);
+    if (IS_USED(MODULE_NATIVE_IRQ_VIRTUAL)) {
+        /* the signal mask stays as it is, all signals are still caught */
+        _native_interrupts_enabled = false;
+    }
+    else {
+        _set_sigmask((ucontext_t *)context);
+    }
     _native_in_isr = 1;
 
     /* Get PC/LR. This is where we will resume execution on the userspace thread. */
@@ -369,6 +434,11 @@ static void _set_signal_handler(int sig, bool add)
     if (sigaction(sig, &sa, NULL)) {
         err(EXIT_FAILURE, "set_signal_handler: sigaction");
     }
+    /* irq_enable() does not apply the signal mask in this mode */
+    if (IS_USED(MODULE_NATIVE_IRQ_VIRTUAL) &&
+        sigprocmask(SIG_SETMASK, &_native_sig_set, NULL) == -1) {
+        err(EXIT_FAILURE, "set_signal_handler: sigprocmask");
+    }
     _native_syscall_leave();
 }
 
@@ -492,5 +562,12 @@ void native_interrupt_init(void)
         err(EXIT_FAILURE, "native_interrupt_init: sigaction");
     }
 
+    /* with virtual interrupt masking, the signal mask of the process only
+     * changes when handlers are (un)registered */
+    if (IS_USED(MODULE_NATIVE_IRQ_VIRTUAL) &&
+        sigprocmask(SIG_SETMASK, &_native_sig_set, NULL) == -1) {
+        err(EXIT_FAILURE, "native_interrupt_init: sigprocmask");
+    }
+
     puts("RIOT native interrupts/signals initialized.");
 }
@@ -26,9 +26,11 @@
 #include <sys/uio.h>
 #include <unistd.h>
 #include <signal.h>
+#include <stddef.h>
 
 /* needs to be included before native's declarations of ntohl etc. */
 #include "byteorder.h"
+#include "modules.h"
 
 #if defined(__FreeBSD__)
 #  include <sys/socket.h>
@@ -41,6 +43,13 @@
 #  include <linux/if_ether.h>
 #endif
 
+#if IS_USED(MODULE_NETDEV_TAP_CSUM_OFFLOAD) && !defined(__FreeBSD__)
+#  include <linux/virtio_net.h>
+#  define VNET_HDR  1   /**< frames are preceded by a struct virtio_net_hdr */
+#else
+#  define VNET_HDR  0
+#endif
+
 #include "native_internal.h"
 
 #include "async_read.h"
@@ -51,6 +60,12 @@
 #include "net/netdev/eth.h"
 #include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
+#include "net/ethertype.h"
+#include "net/icmpv6.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/tcp.h"
+#include "net/udp.h"
 #include "netdev_tap.h"
 #include "net/netopt.h"
 
@@ -133,6 +148,14 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
                 res = sizeof(bool);
             }
             break;
+#if VNET_HDR
+        case NETOPT_CSUM_OFFLOAD:
+            assert(max_len >= sizeof(netopt_csum_offload_t));
+            *((netopt_csum_offload_t *)value) = NETOPT_CSUM_OFFLOAD_RX |
+                                                NETOPT_CSUM_OFFLOAD_TX;
+            res = sizeof(netopt_csum_offload_t);
+            break;
+#endif
         default:
             res = netdev_eth_get(dev, opt, value, max_len);
             break;
@@ -210,11 +233,7 @@ static void _continue_reading(netdev_tap_t *dev)
     _native_pending_syscalls_up(); /* no switching here */
 
     if (real_select(dev->tap_fd + 1, &rfds, NULL, NULL, &t) == 1) {
-        int sig = SIGIO;
-        extern int _signal_pipe_fd[2];
-        extern ssize_t (*real_write)(int fd, const void * buf, size_t count);
-        real_write(_signal_pipe_fd[1], &sig, sizeof(int));
-        _native_pending_signals++;
+        _native_signal_post(SIGIO);
         DEBUG("netdev_tap: sigpend++\n");
     }
     else {
@@ -255,7 +274,26 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
         return ETHERNET_FRAME_LEN;
     }
 
+#if VNET_HDR
+    struct virtio_net_hdr vnet;
+    struct iovec iov[] = {
+        { .iov_base = &vnet, .iov_len = sizeof(vnet) },
+        { .iov_base = buf, .iov_len = len },
+    };
+    int nread = real_readv(dev->tap_fd, iov, ARRAY_SIZE(iov));
+
+    if (nread > 0) {
+        /* the host does not pass partial checksums (TUN_F_CSUM is not set),
+         * but it passes on the checksums it or its hardware verified */
+        nread = (nread > (int)sizeof(vnet)) ? nread - (int)sizeof(vnet) : 0;
+        if ((info != NULL) && (vnet.flags & VIRTIO_NET_HDR_F_DATA_VALID)) {
+            ((netdev_eth_rx_info_t *)info)->flags |=
+                NETDEV_ETH_RX_INFO_FLAG_CSUM_VALID;
+        }
+    }
+#else
     int nread = real_read(dev->tap_fd, buf, len);
+#endif
     DEBUG("netdev_tap: read %d bytes\n", nread);
 
     if (nread > 0) {
@@ -294,16 +332,104 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     return -1;
 }
 
+#if VNET_HDR
+/* copies (or with @p write, overwrites) @p len bytes at @p offset of a frame */
+static size_t _iolist_access(const iolist_t *iolist, size_t offset, void *data,
+                             size_t len, bool write)
+{
+    size_t done = 0;
+
+    for (; (iolist != NULL) && (done < len); iolist = iolist->iol_next) {
+        if (offset >= iolist->iol_len) {
+            offset -= iolist->iol_len;
+            continue;
+        }
+        size_t n = iolist->iol_len - offset;
+
+        n = (n < (len - done)) ? n : (len - done);
+        if (write) {
+            memcpy((uint8_t *)iolist->iol_base + offset, (uint8_t *)data + done, n);
+        }
+        else {
+            memcpy((uint8_t *)data + done, (uint8_t *)iolist->iol_base + offset, n);
+        }
+        done += n;
+        offset = 0;
+    }
+    return done;
+}
+
+/* lets the host calculate the UDP, TCP or ICMPv6 checksum of an IPv6 packet
+ * that carries the upper layer header directly after the IPv6 header */
+static void _vnet_hdr_build(const iolist_t *iolist, struct virtio_net_hdr *vnet)
+{
+    struct __attribute__((packed)) {
+        ethernet_hdr_t eth;
+        ipv6_hdr_t ipv6;
+    } hdr;
+    network_uint16_t csum;
+    uint16_t csum_offset, len;
+
+    memset(vnet, 0, sizeof(*vnet));
+    if ((_iolist_access(iolist, 0, &hdr, sizeof(hdr), false) < sizeof(hdr)) ||
+        (byteorder_ntohs(hdr.eth.type) != ETHERTYPE_IPV6) ||
+        !ipv6_hdr_is(&hdr.ipv6)) {
+        return;
+    }
+    switch (hdr.ipv6.nh) {
+        case PROTNUM_UDP:
+            csum_offset = offsetof(udp_hdr_t, checksum);
+            break;
+        case PROTNUM_TCP:
+            csum_offset = offsetof(tcp_hdr_t, checksum);
+            break;
+        case PROTNUM_ICMPV6:
+            csum_offset = offsetof(icmpv6_hdr_t, csum);
+            break;
+        default:
+            return;
+    }
+    len = byteorder_ntohs(hdr.ipv6.len);
+    if ((len < (csum_offset + sizeof(csum))) ||
+        (iolist_size(iolist) < (sizeof(hdr) + len))) {
+        return;
+    }
+    /* the host adds up the rest of the packet, starting with the checksum
+     * field holding the sum of the pseudo-header */
+    csum = byteorder_htons(ipv6_hdr_inet_csum(0, &hdr.ipv6, hdr.ipv6.nh, len));
+    _iolist_access(iolist, sizeof(hdr) + csum_offset, &csum, sizeof(csum), true);
+    vnet->flags = VIRTIO_NET_HDR_F_NEEDS_CSUM;
+    vnet->gso_type = VIRTIO_NET_HDR_GSO_NONE;
+    vnet->csum_start = sizeof(hdr);
+    vnet->csum_offset = csum_offset;
+}
+#endif
+
 static int _send(netdev_t *netdev, const iolist_t *iolist)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
 
+#if VNET_HDR
+    struct virtio_net_hdr vnet;
+    struct iovec iov[iolist_count(iolist) + 1];
+    unsigned n;
+    int res;
+
+    _vnet_hdr_build(iolist, &vnet);
+    iov[0].iov_base = &vnet;
+    iov[0].iov_len = sizeof(vnet);
+    iolist_to_iovec(iolist, &iov[1], &n);
+
+    res = _native_writev(dev->tap_fd, iov, n + 1);
+    return (res > (int)sizeof(vnet)) ? res - (int)sizeof(vnet) : res;
+#else
     struct iovec iov[iolist_count(iolist)];
 
     unsigned n;
     iolist_to_iovec(iolist, iov, &n);
 
     return _native_writev(dev->tap_fd, iov, n);
+#endif
 }
 
 void netdev_tap_setup(netdev_tap_t *dev, const netdev_tap_params_t *params, int index) {
@@ -368,6 +494,9 @@ static int _init(netdev_t *netdev)
 # else /* Linux */
     memset(&ifr, 0, sizeof(ifr));
     ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+    if (VNET_HDR) {
+        ifr.ifr_flags |= IFF_VNET_HDR;
+    }
     strncpy(ifr.ifr_name, name, IFNAMSIZ);
     if (real_ioctl(dev->tap_fd, TUNSETIFF, (void *)&ifr) == -1) {
         _native_pending_syscalls_up();
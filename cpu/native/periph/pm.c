@@ -12,6 +12,7 @@
  */
 
 #include <err.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -35,7 +36,25 @@ unsigned _native_retval = EXIT_SUCCESS;
 static void _native_sleep(void)
 {
     _native_pending_syscalls_up(); /* no switching here */
-    real_pause();
+    if (IS_USED(MODULE_NATIVE_VIRTUAL_TIME) && (_native_pending_signals == 0) &&
+        _native_virtual_time_advance()) {
+        /* nothing to wait for, the clock jumped to the next timer deadline */
+    }
+    else if (IS_USED(MODULE_NATIVE_IRQ_VIRTUAL)) {
+        /* Signals are not blocked while interrupts are disabled, so one may
+         * have been recorded already. Block them while checking, so none
+         * arrives between the check and the sleep. */
+        sigset_t all, prev;
+        sigfillset(&all);
+        sigprocmask(SIG_BLOCK, &all, &prev);
+        if (_native_pending_signals == 0) {
+            sigsuspend(&prev);
+        }
+        sigprocmask(SIG_SETMASK, &prev, NULL);
+    }
+    else {
+        real_pause();
+    }
     _native_pending_syscalls_down();
 
     if (_native_pending_signals > 0) {
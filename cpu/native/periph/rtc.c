@@ -50,6 +50,18 @@ static time_t _native_rtc_offset;
 
 static ztimer_t _native_rtc_timer;
 
+static void _native_rtc_clock(struct timespec *tv)
+{
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    /* the simulated clock starts at the epoch, until set */
+    uint64_t now = _native_virtual_time_now();
+    tv->tv_sec = now / US_PER_SEC;
+    tv->tv_nsec = (now % US_PER_SEC) * NS_PER_US;
+#else
+    clock_gettime(NATIVE_RTC_SOURCE, tv);
+#endif
+}
+
 static void _native_rtc_cb(void *arg) {
     if (_native_rtc_alarm_callback) {
         _native_rtc_alarm_callback(arg);
@@ -148,7 +160,7 @@ int rtc_set_time(struct tm *ttime)
     struct timespec tv;
 
     _native_syscall_enter();
-    clock_gettime(NATIVE_RTC_SOURCE, &tv);
+    _native_rtc_clock(&tv);
     _native_syscall_leave();
 
     _native_rtc_offset = tnew - tv.tv_sec;
@@ -175,7 +187,7 @@ int rtc_get_time_ms(struct tm *ttime, uint16_t *ms)
     }
 
     _native_syscall_enter();
-    clock_gettime(NATIVE_RTC_SOURCE, &tv);
+    _native_rtc_clock(&tv);
     tv.tv_sec += _native_rtc_offset;
 
     if (ms) {
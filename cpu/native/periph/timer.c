@@ -20,9 +20,14 @@
  * This is based on native's hwtimer implementation by Ludwig Knüpfer.
  * I removed the multiplexing, as ztimer does the same. (kaspar)
  *
+ * With the `native_virtual_time` module, no host timer is used. The timer
+ * counts simulated time instead, which only advances when the idle thread
+ * jumps to the pending deadline, see @ref _native_virtual_time_advance.
+ *
  * @}
  */
 
+#include <inttypes.h>
 #include <signal.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -49,6 +54,11 @@ static void *_cb_arg;
 
 static struct itimerspec its;
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+static uint64_t _virtual_now;
+static uint64_t _virtual_deadline;
+static bool _virtual_armed;
+#else
 static timer_t itimer_monotonic;
 
 /**
@@ -59,6 +69,7 @@ static unsigned long ts2ticks(struct timespec *tp)
     /* TODO: check for overflow */
     return (((unsigned long)tp->tv_sec * NATIVE_TIMER_SPEED) + (tp->tv_nsec / 1000));
 }
+#endif
 
 /**
  * native timer signal handler
@@ -72,6 +83,45 @@ void native_isr_timer(void)
     _callback(_cb_arg, 0);
 }
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+static uint64_t ts2us(const struct timespec *tp)
+{
+    return ((uint64_t)tp->tv_sec * US_PER_SEC) + (tp->tv_nsec / NS_PER_US);
+}
+
+static void us2ts(uint64_t us, struct timespec *tp)
+{
+    tp->tv_sec = us / US_PER_SEC;
+    tp->tv_nsec = (us % US_PER_SEC) * NS_PER_US;
+}
+
+uint64_t _native_virtual_time_now(void)
+{
+    return _virtual_now;
+}
+
+bool _native_virtual_time_advance(void)
+{
+    if (!_virtual_armed) {
+        return false;
+    }
+
+    DEBUG("%s: %" PRIu64 " -> %" PRIu64 "\n", __func__, _virtual_now,
+          _virtual_deadline);
+
+    _virtual_now = _virtual_deadline;
+    if (its.it_interval.tv_sec || its.it_interval.tv_nsec) {
+        _virtual_deadline += ts2us(&its.it_interval);
+    }
+    else {
+        _virtual_armed = false;
+    }
+
+    _native_signal_post(SIGALRM);
+    return true;
+}
+#endif
+
 uword_t timer_query_freqs_numof(tim_t dev)
 {
     (void)dev;
@@ -111,6 +161,10 @@ int timer_init(tim_t dev, uint32_t freq, timer_cb_t cb, void *arg)
     _callback = cb;
     _cb_arg = arg;
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    /* the interrupt is posted by _native_virtual_time_advance() */
+    return native_register_interrupt(SIGALRM, native_isr_timer);
+#else
     if (timer_create(CLOCK_MONOTONIC, NULL, &itimer_monotonic) != 0) {
         DEBUG_PUTS("Failed to create a monotonic itimer");
         return -1;
@@ -123,13 +177,15 @@ int timer_init(tim_t dev, uint32_t freq, timer_cb_t cb, void *arg)
     }
 
     return 0;
+#endif
 }
 
 static void do_timer_set(unsigned int offset, bool periodic)
 {
     DEBUG("%s\n", __func__);
 
-    if (offset && offset < NATIVE_TIMER_MIN_RES) {
+    if (offset && offset < NATIVE_TIMER_MIN_RES &&
+        !IS_USED(MODULE_NATIVE_VIRTUAL_TIME)) {
         offset = NATIVE_TIMER_MIN_RES;
     }
 
@@ -198,11 +254,16 @@ void timer_start(tim_t dev)
     (void)dev;
     DEBUG("%s\n", __func__);
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    _virtual_deadline = _virtual_now + ts2us(&its.it_value);
+    _virtual_armed = its.it_value.tv_sec || its.it_value.tv_nsec;
+#else
     _native_syscall_enter();
     if (timer_settime(itimer_monotonic, 0, &its, NULL) == -1) {
         core_panic(PANIC_GENERAL_ERROR, "Failed to set monotonic timer");
     }
     _native_syscall_leave();
+#endif
 }
 
 void timer_stop(tim_t dev)
@@ -210,6 +271,15 @@ void timer_stop(tim_t dev)
     (void)dev;
     DEBUG("%s\n", __func__);
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    if (_virtual_armed) {
+        us2ts(_virtual_deadline - _virtual_now, &its.it_value);
+        _virtual_armed = false;
+    }
+    else {
+        memset(&its.it_value, 0, sizeof(its.it_value));
+    }
+#else
     _native_syscall_enter();
     struct itimerspec zero = {0};
     if (timer_settime(itimer_monotonic, 0, &zero, &its) == -1) {
@@ -218,6 +288,7 @@ void timer_stop(tim_t dev)
     _native_syscall_leave();
 
     DEBUG("time left: %lu.%09lu\n", (unsigned long)its.it_value.tv_sec, its.it_value.tv_nsec);
+#endif
 }
 
 unsigned int timer_read(tim_t dev)
@@ -226,10 +297,13 @@ unsigned int timer_read(tim_t dev)
         return 0;
     }
 
-    struct timespec t;
-
     DEBUG("timer_read()\n");
 
+#ifdef MODULE_NATIVE_VIRTUAL_TIME
+    return _virtual_now;
+#else
+    struct timespec t;
+
     _native_syscall_enter();
 
     if (clock_gettime(CLOCK_MONOTONIC, &t) == -1) {
@@ -239,4 +313,5 @@ unsigned int timer_read(tim_t dev)
     _native_syscall_leave();
 
     return ts2ticks(&t) - time_null;
+#endif
 }
@@ -113,10 +113,7 @@ static void _continue_reading(socket_zep_t *dev)
     dev->state = ZEPDEV_STATE_RX_ON;
 
     if (real_select(dev->sock_fd + 1, &rfds, NULL, NULL, &t) == 1) {
-        int sig = SIGIO;
-        extern int _signal_pipe_fd[2];
-        real_write(_signal_pipe_fd[1], &sig, sizeof(sig));
-        _native_pending_signals++;
+        _native_signal_post(SIGIO);
     }
     else {
         native_async_read_continue(dev->sock_fd);
@@ -85,6 +85,9 @@ socket_zep_params_t socket_zep_params[SOCKET_ZEP_MAX];
 #include "eeprom_native.h"
 extern char eeprom_file[EEPROM_FILEPATH_MAX_LEN];
 #endif
+#ifdef MODULE_TRACE_EVENTS_MMAP
+#include "trace_events_mmap.h"
+#endif
 
 static const char short_opts[] = ":hi:s:deEoc:"
 #ifdef MODULE_PERIPH_GPIO_LINUX
@@ -107,6 +110,9 @@ static const char short_opts[] = ":hi:s:deEoc:"
 #endif
 #ifdef MODULE_NETDEV_TAP
     "w:"
+#endif
+#ifdef MODULE_TRACE_EVENTS_MMAP
+    "T:"
 #endif
     "";
 
@@ -147,6 +153,9 @@ static const struct option long_opts[] = {
 #endif
 #ifdef MODULE_PERIPH_EEPROM
     { "eeprom", required_argument, NULL, 'M' },
+#endif
+#ifdef MODULE_TRACE_EVENTS_MMAP
+    { "trace-file", required_argument, NULL, 'T' },
 #endif
     { NULL, 0, NULL, '\0' },
 };
@@ -368,6 +377,12 @@ void usage_exit(int status)
 "        Specify the file path where the EEPROM content is stored\n"
 "        Example: --eeprom=/tmp/riot_native.eeprom\n");
 #endif
+#ifdef MODULE_TRACE_EVENTS_MMAP
+    real_printf(
+"    -T <file>, --trace-file=<file>\n"
+"        Specify the file the binary event trace is mapped to\n"
+"        Default: " CONFIG_TRACE_EVENTS_MMAP_FILE "\n");
+#endif
 #ifdef MODULE_NETDEV_TAP
     real_printf(
 "    -w <tap>\n"
@@ -631,6 +646,11 @@ __attribute__((constructor)) static void startup(int argc, char **argv, char **e
                 break;
             }
 #endif
+#ifdef MODULE_TRACE_EVENTS_MMAP
+            case 'T':
+                trace_events_mmap_file = optarg;
+                break;
+#endif
 #ifdef MODULE_NETDEV_TAP
             case 'w':
                 netdev_tap_params[taps].tap_name = &argv[optind - 1];
@@ -69,22 +69,7 @@ void _native_syscall_leave(void)
     }
 
     _native_pending_syscalls_down();
-    if (
-            (_native_pending_signals > 0)
-            && (_native_in_isr == 0)
-            && (_native_pending_syscalls == 0)
-            && (_native_interrupts_enabled)
-            && (thread_get_active() != NULL)
-       )
-    {
-        _native_in_isr = 1;
-        _native_interrupts_enabled = false;
-
-        _native_isr_context_make(_native_call_sig_handlers_and_switch);
-        if (swapcontext(_native_user_context(), _native_isr_context) == -1) {
-            err(EXIT_FAILURE, "_native_syscall_leave: swapcontext");
-        }
-    }
+    _native_handle_pending_signals();
 }
 
 /* make use of TLSF if it is included, except when building with valgrind
@@ -494,6 +479,7 @@ void _native_init_syscalls(void)
     *(void **)(&real_ferror) = dlsym(RTLD_NEXT, "ferror");
     *(void **)(&real_clearerr) = dlsym(RTLD_NEXT, "clearerr");
     *(void **)(&real_umask) = dlsym(RTLD_NEXT, "umask");
+    *(void **)(&real_readv) = dlsym(RTLD_NEXT, "readv");
     *(void **)(&real_writev) = dlsym(RTLD_NEXT, "writev");
     *(void **)(&real_send) = dlsym(RTLD_NEXT, "send");
     *(void **)(&real_fclose) = dlsym(RTLD_NEXT, "fclose");
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @file
+ * @ingroup cpu_native
+ * @brief   Memory mapped file backend for the binary event tracer
+ *
+ * The ring of @ref sys_trace_events is placed into a shared file mapping, so
+ * host tools can read the events while the process is running and after it
+ * has terminated, without any output from inside RIOT.
+ */
+
+#include <err.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "trace_events.h"
+#include "trace_events_mmap.h"
+
+#include "native_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+const char *trace_events_mmap_file = CONFIG_TRACE_EVENTS_MMAP_FILE;
+
+void *trace_events_backend_mem(size_t *size)
+{
+    size_t len = sizeof(trace_events_ring_t) +
+                 CONFIG_TRACE_EVENTS_NUMOF * sizeof(trace_event_t);
+    void *mem = MAP_FAILED;
+
+    DEBUG("trace_events_mmap: mapping %u bytes of %s\n", (unsigned)len,
+          trace_events_mmap_file);
+
+    _native_syscall_enter();
+    int fd = real_open(trace_events_mmap_file, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        warn("trace_events_mmap: open(%s)", trace_events_mmap_file);
+    }
+    else if (ftruncate(fd, len) < 0) {
+        warn("trace_events_mmap: ftruncate()");
+    }
+    else {
+        mem = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mem == MAP_FAILED) {
+            warn("trace_events_mmap: mmap()");
+        }
+    }
+    if (fd >= 0) {
+        /* the mapping stays valid after the file is closed */
+        real_close(fd);
+    }
+    _native_syscall_leave();
+
+    if (mem == MAP_FAILED) {
+        return NULL;
+    }
+
+    *size = len;
+    return mem;
+}
@@ -0,0 +1,14 @@
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""
+Output format of benchmarks using `BENCHMARK_RUN()`, for use in test scripts.
+
+`tests/bench/Makefile.bench_common` adds this directory to `PYTHONPATH`.
+"""
+
+# Regular expression matching the JSON line of the benchmark named `func`,
+# to be filled in with `BENCHMARK_REGEXP.format(func=...)`. `func` is a regular
+# expression itself, so special characters in the name need to be escaped.
+BENCHMARK_REGEXP = r'{{ "bench" : "{func}", "unit" : "\w+", "runs" : \d+, "samples" : \d+, ' \
+                   r'"min" : [\d.]+, "median" : [\d.]+, "p99" : [\d.]+, "max" : [\d.]+ }}'
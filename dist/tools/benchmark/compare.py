@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""
+Compare the results of benchmarks using `BENCHMARK_RUN()` against a baseline.
+
+Both files are the terminal output of a benchmark application, e.g. captured
+with `make term | tee results.txt`. Lines that are neither JSON nor CSV
+output of a benchmark are ignored.
+"""
+
+import argparse
+import csv
+import json
+import sys
+
+STATS = ("min", "median", "p99", "max")
+
+
+def parse(path):
+    """Return the results in the output at path, indexed by benchmark name"""
+    results = {}
+    header = None
+    with open(path, encoding="utf-8", errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith('{ "bench"'):
+                try:
+                    res = json.loads(line)
+                except json.JSONDecodeError:
+                    continue
+                results[res["bench"]] = res
+            elif line.startswith("bench,unit,"):
+                header = line.split(",")
+            elif header and line.startswith('"'):
+                row = next(csv.reader([line]))
+                if len(row) == len(header):
+                    res = dict(zip(header, row))
+                    for stat in STATS:
+                        res[stat] = float(res[stat])
+                    results[res["bench"]] = res
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("baseline", help="output of the baseline version")
+    parser.add_argument("current", help="output of the version to check")
+    parser.add_argument("-s", "--stat", choices=STATS, default="median",
+                        help="statistic to compare (default: median)")
+    parser.add_argument("-t", "--threshold", type=float, default=5.0,
+                        help="change in percent reported as regression "
+                             "(default: 5)")
+    args = parser.parse_args()
+
+    baseline = parse(args.baseline)
+    current = parse(args.current)
+    if not current:
+        sys.exit(f"No benchmark results found in {args.current}")
+
+    regressions = 0
+    width = max(len(name) for name in current)
+    print(f"{'benchmark':<{width}} {'baseline':>12} {'current':>12} "
+          f"{'change':>8}")
+    for name, res in current.items():
+        if name not in baseline:
+            print(f"{name:<{width}} {'-':>12} {res[args.stat]:>12.3f} "
+                  f"{'new':>8}")
+            continue
+        if baseline[name]["unit"] != res["unit"]:
+            print(f"{name:<{width}} units differ: {baseline[name]['unit']} "
+                  f"vs. {res['unit']}")
+            continue
+        old = baseline[name][args.stat]
+        new = res[args.stat]
+        change = (new - old) * 100 / old if old else 0.0
+        mark = ""
+        if change > args.threshold:
+            mark = "  REGRESSION"
+            regressions += 1
+        print(f"{name:<{width}} {old:>12.3f} {new:>12.3f} "
+              f"{change:>+7.1f}%{mark}")
+
+    if regressions:
+        sys.exit(f"{regressions} benchmark(s) regressed by more than "
+                 f"{args.threshold}%")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,221 @@
+#! /usr/bin/env python3
+#
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+"""
+Script to convert the ring of the `trace_events` module into Common Trace
+Format (CTF 1.8), into a JSON trace that can be opened with Perfetto or into
+plain text.
+
+The ring is read from a file, either the memory mapped file written by the
+`trace_events_mmap` module on native, or a memory dump of the ring taken from
+a device.
+"""
+
+import argparse
+import json
+import os
+import struct
+import sys
+
+MAGIC = 0x43525452
+VERSION = 1
+HEADER = "IHHIII12x"
+RECORD = "IIHHI"
+KERNEL_PID_UNDEF = 0
+
+# event ID: (name, arg0 name, arg1 name)
+EVENTS = {
+    0: ("user", "arg0", "arg1"),
+    1: ("sched_switch", "next_pid", "prev_pid"),
+    2: ("isr_enter", "irq", "unused"),
+    3: ("isr_exit", "irq", "unused"),
+    4: ("msg_send", "target_pid", "type"),
+    5: ("msg_recv", "sender_pid", "type"),
+    6: ("mutex_contended", "owner_pid", "mutex"),
+    7: ("pktbuf_alloc", "size", "ptr"),
+    8: ("pktbuf_free", "size", "ptr"),
+}
+
+CTF_MAGIC = 0xC1FC1FC1
+CTF_METADATA_HEAD = """/* CTF 1.8 */
+
+typealias integer {{ size = 16; align = 8; signed = false; }} := uint16_t;
+typealias integer {{ size = 32; align = 8; signed = false; }} := uint32_t;
+typealias integer {{ size = 64; align = 8; signed = false; }} := uint64_t;
+
+trace {{
+    major = 1;
+    minor = 8;
+    byte_order = {byte_order};
+    packet.header := struct {{
+        uint32_t magic;
+        uint32_t stream_id;
+    }};
+}};
+
+clock {{
+    name = riot;
+    freq = {freq};
+}};
+
+typealias integer {{
+    size = 64; align = 8; signed = false;
+    map = clock.riot.value;
+}} := riot_clock_t;
+
+stream {{
+    id = 0;
+    event.header := struct {{
+        uint16_t id;
+        riot_clock_t timestamp;
+    }};
+}};
+"""
+CTF_METADATA_EVENT = """
+event {{
+    name = "{name}";
+    id = {id};
+    stream_id = 0;
+    fields := struct {{
+        uint16_t {arg0};
+        uint32_t {arg1};
+    }};
+}};
+"""
+
+
+def event_name(event_id):
+    return EVENTS.get(event_id, ("event_{}".format(event_id),))[0]
+
+
+def read_ring(filename):
+    """Returns the byte order, the timestamp frequency and the records of the
+    ring in stream order, with the timestamps extended to 64 bit."""
+    with open(filename, "rb") as f:
+        data = f.read()
+
+    for endian in ("<", ">"):
+        hdr = struct.unpack_from(endian + HEADER, data)
+        if hdr[0] == MAGIC:
+            break
+    else:
+        raise ValueError("{}: not a trace_events ring".format(filename))
+
+    _, version, record_size, numof, head, freq = hdr
+    if version != VERSION:
+        raise ValueError("{}: unsupported version {}".format(filename, version))
+
+    offset = struct.calcsize(HEADER)
+    records = []
+    for i in range(numof):
+        seq, time, event_id, arg0, arg1 = struct.unpack_from(
+            endian + RECORD, data, offset + i * record_size)
+        # skip empty slots and records that were being written
+        if seq == 0 or ((head - seq) & 0xffffffff) >= numof:
+            continue
+        records.append([(seq - head - 1) & 0xffffffff, time, event_id, arg0, arg1])
+    records.sort()
+
+    # timestamps are 32 bit microseconds and wrap after ~71 minutes
+    wraps = 0
+    last = None
+    for rec in records:
+        if last is not None and rec[1] < last:
+            wraps += 1
+        last = rec[1]
+        rec[1] += wraps << 32
+
+    return endian, freq, [tuple(rec[1:]) for rec in records]
+
+
+def write_text(records, freq, out):
+    last = None
+    for n, (time, event_id, arg0, arg1) in enumerate(records):
+        names = EVENTS.get(event_id, (event_name(event_id), "arg0", "arg1"))
+        delta = "{:>10}".format(time) if last is None else "+{:>9}".format(time - last)
+        out.write("n={:4} t={} {:<16} {}={} {}=0x{:08x}\n".format(
+            n, delta, names[0], names[1], arg0, names[2], arg1))
+        last = time
+
+
+def write_perfetto(records, freq, out):
+    us = 1000000 / freq
+    trace = []
+    tids = set()
+    running = None
+    for time, event_id, arg0, arg1 in records:
+        ts = time * us
+        if event_id == 1:
+            if running is not None:
+                trace.append({"ph": "E", "pid": 0, "tid": running, "ts": ts})
+            trace.append({"ph": "B", "pid": 0, "tid": arg0, "ts": ts,
+                          "name": "running"})
+            running = arg0
+            tids.add(arg0)
+        elif event_id in (2, 3):
+            trace.append({"ph": "B" if event_id == 2 else "E", "pid": 1,
+                          "tid": arg0, "ts": ts, "name": "irq {}".format(arg0)})
+        else:
+            names = EVENTS.get(event_id, (event_name(event_id), "arg0", "arg1"))
+            tid = running if running is not None else KERNEL_PID_UNDEF
+            trace.append({"ph": "i", "s": "t", "pid": 0, "tid": tid, "ts": ts,
+                          "name": names[0],
+                          "args": {names[1]: arg0, names[2]: arg1}})
+    meta = [{"ph": "M", "pid": 0, "name": "process_name", "args": {"name": "threads"}},
+            {"ph": "M", "pid": 1, "name": "process_name", "args": {"name": "interrupts"}}]
+    meta += [{"ph": "M", "pid": 0, "tid": tid, "name": "thread_name",
+              "args": {"name": "pid {}".format(tid)}} for tid in sorted(tids)]
+    json.dump({"traceEvents": meta + trace, "displayTimeUnit": "ns"}, out)
+
+
+def write_ctf(records, freq, endian, outdir):
+    os.makedirs(outdir, exist_ok=True)
+    ids = sorted(set(EVENTS) | {rec[1] for rec in records})
+    with open(os.path.join(outdir, "metadata"), "w") as f:
+        f.write(CTF_METADATA_HEAD.format(
+            byte_order="le" if endian == "<" else "be", freq=freq))
+        for event_id in ids:
+            names = EVENTS.get(event_id, (event_name(event_id), "arg0", "arg1"))
+            f.write(CTF_METADATA_EVENT.format(
+                name=names[0], id=event_id, arg0=names[1], arg1=names[2]))
+    with open(os.path.join(outdir, "stream_0"), "wb") as f:
+        f.write(struct.pack(endian + "II", CTF_MAGIC, 0))
+        for time, event_id, arg0, arg1 in records:
+            f.write(struct.pack(endian + "HQHI", event_id, time, arg0, arg1))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("ring", help="file containing the ring")
+    parser.add_argument("-f", "--format", choices=("text", "perfetto", "ctf"),
+                        default="text", help="output format (default: text)")
+    parser.add_argument("-o", "--output",
+                        help="output file, or directory for CTF (default: stdout)")
+    args = parser.parse_args()
+
+    try:
+        endian, freq, records = read_ring(args.ring)
+    except (OSError, ValueError, struct.error) as e:
+        sys.exit(str(e))
+
+    if args.format == "ctf":
+        if not args.output:
+            sys.exit("CTF output requires an output directory")
+        write_ctf(records, freq, endian, args.output)
+        return
+
+    out = open(args.output, "w") if args.output else sys.stdout
+    try:
+        if args.format == "perfetto":
+            write_perfetto(records, freq, out)
+        else:
+            write_text(records, freq, out)
+    finally:
+        if out is not sys.stdout:
+            out.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -33,6 +33,12 @@ extern "C" {
  * @{
  */
 #define NETDEV_ETH_RX_INFO_FLAG_TIMESTAMP       (0x01)  /**< Timestamp valid */
+/**
+ * @brief   The device verified the upper layer checksum of the packet
+ *
+ * @see @ref NETOPT_CSUM_OFFLOAD
+ */
+#define NETDEV_ETH_RX_INFO_FLAG_CSUM_VALID      (0x02)
 /** @} */
 
 /**
@@ -259,24 +259,34 @@ static void _isr(netdev_t *netdev)
 
         DEBUG("IEEE802154 submac: _isr_flags_get_clear(): pending flags: %"PRIu32"\n", flags);
         assert(!flags);
-        break;
-
-    } while (1);
 
-    if (netdev_submac->dispatch) {
+        if (!netdev_submac->dispatch) {
+            DEBUG("IEEE802154 submac: no events to dispatch\n");
+            break;
+        }
         /* The SubMAC will not generate further events after calling TX Done or RX Done. */
         netdev_submac->dispatch = false;
         /* TODO: Prevent race condition when state goes to PREPARE */
         DEBUG("IEEE802154 submac: _isr(): dispatching %d\n", netdev_submac->ev);
         netdev->event_callback(netdev, netdev_submac->ev);
+        /* If the upper layer sent the next frame from the callback (e.g. from
+         * its send queue), the frame is already in the framebuffer. Start
+         * the CSMA-CA procedure now rather than after another round trip
+         * through the event queue of the upper layer. Going through the flags
+         * again also dispatches the TX Done of a frame that fails right away
+         * (e.g. channel busy without CSMA-CA retries left). The
+         * NETDEV_EVENT_ISR posted for the request then finds nothing to do. */
+        if (atomic_load_u32(&netdev_submac->isr_flags) & NETDEV_SUBMAC_FLAGS_BH_REQUEST) {
+            DEBUG("IEEE802154 submac: _isr(): next frame queued by callback\n");
+            continue;
+        }
         /* HACK: the TX_STARTED event is used to indicate a frame was
          * sent during the event callback.
          * If no frame was sent go back to RX */
         ieee802154_set_rx(submac);
-    }
-    else {
-        DEBUG("IEEE802154 submac: no events to dispatch\n");
-    }
+        break;
+
+    } while (1);
 }
 
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
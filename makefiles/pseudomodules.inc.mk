@@ -113,6 +113,7 @@ PSEUDOMODULES += gnrc_ipv6_auto_subnets_simple
 PSEUDOMODULES += gnrc_ipv6_classic
 PSEUDOMODULES += gnrc_ipv6_default
 PSEUDOMODULES += gnrc_ipv6_ext_frag_stats
+PSEUDOMODULES += gnrc_ipv6_fastpath
 PSEUDOMODULES += gnrc_ipv6_router
 PSEUDOMODULES += gnrc_ipv6_router_default
 PSEUDOMODULES += gnrc_ipv6_nib_6lbr
@@ -124,6 +125,7 @@ PSEUDOMODULES += gnrc_ipv6_nib_router
 PSEUDOMODULES += gnrc_ipv6_nib_rtr_adv_pio_cb
 PSEUDOMODULES += gnrc_lorawan_1_1
 PSEUDOMODULES += gnrc_neterr
+PSEUDOMODULES += gnrc_netapi_burst
 PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
 PSEUDOMODULES += gnrc_netif_bus
@@ -132,6 +134,7 @@ PSEUDOMODULES += gnrc_netif_6lo
 PSEUDOMODULES += gnrc_netif_ipv6
 PSEUDOMODULES += gnrc_netif_single
 PSEUDOMODULES += gnrc_netif_dedup
+PSEUDOMODULES += gnrc_netif_pktq_fq
 
 
 ## @addtogroup 	net_gnrc_nettype
@@ -244,6 +247,7 @@ PSEUDOMODULES += gnrc_sock_check_reuse
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
+PSEUDOMODULES += ieee802154_submac_stats
 PSEUDOMODULES += ipv4
 PSEUDOMODULES += ipv6
 PSEUDOMODULES += l2filter_blacklist
@@ -291,6 +295,8 @@ PSEUDOMODULES += nanocoap_%
 PSEUDOMODULES += nanocoap_fileserver_callback
 PSEUDOMODULES += nanocoap_fileserver_delete
 PSEUDOMODULES += nanocoap_fileserver_put
+PSEUDOMODULES += native_irq_virtual
+PSEUDOMODULES += native_virtual_time
 PSEUDOMODULES += netdev_default
 PSEUDOMODULES += netdev_ieee802154_%
 PSEUDOMODULES += netdev_ieee802154_rx_timestamp
@@ -300,12 +306,15 @@ PSEUDOMODULES += netdev_layer
 PSEUDOMODULES += netdev_legacy_api
 PSEUDOMODULES += netdev_new_api
 PSEUDOMODULES += netdev_register
+PSEUDOMODULES += netdev_tap_csum_offload
 PSEUDOMODULES += netstats
 PSEUDOMODULES += netstats_l2
+PSEUDOMODULES += netstats_neighbor_cbor
 PSEUDOMODULES += netstats_neighbor_etx
 PSEUDOMODULES += netstats_neighbor_count
 PSEUDOMODULES += netstats_neighbor_rssi
 PSEUDOMODULES += netstats_neighbor_lqi
+PSEUDOMODULES += netstats_neighbor_traffic
 PSEUDOMODULES += netstats_neighbor_tx_time
 PSEUDOMODULES += netstats_ipv6
 PSEUDOMODULES += netstats_rpl
@@ -364,6 +373,7 @@ PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+PSEUDOMODULES += sched_status_callback
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -436,6 +446,7 @@ PSEUDOMODULES += shell_cmd_random
 PSEUDOMODULES += shell_cmd_rtc
 PSEUDOMODULES += shell_cmd_rtt
 PSEUDOMODULES += shell_cmd_saul_reg
+PSEUDOMODULES += shell_cmd_sched_accounting
 PSEUDOMODULES += shell_cmd_semtech-loramac
 PSEUDOMODULES += shell_cmd_sha1sum
 PSEUDOMODULES += shell_cmd_sha256sum
@@ -461,6 +472,8 @@ PSEUDOMODULES += sock_aux_local
 PSEUDOMODULES += sock_aux_rssi
 PSEUDOMODULES += sock_aux_timestamp
 PSEUDOMODULES += sock_aux_ttl
+PSEUDOMODULES += sock_coro
+PSEUDOMODULES += sock_dns_coalesce
 PSEUDOMODULES += sock_dtls
 PSEUDOMODULES += sock_dtls_verify_public_key
 PSEUDOMODULES += sock_ip
@@ -22,6 +22,7 @@
 #include "lwip.h"
 #include "lwip/err.h"
 #include "lwip/ethip6.h"
+#include "lwip/ip.h"
 #include "lwip/netif.h"
 #include "lwip/netif/compat.h"
 #include "lwip/netif/netdev.h"
@@ -59,7 +60,10 @@ event_queue_t lwip_event_queue = { 0 };
 
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static WORD_ALIGNED char _stack[LWIP_NETDEV_STACKSIZE];
-static char _tmp_buf[LWIP_NETDEV_BUFLEN];
+#if IS_USED(MODULE_LWIP_CORE_LOCKING_INPUT)
+/* whether a device signals the end of its transmissions through _pid */
+static bool _has_new_api_netdev;
+#endif
 
 #ifdef MODULE_NETDEV_ETH
 static err_t _eth_link_output(struct netif *netif, struct pbuf *p);
@@ -118,6 +122,11 @@ err_t lwip_netdev_init(struct netif *netif)
     }
 
     netdev = netif->state;
+#if IS_USED(MODULE_LWIP_CORE_LOCKING_INPUT)
+    if (!is_netdev_legacy_api(netdev)) {
+        _has_new_api_netdev = true;
+    }
+#endif
     lwip_netif_dev_acquire(netif);
     netdev->event_callback = _event_cb;
     netdev->driver->init(netdev);
@@ -417,25 +426,64 @@ static struct pbuf *_get_recv_pkt(netdev_t *dev)
 {
     lwip_netif_t *compat_netif = dev->context;
     struct netif *netif = &compat_netif->lwip_netif;
+    struct pbuf *p = NULL;
     lwip_netif_dev_acquire(netif);
-    int len = dev->driver->recv(dev, _tmp_buf, sizeof(_tmp_buf), NULL);
-    lwip_netif_dev_release(netif);
+    int len = dev->driver->recv(dev, NULL, 0, NULL);
 
-    if (len < 0) {
+    if (len <= 0) {
         DEBUG("lwip_netdev: an error occurred while reading the packet\n");
-        return NULL;
+        goto out;
     }
-    assert(((unsigned)len) <= UINT16_MAX);
-    struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)len, PBUF_POOL);
-
-    if (p == NULL) {
+    /* a PBUF_RAM pbuf is contiguous, so the driver can write the frame right
+     * into it */
+    if ((len > UINT16_MAX) ||
+        ((p = pbuf_alloc(PBUF_RAW, (u16_t)len, PBUF_RAM)) == NULL)) {
         DEBUG("lwip_netdev: can not allocate in pbuf\n");
-        return NULL;
+        /* drop the frame */
+        dev->driver->recv(dev, NULL, len, NULL);
+        goto out;
     }
-    pbuf_take(p, _tmp_buf, len);
+    len = dev->driver->recv(dev, p->payload, p->len, NULL);
+    if (len < 0) {
+        DEBUG("lwip_netdev: an error occurred while reading the packet\n");
+        pbuf_free(p);
+        p = NULL;
+        goto out;
+    }
+    /* the first call to recv() may only return an upper bound */
+    pbuf_realloc(p, (u16_t)len);
+out:
+    lwip_netif_dev_release(netif);
     return p;
 }
 
+static err_t _input(struct pbuf *p, struct netif *netif)
+{
+#if IS_USED(MODULE_LWIP_CORE_LOCKING_INPUT)
+    /* A thread sending on a device with the new netdev API holds the core
+     * lock until this thread signals the end of the transmission. So once
+     * there is such a device, this thread must never wait for the core lock
+     * and all frames go to the TCP/IP thread. */
+    if ((netif->input == tcpip_input) && !_has_new_api_netdev) {
+        err_t res;
+
+        LOCK_TCPIP_CORE();
+#if LWIP_ETHERNET
+        if (netif->flags & (NETIF_FLAG_ETHARP | NETIF_FLAG_ETHERNET)) {
+            res = ethernet_input(p, netif);
+        }
+        else
+#endif
+        {
+            res = ip_input(p, netif);
+        }
+        UNLOCK_TCPIP_CORE();
+        return res;
+    }
+#endif
+    return netif->input(p, netif);
+}
+
 static void _event_cb(netdev_t *dev, netdev_event_t event)
 {
     lwip_netif_t *compat_netif = dev->context;
@@ -468,8 +516,9 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 DEBUG("lwip_netdev: error receiving packet\n");
                 return;
             }
-            if (netif->input(p, netif) != ERR_OK) {
+            if (_input(p, netif) != ERR_OK) {
                 DEBUG("lwip_netdev: error inputing packet\n");
+                pbuf_free(p);
                 return;
             }
         }
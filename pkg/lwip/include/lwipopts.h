@@ -157,6 +157,11 @@ extern "C" {
 
 #define LWIP_SOCKET             0
 
+/* calls through the netconn API, and thus sock, run the stack directly in the
+ * calling thread under the core lock instead of posting to the TCP/IP thread.
+ * The porting layer relies on it, see sys_lock_tcpip_core() */
+#define LWIP_TCPIP_CORE_LOCKING 1
+
 #define LWIP_DONT_PROVIDE_BYTEORDER_FUNCTIONS
 #define MEMP_MEM_MALLOC         1
 #define NETIF_MAX_HWADDR_LEN    (GNRC_NETIF_HDR_L2ADDR_MAX_LEN)
@@ -65,6 +65,16 @@ extern void init_schedstatistics(void);
 AUTO_INIT(init_schedstatistics,
           AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS);
 #endif
+#if IS_USED(MODULE_SCHED_ACCOUNTING)
+extern void auto_init_sched_accounting(void);
+AUTO_INIT(auto_init_sched_accounting,
+          AUTO_INIT_PRIO_MOD_SCHED_ACCOUNTING);
+#endif
+#if IS_USED(MODULE_TRACE_EVENTS)
+extern void auto_init_trace_events(void);
+AUTO_INIT(auto_init_trace_events,
+          AUTO_INIT_PRIO_MOD_TRACE_EVENTS);
+#endif
 #if IS_USED(MODULE_SCHED_ROUND_ROBIN)
 extern void sched_round_robin_init(void);
 AUTO_INIT(sched_round_robin_init,
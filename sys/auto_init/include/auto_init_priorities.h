@@ -58,6 +58,18 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS              1050
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_SCHED_ACCOUNTING
+/**
+ * @brief   scheduler latency accounting priority
+ */
+#define AUTO_INIT_PRIO_MOD_SCHED_ACCOUNTING             1052
+#endif
+#ifndef AUTO_INIT_PRIO_MOD_TRACE_EVENTS
+/**
+ * @brief   binary event tracer priority
+ */
+#define AUTO_INIT_PRIO_MOD_TRACE_EVENTS                 1055
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN
 /**
  * @brief   round robin scheduling priority
@@ -19,10 +19,137 @@
  */
 
 #include <stdio.h>
+
+#include "container.h"
 #include "timex.h"
 
 #include "benchmark.h"
 
+enum {
+    PHASE_CALIBRATE,
+    PHASE_WARMUP,
+    PHASE_SAMPLE,
+    PHASE_DONE,
+};
+
+/* sample durations of the running benchmark, sorted when it is done */
+static uint32_t _samples[CONFIG_BENCHMARK_SAMPLES];
+
+void benchmark_begin(benchmark_t *bench, const char *name)
+{
+#ifdef BENCHMARK_DWT
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    bench->name = name;
+    bench->runs = 1;
+    bench->done = 0;
+    bench->phase = PHASE_CALIBRATE;
+}
+
+bool benchmark_next(benchmark_t *bench)
+{
+    bench->start_us = ztimer_now(ZTIMER_USEC);
+    return bench->phase != PHASE_DONE;
+}
+
+void benchmark_record(benchmark_t *bench, uint32_t ticks)
+{
+    uint32_t elapsed_us = ztimer_now(ZTIMER_USEC) - bench->start_us;
+
+    switch (bench->phase) {
+    case PHASE_CALIBRATE:
+        if ((elapsed_us < CONFIG_BENCHMARK_SAMPLE_US) &&
+            (bench->runs < CONFIG_BENCHMARK_RUNS_MAX)) {
+            /* grow fast while far off */
+            bench->runs *= (elapsed_us < CONFIG_BENCHMARK_SAMPLE_US / 16) ? 8 : 2;
+            if (bench->runs > CONFIG_BENCHMARK_RUNS_MAX) {
+                bench->runs = CONFIG_BENCHMARK_RUNS_MAX;
+            }
+            return;
+        }
+        bench->phase = PHASE_WARMUP;
+        /* fall through */
+    case PHASE_WARMUP:
+        if (bench->done < CONFIG_BENCHMARK_WARMUP) {
+            bench->done++;
+            return;
+        }
+        bench->phase = PHASE_SAMPLE;
+        bench->done = 0;
+        /* fall through */
+    case PHASE_SAMPLE:
+        _samples[bench->done++] = ticks;
+        if (bench->done == CONFIG_BENCHMARK_SAMPLES) {
+            bench->phase = PHASE_DONE;
+        }
+        return;
+    default:
+        return;
+    }
+}
+
+static void _sort(uint32_t *values, unsigned numof)
+{
+    for (unsigned i = 1; i < numof; i++) {
+        uint32_t v = values[i];
+        unsigned j = i;
+        while ((j > 0) && (values[j - 1] > v)) {
+            values[j] = values[j - 1];
+            j--;
+        }
+        values[j] = v;
+    }
+}
+
+/* prints the duration of a single run with three decimals */
+static void _print_per_run(uint32_t ticks, uint32_t runs)
+{
+    uint32_t full = ticks / runs;
+    uint32_t frac = (uint32_t)(((uint64_t)(ticks - full * runs)) * 1000 / runs);
+
+    printf("%" PRIu32 ".%03" PRIu32, full, frac);
+}
+
+void benchmark_report(const benchmark_t *bench)
+{
+    const unsigned last = CONFIG_BENCHMARK_SAMPLES - 1;
+
+    _sort(_samples, CONFIG_BENCHMARK_SAMPLES);
+
+    const uint32_t stats[] = {
+        _samples[0],
+        _samples[last / 2],
+        _samples[last * 99 / 100],
+        _samples[last],
+    };
+
+#ifdef CONFIG_BENCHMARK_OUTPUT_CSV
+    static bool header_printed;
+    if (!header_printed) {
+        puts("bench,unit,runs,samples,min,median,p99,max");
+        header_printed = true;
+    }
+    printf("\"%s\"," BENCHMARK_UNIT ",%" PRIu32 ",%u",
+           bench->name, bench->runs, CONFIG_BENCHMARK_SAMPLES);
+    for (unsigned i = 0; i < ARRAY_SIZE(stats); i++) {
+        putchar(',');
+        _print_per_run(stats[i], bench->runs);
+    }
+    putchar('\n');
+#else
+    static const char *labels[] = { "min", "median", "p99", "max" };
+    printf("{ \"bench\" : \"%s\", \"unit\" : \"" BENCHMARK_UNIT "\", "
+           "\"runs\" : %" PRIu32 ", \"samples\" : %u",
+           bench->name, bench->runs, CONFIG_BENCHMARK_SAMPLES);
+    for (unsigned i = 0; i < ARRAY_SIZE(stats); i++) {
+        printf(", \"%s\" : ", labels[i]);
+        _print_per_run(stats[i], bench->runs);
+    }
+    puts(" }");
+#endif
+}
+
 void benchmark_print_time(uint32_t time, unsigned long runs, const char *name)
 {
     uint32_t full = (time / runs);
@@ -0,0 +1,479 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   C++20 coroutines running on an event queue
+ *
+ * A @ref riot::task is a coroutine that is resumed by events posted to the
+ * queue it was started on, so many tasks share the stack of one event
+ * thread. Within a task, `co_await` suspends it until a sock has data, see
+ * @ref riot::async_recv, or until a timeout expired, see
+ * @ref riot::sleep_for.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.cpp}
+ * riot::task echo(sock_udp_t* sock) {
+ *   uint8_t buf[64];
+ *   sock_udp_ep_t remote;
+ *   while (true) {
+ *     ssize_t res = co_await riot::async_recv(sock, buf, sizeof(buf), &remote);
+ *     if (res > 0) {
+ *       sock_udp_send(sock, buf, res, &remote);
+ *     }
+ *   }
+ * }
+ *
+ * echo(&sock).start(EVENT_PRIO_MEDIUM);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Unlike the coroutines of @ref event/coro.h, the locals of a task survive
+ * suspension: the compiler keeps them in a coroutine frame, which is
+ * allocated with `new` when the task is created and freed when it finished.
+ *
+ * Requires `-std=c++20` in `CXXEXFLAGS`. The sock functions need the
+ * `sock_async` module, the timeouts the `ztimer` module.
+ *
+ * @}
+ */
+
+#if __cplusplus < 202002L
+#error "riot/coroutine.hpp requires C++20"
+#endif
+
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <utility>
+
+#include <sys/types.h>
+
+#include "event.h"
+#include "modules.h"
+
+#if IS_USED(MODULE_ZTIMER)
+#include "ztimer.h"
+#endif
+
+#if IS_USED(MODULE_SOCK_ASYNC)
+#ifdef MODULE_SOCK_DTLS
+#include "net/sock/dtls.h"
+#endif
+#include "net/sock/ip.h"
+#include "net/sock/tcp.h"
+#include "net/sock/udp.h"
+#include "net/sock/async.h"
+#endif
+
+namespace riot {
+
+namespace detail {
+
+/**
+ * @brief An event resuming a suspended coroutine.
+ */
+struct resume_event : event_t {
+  /**
+   * @brief Creates an event resuming nothing yet.
+   */
+  resume_event() noexcept : event_t{}, handle{} { this->handler = resume; }
+
+  /**
+   * @brief The coroutine to resume.
+   */
+  std::coroutine_handle<> handle;
+
+private:
+  static void resume(event_t* event) {
+    static_cast<resume_event*>(event)->handle.resume();
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief A coroutine running on an event queue.
+ *
+ * A task is created suspended by calling a coroutine function returning
+ * `riot::task`, and runs once it was started on an event queue. It then
+ * owns itself and frees its frame when it finished.
+ *
+ * Exceptions leaving a task terminate the program.
+ */
+class task {
+public:
+  /**
+   * @brief The promise type of a task.
+   */
+  class promise_type {
+  public:
+    /**
+     * @brief Creates the task object returned to the caller.
+     */
+    task get_return_object() noexcept {
+      return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+    /**
+     * @brief Tasks do not run before they were started.
+     */
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    /**
+     * @brief Tasks free their frame when they finished.
+     */
+    std::suspend_never final_suspend() noexcept { return {}; }
+    /**
+     * @brief Tasks return nothing.
+     */
+    void return_void() noexcept {}
+    /**
+     * @brief Terminates the program.
+     */
+    void unhandled_exception() noexcept { std::terminate(); }
+    /**
+     * @brief Returns the event queue the task runs on.
+     */
+    event_queue_t* queue() const noexcept { return m_queue; }
+
+  private:
+    friend class task;
+    event_queue_t* m_queue = nullptr;
+    detail::resume_event m_start;
+  };
+
+  /**
+   * @brief The handle of a task, passed to awaiters.
+   */
+  using handle_type = std::coroutine_handle<promise_type>;
+
+  /**
+   * @brief Move constructor.
+   */
+  task(task&& other) noexcept
+      : m_handle{std::exchange(other.m_handle, nullptr)} {}
+  /**
+   * @brief Destroys a task that was never started.
+   */
+  ~task() {
+    if (m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  /**
+   * @brief Disallow copy constructor.
+   */
+  task(const task&) = delete;
+  /**
+   * @brief Disallow copy assignment operator.
+   */
+  task& operator=(const task&) = delete;
+
+  /**
+   * @brief Runs the task on @p queue.
+   *
+   * The task runs as soon as the thread serving @p queue handles the posted
+   * event. This object is empty afterwards.
+   */
+  void start(event_queue_t* queue) noexcept {
+    promise_type& promise = m_handle.promise();
+    promise.m_queue = queue;
+    promise.m_start.handle = std::exchange(m_handle, nullptr);
+    event_post(queue, &promise.m_start);
+  }
+
+private:
+  explicit task(handle_type handle) noexcept : m_handle{handle} {}
+
+  handle_type m_handle;
+};
+
+/**
+ * @brief Awaiter letting the other events of the queue run first.
+ */
+class yield_awaiter {
+public:
+  /**
+   * @brief Always suspends.
+   */
+  bool await_ready() const noexcept { return false; }
+  /**
+   * @brief Queues the task behind the pending events.
+   */
+  void await_suspend(task::handle_type handle) noexcept {
+    m_event.handle = handle;
+    event_post(handle.promise().queue(), &m_event);
+  }
+  /**
+   * @brief Returns nothing.
+   */
+  void await_resume() const noexcept {}
+
+private:
+  detail::resume_event m_event;
+};
+
+/**
+ * @brief Lets the other events of the queue run, then continues.
+ */
+inline yield_awaiter yield() noexcept { return {}; }
+
+#if IS_USED(MODULE_ZTIMER) || defined(DOXYGEN)
+/**
+ * @brief Awaiter resuming the task after a fixed time.
+ */
+class sleep_awaiter {
+public:
+  /**
+   * @brief Sleeps for @p ticks of @p clock.
+   */
+  sleep_awaiter(ztimer_clock_t* clock, uint32_t ticks) noexcept
+      : m_clock{clock}, m_ticks{ticks}, m_timer{} {}
+  /**
+   * @brief Always suspends.
+   */
+  bool await_ready() const noexcept { return false; }
+  /**
+   * @brief Starts the timer.
+   */
+  void await_suspend(task::handle_type handle) noexcept {
+    m_event.handle = handle;
+    m_queue = handle.promise().queue();
+    m_timer.callback = expired;
+    m_timer.arg = this;
+    ztimer_set(m_clock, &m_timer, m_ticks);
+  }
+  /**
+   * @brief Returns nothing.
+   */
+  void await_resume() const noexcept {}
+
+private:
+  static void expired(void* arg) {
+    auto self = static_cast<sleep_awaiter*>(arg);
+    event_post(self->m_queue, &self->m_event);
+  }
+
+  ztimer_clock_t* m_clock;
+  uint32_t m_ticks;
+  ztimer_t m_timer;
+  event_queue_t* m_queue = nullptr;
+  detail::resume_event m_event;
+};
+
+/**
+ * @brief Suspends the task for @p ticks of @p clock.
+ */
+inline sleep_awaiter sleep_for(ztimer_clock_t* clock, uint32_t ticks) noexcept {
+  return {clock, ticks};
+}
+#endif
+
+#if IS_USED(MODULE_SOCK_ASYNC) || defined(DOXYGEN)
+namespace detail {
+
+/* sets the callback of any kind of sock */
+#if defined(MODULE_SOCK_DTLS)
+inline void set_cb(sock_dtls_t* sock, sock_dtls_cb_t cb, void* arg) {
+  sock_dtls_set_cb(sock, cb, arg);
+}
+#endif
+#if defined(MODULE_SOCK_IP)
+inline void set_cb(sock_ip_t* sock, sock_ip_cb_t cb, void* arg) {
+  sock_ip_set_cb(sock, cb, arg);
+}
+#endif
+#if defined(MODULE_SOCK_TCP)
+inline void set_cb(sock_tcp_t* sock, sock_tcp_cb_t cb, void* arg) {
+  sock_tcp_set_cb(sock, cb, arg);
+}
+inline void set_cb(sock_tcp_queue_t* queue, sock_tcp_queue_cb_t cb,
+                   void* arg) {
+  sock_tcp_queue_set_cb(queue, cb, arg);
+}
+#endif
+#if defined(MODULE_SOCK_UDP)
+inline void set_cb(sock_udp_t* sock, sock_udp_cb_t cb, void* arg) {
+  sock_udp_set_cb(sock, cb, arg);
+}
+#endif
+
+} // namespace detail
+
+/**
+ * @brief Awaiter retrying a sock operation until it no longer returns
+ *        `-EAGAIN`.
+ *
+ * The operation is called with a timeout of 0 right away and each time the
+ * sock reports an event. While the task waits, the sock callback is used by
+ * the awaiter, so it must not be set otherwise.
+ *
+ * @tparam Sock The type of the sock.
+ * @tparam Op   A functor running the operation, returning a `ssize_t`.
+ */
+template <class Sock, class Op>
+class sock_awaiter {
+public:
+  /**
+   * @brief Waits for @p op on @p sock.
+   */
+  sock_awaiter(Sock* sock, Op op) noexcept
+      : m_sock{sock}, m_op{std::move(op)}, m_res{-EAGAIN} {}
+
+#if IS_USED(MODULE_ZTIMER) || defined(DOXYGEN)
+  /**
+   * @brief Gives up after @p ticks of @p clock, returning `-ETIMEDOUT`.
+   */
+  sock_awaiter&& timeout(ztimer_clock_t* clock, uint32_t ticks) && noexcept {
+    m_clock = clock;
+    m_ticks = ticks;
+    return std::move(*this);
+  }
+#endif
+
+  /**
+   * @brief Tries the operation, suspends if it would block.
+   */
+  bool await_ready() {
+    m_res = m_op();
+    return m_res != -EAGAIN;
+  }
+  /**
+   * @brief Waits for events of the sock.
+   */
+  void await_suspend(task::handle_type handle) noexcept {
+    /* set here, the awaiter may have been moved since its construction */
+    m_event.handler = retry;
+    m_event.self = this;
+    m_handle = handle;
+    m_queue = handle.promise().queue();
+    detail::set_cb(m_sock, wake, this);
+    /* data that arrived before the callback was set does not call it */
+    event_post(m_queue, &m_event);
+#if IS_USED(MODULE_ZTIMER)
+    if (m_clock) {
+      m_timer.callback = expired;
+      m_timer.arg = this;
+      ztimer_set(m_clock, &m_timer, m_ticks);
+    }
+#endif
+  }
+  /**
+   * @brief Returns the result of the operation.
+   */
+  ssize_t await_resume() const noexcept { return m_res; }
+
+private:
+  struct event : event_t {
+    sock_awaiter* self;
+  };
+
+  static void wake(Sock*, sock_async_flags_t, void* arg) {
+    auto self = static_cast<sock_awaiter*>(arg);
+    event_post(self->m_queue, &self->m_event);
+  }
+
+  static void retry(event_t* ev) {
+    sock_awaiter* self = static_cast<event*>(ev)->self;
+    self->m_res = self->m_op();
+    if (self->m_res == -EAGAIN) {
+      if (!self->m_timed_out) {
+        return;
+      }
+      self->m_res = -ETIMEDOUT;
+    }
+#if IS_USED(MODULE_ZTIMER)
+    if (self->m_clock) {
+      ztimer_remove(self->m_clock, &self->m_timer);
+    }
+#endif
+    detail::set_cb(self->m_sock, nullptr, nullptr);
+    event_cancel(self->m_queue, &self->m_event);
+    self->m_handle.resume();
+  }
+
+#if IS_USED(MODULE_ZTIMER)
+  static void expired(void* arg) {
+    auto self = static_cast<sock_awaiter*>(arg);
+    self->m_timed_out = true;
+    event_post(self->m_queue, &self->m_event);
+  }
+
+  ztimer_clock_t* m_clock = nullptr;
+  uint32_t m_ticks = 0;
+  ztimer_t m_timer = {};
+#endif
+  Sock* m_sock;
+  Op m_op;
+  ssize_t m_res;
+  bool m_timed_out = false;
+  event m_event = {};
+  event_queue_t* m_queue = nullptr;
+  std::coroutine_handle<> m_handle;
+};
+
+#if defined(MODULE_SOCK_UDP) || defined(DOXYGEN)
+/**
+ * @brief Awaits a datagram, see sock_udp_recv().
+ */
+inline auto async_recv(sock_udp_t* sock, void* data, size_t max_len,
+                       sock_udp_ep_t* remote = nullptr) noexcept {
+  auto op = [=]() -> ssize_t {
+    return sock_udp_recv(sock, data, max_len, 0, remote);
+  };
+  return sock_awaiter<sock_udp_t, decltype(op)>{sock, op};
+}
+#endif
+
+#if defined(MODULE_SOCK_IP) || defined(DOXYGEN)
+/**
+ * @brief Awaits an IP packet, see sock_ip_recv().
+ */
+inline auto async_recv(sock_ip_t* sock, void* data, size_t max_len,
+                       sock_ip_ep_t* remote = nullptr) noexcept {
+  auto op = [=]() -> ssize_t {
+    return sock_ip_recv(sock, data, max_len, 0, remote);
+  };
+  return sock_awaiter<sock_ip_t, decltype(op)>{sock, op};
+}
+#endif
+
+#if defined(MODULE_SOCK_DTLS) || defined(DOXYGEN)
+/**
+ * @brief Awaits a DTLS record, see sock_dtls_recv().
+ */
+inline auto async_recv(sock_dtls_t* sock, sock_dtls_session_t* session,
+                       void* data, size_t max_len) noexcept {
+  auto op = [=]() -> ssize_t {
+    return sock_dtls_recv(sock, session, data, max_len, 0);
+  };
+  return sock_awaiter<sock_dtls_t, decltype(op)>{sock, op};
+}
+#endif
+
+#if defined(MODULE_SOCK_TCP) || defined(DOXYGEN)
+/**
+ * @brief Awaits data on a TCP connection, see sock_tcp_read().
+ */
+inline auto async_read(sock_tcp_t* sock, void* data, size_t max_len) noexcept {
+  auto op = [=]() -> ssize_t { return sock_tcp_read(sock, data, max_len, 0); };
+  return sock_awaiter<sock_tcp_t, decltype(op)>{sock, op};
+}
+
+/**
+ * @brief Awaits an incoming TCP connection, see sock_tcp_accept().
+ */
+inline auto async_accept(sock_tcp_queue_t* queue, sock_tcp_t** sock) noexcept {
+  auto op = [=]() -> ssize_t { return sock_tcp_accept(queue, sock, 0); };
+  return sock_awaiter<sock_tcp_queue_t, decltype(op)>{queue, op};
+}
+#endif
+#endif
+
+} // namespace riot
@@ -24,6 +24,7 @@
 #ifndef RIOT_THREAD_HPP
 #define RIOT_THREAD_HPP
 
+#include "irq.h"
 #include "time.h"
 #include "thread.h"
 
@@ -31,10 +32,14 @@
 #include <tuple>
 #include <atomic>
 #include <memory>
+#include <new>
+#include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <exception>
 #include <stdexcept>
 #include <functional>
+#include <system_error>
 #include <type_traits>
 
 #include "riot/mutex.hpp"
@@ -43,19 +48,53 @@
 
 #include "riot/detail/thread_util.hpp"
 
+/**
+ * @defgroup cpp11-compat_conf C++11 wrapper configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief Number of stacks in the pool used by @ref riot::thread
+ *
+ * A @ref riot::thread takes its stack of `THREAD_STACKSIZE_MAIN` bytes from a
+ * statically allocated pool of this many stacks. Only if all of them are in
+ * use, or if the pool is disabled by setting this to 0, the stack is allocated
+ * from the heap.
+ */
+#ifndef CONFIG_CPP11_COMPAT_THREAD_STACK_POOL_NUMOF
+#define CONFIG_CPP11_COMPAT_THREAD_STACK_POOL_NUMOF 0
+#endif
+/** @} */
+
 namespace riot {
 
 /**
  * @brief Holds context data for the thread.
  */
 struct thread_data {
-  thread_data() : ref_count{2}, joining_thread{KERNEL_PID_UNDEF} {
+  /**
+   * @brief Create the context data of a thread running on @p stack_buf.
+   * @param[in] stack_buf   Stack of the thread.
+   * @param[in] size        Size of @p stack_buf in bytes.
+   * @param[in] release_cb  Called when the context data is no longer used.
+   */
+  thread_data(char* stack_buf, std::size_t size,
+              void (*release_cb)(thread_data*)) noexcept
+    : ref_count{1},
+      joining_thread{KERNEL_PID_UNDEF},
+      finished{false},
+      stack{stack_buf},
+      stack_size{size},
+      release{release_cb} {
     // nop
   }
   /** @cond INTERNAL */
   std::atomic<unsigned> ref_count;
   kernel_pid_t joining_thread;
-  std::array<char, THREAD_STACKSIZE_MAIN> stack;
+  bool finished;
+  char* stack;
+  std::size_t stack_size;
+  void (*release)(thread_data*);
   /** @endcond */
 };
 
@@ -70,11 +109,102 @@ struct thread_data_deleter {
    */
   void operator()(thread_data* ptr) {
     if (--ptr->ref_count == 0) {
-      delete ptr;
+      ptr->release(ptr);
     }
   }
 };
 
+/**
+ * @brief A fixed number of statically allocated thread stacks.
+ *
+ * Threads running on a stack of the pool neither allocate memory from the
+ * heap nor fragment it. A stack returns to the pool when the thread finished
+ * and its thread object was joined, detached or destroyed.
+ *
+ * @tparam StackSize  Size of each stack in bytes. The function run by the
+ *                    thread and its arguments are stored on the stack, too.
+ * @tparam Numof      Number of stacks.
+ */
+template <std::size_t StackSize, unsigned Numof>
+class thread_stack_pool {
+  static_assert(Numof > 0, "A thread stack pool needs at least one stack.");
+
+public:
+  /**
+   * @brief Creates a pool with all stacks unused.
+   */
+  constexpr thread_stack_pool() noexcept : m_slots{} {}
+
+  /**
+   * @brief Disallow copy constructor.
+   */
+  thread_stack_pool(const thread_stack_pool&) = delete;
+  /**
+   * @brief Disallow copy assignment operator.
+   */
+  thread_stack_pool& operator=(const thread_stack_pool&) = delete;
+
+  /**
+   * @brief Takes an unused stack from the pool.
+   * @return  The context data of a thread running on the stack, or `nullptr`
+   *          if all stacks are in use.
+   */
+  thread_data* acquire() noexcept {
+    unsigned state = irq_disable();
+    for (auto& s : m_slots) {
+      if (!s.in_use) {
+        s.in_use = true;
+        irq_restore(state);
+        return new (s.data) thread_data(s.stack, StackSize, &release);
+      }
+    }
+    irq_restore(state);
+    return nullptr;
+  }
+
+  /**
+   * @brief Returns the number of unused stacks.
+   */
+  unsigned available() const noexcept {
+    unsigned numof = 0;
+    for (auto& s : m_slots) {
+      numof += s.in_use ? 0 : 1;
+    }
+    return numof;
+  }
+
+private:
+  struct slot {
+    alignas(thread_data) unsigned char data[sizeof(thread_data)];
+    bool in_use;
+    alignas(std::max_align_t) char stack[StackSize];
+  };
+
+  // May be called with IRQs disabled by the thread running on the stack
+  static void release(thread_data* data) noexcept {
+    data->~thread_data();
+    reinterpret_cast<slot*>(data)->in_use = false;
+  }
+
+  slot m_slots[Numof];
+};
+
+namespace detail {
+
+/**
+ * @brief Takes a stack for a @ref riot::thread from the pool configured with
+ *        @ref CONFIG_CPP11_COMPAT_THREAD_STACK_POOL_NUMOF or from the heap.
+ */
+thread_data* make_thread_data();
+
+/**
+ * @brief Wakes up the joining thread, releases the reference of the thread
+ *        to @p data and terminates the calling thread.
+ */
+[[noreturn]] void thread_exit(thread_data* data) noexcept;
+
+} // namespace detail
+
 /**
  * @brief implementation of thread::id
  * @see   <a href="http://en.cppreference.com/w/cpp/thread/thread/id">
@@ -231,7 +361,9 @@ public:
    * @param[in] f     Functor to run as a thread.
    * @param[in] args  Arguments passed to the functor.
    */
-  template <class F, class... Args>
+  template <class F, class... Args,
+            class = typename std::enable_if<!std::is_base_of
+              <thread, typename std::decay<F>::type>::value>::type>
   explicit thread(F&& f, Args&&... args);
 
   /**
@@ -302,6 +434,20 @@ public:
    */
   static unsigned hardware_concurrency() noexcept;
 
+protected:
+  /**
+   * @brief Start the thread on the stack described by @p data.
+   * @param[in] data      Context data of the thread from
+   *                      thread_stack_pool::acquire(), the thread object takes
+   *                      ownership of it. If it is `nullptr`, an exception is
+   *                      thrown.
+   * @param[in] priority  Priority of the thread.
+   * @param[in] f         Functor to run as a thread.
+   * @param[in] args      Arguments passed to the functor.
+   */
+  template <class F, class... Args>
+  void start(thread_data* data, uint8_t priority, F&& f, Args&&... args);
+
 private:
   kernel_pid_t m_handle;
   std::unique_ptr<thread_data, thread_data_deleter> m_data;
@@ -314,44 +460,126 @@ private:
  */
 void swap(thread& lhs, thread& rhs) noexcept;
 
+/**
+ * @brief   Thread running on a stack from a static pool.
+ *
+ * All pooled threads with the same template arguments share a statically
+ * allocated pool of stacks, so spawning and joining them repeatedly does not
+ * use the heap. If all stacks of the pool are in use, creating the thread
+ * fails with a `std::system_error`.
+ *
+ * A pooled thread can be moved into a @ref thread.
+ *
+ * @tparam StackSize  Size of the stack in bytes, see @ref thread_stack_pool.
+ * @tparam Priority   Priority of the thread.
+ * @tparam Numof      Number of stacks in the pool.
+ */
+template <std::size_t StackSize = THREAD_STACKSIZE_MAIN,
+          uint8_t Priority = THREAD_PRIORITY_MAIN - 1,
+          unsigned Numof = 1>
+class pooled_thread : public thread {
+public:
+  /**
+   * @brief The type of the pool of stacks.
+   */
+  using pool_type = thread_stack_pool<StackSize, Numof>;
+
+  /**
+   * @brief Per default, an uninitialized thread is created.
+   */
+  pooled_thread() noexcept = default;
+  /**
+   * @brief Create a thread from a functor and arguments for it.
+   * @param[in] f     Functor to run as a thread.
+   * @param[in] args  Arguments passed to the functor.
+   */
+  template <class F, class... Args,
+            class = typename std::enable_if<!std::is_base_of
+              <thread, typename std::decay<F>::type>::value>::type>
+  explicit pooled_thread(F&& f, Args&&... args) {
+    start(s_pool.acquire(), Priority, std::forward<F>(f),
+          std::forward<Args>(args)...);
+  }
+  /**
+   * @brief Move constructor.
+   */
+  pooled_thread(pooled_thread&&) noexcept = default;
+  /**
+   * @brief Move assignment operator.
+   */
+  pooled_thread& operator=(pooled_thread&&) noexcept = default;
+
+  /**
+   * @brief Access the pool of stacks shared by all pooled threads of this
+   *        type.
+   */
+  static const pool_type& pool() noexcept { return s_pool; }
+
+private:
+  static pool_type s_pool;
+};
+
+template <std::size_t StackSize, uint8_t Priority, unsigned Numof>
+typename pooled_thread<StackSize, Priority, Numof>::pool_type
+  pooled_thread<StackSize, Priority, Numof>::s_pool;
+
 /** @cond INTERNAL */
 template <class Tuple>
 void* thread_proxy(void* vp) {
-  { // without this scope, the objects here are not cleaned up correctly
-    std::unique_ptr<Tuple> p(static_cast<Tuple*>(vp));
-    auto tmp = std::get<0>(*p);
-    std::unique_ptr<thread_data, thread_data_deleter> data{tmp};
-    // create indices for the arguments, 0 is thread_data and 1 is the function
-    auto indices = detail::get_indices<std::tuple_size<Tuple>::value, 2>();
-    try {
-      detail::apply_args(std::get<1>(*p), indices, *p);
-    }
-    catch (...) {
-      // nop
-    }
-    if (data->joining_thread != KERNEL_PID_UNDEF) {
-      thread_wakeup(data->joining_thread);
-    }
+  auto p = static_cast<Tuple*>(vp);
+  auto data = std::get<0>(*p);
+  // create indices for the arguments, 0 is thread_data and 1 is the function
+  auto indices = detail::get_indices<std::tuple_size<Tuple>::value, 2>();
+  try {
+    detail::apply_args(std::get<1>(*p), indices, *p);
   }
-  // some riot cleanup code
-  sched_task_exit();
-  return nullptr;
+  catch (...) {
+    // nop
+  }
+  p->~Tuple();
+  detail::thread_exit(data);
 }
 /** @endcond */
 
+template <class F, class... Args, class>
+thread::thread(F&& f, Args&&... args) : m_handle{KERNEL_PID_UNDEF} {
+  start(detail::make_thread_data(), THREAD_PRIORITY_MAIN - 1,
+        std::forward<F>(f), std::forward<Args>(args)...);
+}
+
 template <class F, class... Args>
-thread::thread(F&& f, Args&&... args) : m_data{new thread_data} {
+void thread::start(thread_data* data, uint8_t priority, F&& f,
+                   Args&&... args) {
   using namespace std;
   using func_and_args = tuple
     <thread_data*, typename decay<F>::type, typename decay<Args>::type...>;
-  unique_ptr<func_and_args> p(
-    new func_and_args(m_data.get(), std::forward<F>(f), std::forward<Args>(args)...));
+  if (data == nullptr) {
+    throw std::system_error(
+      std::make_error_code(std::errc::resource_unavailable_try_again),
+        "No thread stack available.");
+  }
+  m_data.reset(data);
+  // the functor and its arguments are stored at the end of the stack the
+  // thread grows towards, which saves allocating them
+  void* buf = data->stack;
+  size_t size = data->stack_size;
+  if (!align(alignof(func_and_args), sizeof(func_and_args), buf, size)) {
+    throw std::system_error(
+      std::make_error_code(std::errc::not_enough_memory),
+        "Thread stack too small.");
+  }
+  auto p = new (buf) func_and_args(data, std::forward<F>(f),
+                                   std::forward<Args>(args)...);
+  // reference held by the thread
+  ++data->ref_count;
   m_handle = thread_create(
-    m_data->stack.data(), m_data->stack.size(), THREAD_PRIORITY_MAIN - 1, 0,
-    &thread_proxy<func_and_args>, p.get(), "riot_cpp_thread");
-  if (m_handle >= 0) {
-    p.release();
-  } else {
+    static_cast<char*>(buf) + sizeof(func_and_args),
+    size - sizeof(func_and_args), priority, 0,
+    &thread_proxy<func_and_args>, p, "riot_cpp_thread");
+  if (m_handle < 0) {
+    m_handle = KERNEL_PID_UNDEF;
+    --data->ref_count;
+    p->~func_and_args();
     throw std::system_error(
       std::make_error_code(std::errc::resource_unavailable_try_again),
         "Failed to create thread.");
@@ -0,0 +1,319 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup cpp11-compat
+ * @{
+ *
+ * @file
+ * @brief   Fixed size pool of worker threads running short tasks
+ *
+ * @}
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "riot/mutex.hpp"
+#include "riot/thread.hpp"
+#include "riot/condition_variable.hpp"
+
+/**
+ * @ingroup cpp11-compat_conf
+ * @{
+ */
+/**
+ * @brief Maximum size of a task posted to a @ref riot::thread_pool in bytes
+ *
+ * Tasks are stored in the work queue by value, so functors capturing more
+ * than this fail to compile.
+ */
+#ifndef CONFIG_CPP11_COMPAT_THREAD_POOL_TASK_SIZE
+#define CONFIG_CPP11_COMPAT_THREAD_POOL_TASK_SIZE (4 * sizeof(void*))
+#endif
+/** @} */
+
+namespace riot {
+
+namespace detail {
+
+/**
+ * @brief A functor taking no arguments, stored in place without allocation.
+ */
+template <std::size_t Size>
+class task {
+public:
+  /**
+   * @brief Creates an empty task.
+   */
+  task() noexcept : m_ops{nullptr} {}
+  ~task() { reset(); }
+
+  /**
+   * @brief Disallow copy constructor.
+   */
+  task(const task&) = delete;
+  /**
+   * @brief Disallow copy assignment operator.
+   */
+  task& operator=(const task&) = delete;
+
+  /**
+   * @brief Stores the functor @p f in the empty task.
+   */
+  template <class F>
+  void assign(F&& f) {
+    using T = typename std::decay<F>::type;
+    static_assert(sizeof(T) <= Size,
+                  "Task too large, see CONFIG_CPP11_COMPAT_THREAD_POOL_TASK_SIZE.");
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "Task alignment not supported.");
+    new (m_buf) T(std::forward<F>(f));
+    m_ops = ops_for<T>();
+  }
+
+  /**
+   * @brief Moves the functor of @p other into the empty task, leaving
+   *        @p other empty.
+   */
+  void take(task& other) noexcept {
+    m_ops = other.m_ops;
+    if (m_ops) {
+      m_ops->relocate(m_buf, other.m_buf);
+      other.m_ops = nullptr;
+    }
+  }
+
+  /**
+   * @brief Runs the functor.
+   */
+  void operator()() { m_ops->invoke(m_buf); }
+
+  /**
+   * @brief Destroys the functor, leaving the task empty.
+   */
+  void reset() noexcept {
+    if (m_ops) {
+      m_ops->destroy(m_buf);
+      m_ops = nullptr;
+    }
+  }
+
+private:
+  struct ops {
+    void (*invoke)(void*);
+    void (*relocate)(void*, void*);
+    void (*destroy)(void*);
+  };
+
+  template <class T>
+  static void invoke(void* f) {
+    (*static_cast<T*>(f))();
+  }
+
+  template <class T>
+  static void relocate(void* dst, void* src) {
+    T* f = static_cast<T*>(src);
+    new (dst) T(std::move(*f));
+    f->~T();
+  }
+
+  template <class T>
+  static void destroy(void* f) {
+    static_cast<T*>(f)->~T();
+  }
+
+  template <class T>
+  static const ops* ops_for() noexcept {
+    static const ops table = {&invoke<T>, &relocate<T>, &destroy<T>};
+    return &table;
+  }
+
+  const ops* m_ops;
+  alignas(std::max_align_t) unsigned char m_buf[Size];
+};
+
+} // namespace detail
+
+/**
+ * @brief   A fixed number of worker threads running tasks from a work queue.
+ *
+ * The workers are started by the constructor and run until the pool is
+ * destroyed. Their stacks are part of the pool object, tasks are stored in
+ * the queue by value. Neither posting nor running a task allocates memory,
+ * which makes the pool suitable for short, frequent jobs that would otherwise
+ * spawn a thread each.
+ *
+ * Tasks are functors taking no arguments. Exceptions thrown by a task are
+ * ignored.
+ *
+ * @note    As the stacks of the workers are part of the pool, a pool is
+ *          usually allocated statically rather than on the stack of a thread.
+ *
+ * @tparam Workers    Number of worker threads.
+ * @tparam QueueSize  Number of tasks that can wait in the queue.
+ * @tparam StackSize  Size of the stack of each worker in bytes.
+ * @tparam Priority   Priority of the worker threads.
+ */
+template <unsigned Workers = 1, unsigned QueueSize = 8,
+          std::size_t StackSize = THREAD_STACKSIZE_MAIN,
+          uint8_t Priority = THREAD_PRIORITY_MAIN - 1>
+class thread_pool {
+  static_assert(Workers > 0, "A thread pool needs at least one worker.");
+  static_assert(QueueSize > 0, "A thread pool needs a queue.");
+
+public:
+  /**
+   * @brief Creates the pool and starts its workers.
+   */
+  thread_pool() : m_head{0}, m_count{0}, m_busy{0}, m_stopping{false} {
+    try {
+      for (auto& w : m_workers) {
+        w = worker(m_stacks.acquire(), this);
+      }
+    }
+    catch (...) {
+      stop();
+      throw;
+    }
+  }
+
+  /**
+   * @brief Runs all queued tasks and stops the workers.
+   * @warning Must not be called from a task of the pool.
+   */
+  ~thread_pool() { stop(); }
+
+  /**
+   * @brief Disallow copy constructor.
+   */
+  thread_pool(const thread_pool&) = delete;
+  /**
+   * @brief Disallow copy assignment operator.
+   */
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  /**
+   * @brief Queue a task, blocking while the queue is full.
+   * @param[in] f   Functor to run by a worker.
+   */
+  template <class F>
+  void post(F&& f) {
+    unique_lock<mutex> lk(m_mtx);
+    m_not_full.wait(lk, [this] { return m_count < QueueSize; });
+    push(std::forward<F>(f));
+  }
+
+  /**
+   * @brief Queue a task if the queue is not full.
+   * @param[in] f   Functor to run by a worker.
+   * @return  `true` if the task was queued, `false` if the queue is full.
+   */
+  template <class F>
+  bool try_post(F&& f) {
+    lock_guard<mutex> lk(m_mtx);
+    if (m_count == QueueSize) {
+      return false;
+    }
+    push(std::forward<F>(f));
+    return true;
+  }
+
+  /**
+   * @brief Block until the queue is empty and no task is running.
+   */
+  void wait() {
+    unique_lock<mutex> lk(m_mtx);
+    m_idle.wait(lk, [this] { return m_count == 0 && m_busy == 0; });
+  }
+
+  /**
+   * @brief Returns the number of tasks waiting in the queue.
+   */
+  unsigned pending() {
+    lock_guard<mutex> lk(m_mtx);
+    return m_count;
+  }
+
+private:
+  using task_type = detail::task<CONFIG_CPP11_COMPAT_THREAD_POOL_TASK_SIZE>;
+
+  class worker : public thread {
+  public:
+    worker() noexcept = default;
+    worker(thread_data* data, thread_pool* pool) {
+      start(data, Priority, [pool] { pool->work(); });
+    }
+  };
+
+  // called with m_mtx locked
+  template <class F>
+  void push(F&& f) {
+    m_queue[(m_head + m_count) % QueueSize].assign(std::forward<F>(f));
+    ++m_count;
+    m_not_empty.notify_one();
+  }
+
+  void work() {
+    task_type t;
+    unique_lock<mutex> lk(m_mtx);
+    for (;;) {
+      m_not_empty.wait(lk, [this] { return m_count > 0 || m_stopping; });
+      if (m_count == 0) {
+        return;
+      }
+      t.take(m_queue[m_head]);
+      m_head = (m_head + 1) % QueueSize;
+      --m_count;
+      ++m_busy;
+      m_not_full.notify_one();
+      lk.unlock();
+      try {
+        t();
+      }
+      catch (...) {
+        // nop
+      }
+      t.reset();
+      lk.lock();
+      if (--m_busy == 0 && m_count == 0) {
+        m_idle.notify_all();
+      }
+    }
+  }
+
+  void stop() {
+    {
+      lock_guard<mutex> lk(m_mtx);
+      m_stopping = true;
+      m_not_empty.notify_all();
+    }
+    for (auto& w : m_workers) {
+      if (w.joinable()) {
+        w.join();
+      }
+    }
+  }
+
+  // declared first, so the stacks outlive the workers running on them
+  thread_stack_pool<StackSize, Workers> m_stacks;
+  mutex m_mtx;
+  condition_variable m_not_empty;
+  condition_variable m_not_full;
+  condition_variable m_idle;
+  task_type m_queue[QueueSize];
+  unsigned m_head;
+  unsigned m_count;
+  unsigned m_busy;
+  bool m_stopping;
+  worker m_workers[Workers];
+};
+
+} // namespace riot
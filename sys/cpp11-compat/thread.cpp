@@ -20,6 +20,8 @@
 #include <cerrno>
 #include <system_error>
 
+#include "irq.h"
+#include "sched.h"
 #include "ztimer64.h"
 #include "riot/thread.hpp"
 
@@ -27,6 +29,57 @@ using namespace std;
 
 namespace riot {
 
+namespace {
+
+struct heap_thread_data {
+  heap_thread_data() : data{stack.data(), stack.size(), &release} {}
+  thread_data data;
+  std::array<char, THREAD_STACKSIZE_MAIN> stack;
+
+  static void release(thread_data* ptr) {
+    delete reinterpret_cast<heap_thread_data*>(ptr);
+  }
+};
+
+#if CONFIG_CPP11_COMPAT_THREAD_STACK_POOL_NUMOF > 0
+thread_stack_pool<THREAD_STACKSIZE_MAIN,
+                  CONFIG_CPP11_COMPAT_THREAD_STACK_POOL_NUMOF> stack_pool;
+#endif
+
+} // namespace
+
+namespace detail {
+
+thread_data* make_thread_data() {
+#if CONFIG_CPP11_COMPAT_THREAD_STACK_POOL_NUMOF > 0
+  auto data = stack_pool.acquire();
+  if (data) {
+    return data;
+  }
+#endif
+  return &(new heap_thread_data)->data;
+}
+
+void thread_exit(thread_data* data) noexcept {
+  unsigned state = irq_disable();
+  data->finished = true;
+  thread_t* joining = thread_get(data->joining_thread);
+  if (joining && joining->status == STATUS_SLEEPING) {
+    sched_set_status(joining, STATUS_PENDING);
+  }
+  if (data->release == &heap_thread_data::release) {
+    // the heap can't be used with IRQs disabled, so the stack may be freed
+    // while the thread still runs on it
+    irq_restore(state);
+  }
+  // otherwise IRQs stay disabled, so a stack released to its pool is not
+  // handed out again before the thread is gone
+  thread_data_deleter{}(data);
+  sched_task_exit();
+}
+
+} // namespace detail
+
 thread::~thread() {
   if (joinable()) {
     terminate();
@@ -39,12 +92,18 @@ void thread::join() {
                        "Joining this leads to a deadlock.");
   }
   if (joinable()) {
-    auto status = thread_getstatus(m_handle);
-    if (status != STATUS_NOT_FOUND && status != STATUS_STOPPED) {
+    // the thread wakes us up when it finishes, but only if it didn't already
+    unsigned state = irq_disable();
+    while (!m_data->finished) {
       m_data->joining_thread = thread_getpid();
-      thread_sleep();
+      sched_set_status(thread_get_active(), STATUS_SLEEPING);
+      irq_restore(state);
+      thread_yield_higher();
+      state = irq_disable();
     }
+    irq_restore(state);
     m_handle = KERNEL_PID_UNDEF;
+    m_data.reset();
   } else {
     throw system_error(make_error_code(errc::invalid_argument),
                        "Can not join an unjoinable thread.");
@@ -55,6 +114,7 @@ void thread::join() {
 void thread::detach() {
   if (joinable()) {
     m_handle = KERNEL_PID_UNDEF;
+    m_data.reset();
   } else {
     throw system_error(make_error_code(errc::invalid_argument),
                        "Can not detach an unjoinable thread.");
@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Stackless coroutine implementation
+ *
+ * @}
+ */
+
+#include "container.h"
+#include "event/coro.h"
+
+static void _resume(event_t *event)
+{
+    event_coro_t *coro = container_of(event, event_coro_t, super);
+
+    if (coro->fn(coro) == EVENT_CORO_WAITING) {
+        return;
+    }
+    /* drop wake-ups that came in while the coroutine was running, so the
+     * done callback may free it */
+    event_cancel(coro->queue, &coro->super);
+    if (coro->done) {
+        coro->done(coro);
+    }
+}
+
+void event_coro_init(event_coro_t *coro, event_queue_t *queue,
+                     event_coro_fn_t fn)
+{
+    coro->super.handler = _resume;
+    coro->super.list_node.next = NULL;
+    coro->queue = queue;
+    coro->fn = fn;
+    coro->done = NULL;
+    coro->resume = 0;
+#if IS_USED(MODULE_ZTIMER)
+    coro->clock = NULL;
+    coro->timed_out = false;
+#endif
+}
+
+#if IS_USED(MODULE_ZTIMER)
+static void _timeout(void *arg)
+{
+    event_coro_t *coro = arg;
+
+    coro->timed_out = true;
+    event_coro_wake(coro);
+}
+
+void event_coro_timeout_set(event_coro_t *coro, ztimer_clock_t *clock,
+                            uint32_t timeout)
+{
+    coro->timed_out = false;
+    coro->clock = clock;
+    coro->timer.callback = _timeout;
+    coro->timer.arg = coro;
+    ztimer_set(clock, &coro->timer, timeout);
+}
+
+void event_coro_timeout_clear(event_coro_t *coro)
+{
+    if (coro->clock) {
+        ztimer_remove(coro->clock, &coro->timer);
+        coro->clock = NULL;
+    }
+}
+#endif
@@ -25,6 +25,7 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include "bitarithm.h"
 #include "event.h"
 #include "clist.h"
 #include "mutex.h"
@@ -34,6 +35,62 @@
 #include "xtimer.h"
 #endif
 
+/* The helpers below keep the bitmap of non-empty queues and the queue
+ * statistics up to date, they must be called with interrupts disabled. */
+static inline void _queued(event_queue_t *queue, unsigned numof)
+{
+#if IS_USED(MODULE_EVENT_LOOP_BATCH)
+    if (queue->pending && numof) {
+        *queue->pending |= 1U << queue->index;
+    }
+#endif
+#if IS_USED(MODULE_EVENT_QUEUE_STATS)
+    queue->stats.depth += numof;
+    if (queue->stats.depth > queue->stats.depth_max) {
+        queue->stats.depth_max = queue->stats.depth;
+    }
+#endif
+    (void)queue;
+    (void)numof;
+}
+
+static inline void _dequeued(event_queue_t *queue, unsigned numof)
+{
+#if IS_USED(MODULE_EVENT_LOOP_BATCH)
+    if (queue->pending && clist_is_empty(&queue->event_list)) {
+        *queue->pending &= ~(1U << queue->index);
+    }
+#endif
+#if IS_USED(MODULE_EVENT_QUEUE_STATS)
+    queue->stats.depth -= numof;
+#endif
+    (void)queue;
+    (void)numof;
+}
+
+/* must be called with interrupts disabled */
+static event_queue_t *_first_pending(event_queue_t *queues, size_t n_queues)
+{
+#if IS_USED(MODULE_EVENT_LOOP_BATCH)
+    /* the bitmap is only usable if the queues were initialized together */
+    if (queues[0].pending && (queues[0].index == 0) &&
+        (queues[n_queues - 1].pending == queues[0].pending)) {
+        unsigned pending = *queues[0].pending;
+        if (n_queues < EVENT_QUEUES_BITMAP_NUMOF) {
+            pending &= (1U << n_queues) - 1;
+        }
+        return pending ? &queues[bitarithm_lsb(pending)] : NULL;
+    }
+#endif
+    for (size_t i = 0; i < n_queues; i++) {
+        assert(queues[i].waiter);
+        if (!clist_is_empty(&queues[i].event_list)) {
+            return &queues[i];
+        }
+    }
+    return NULL;
+}
+
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && event);
@@ -42,6 +99,11 @@ void event_post(event_queue_t *queue, event_t *event)
     unsigned state = irq_disable();
     if (!event->list_node.next) {
         clist_rpush(&queue->event_list, &event->list_node);
+#if IS_USED(MODULE_EVENT_QUEUE_STATS)
+        queue->stats.posted++;
+        event->posted_us = ztimer_now(ZTIMER_USEC);
+#endif
+        _queued(queue, 1);
     }
     thread_t *waiter = queue->waiter;
     irq_restore(state);
@@ -57,7 +119,9 @@ void event_cancel(event_queue_t *queue, event_t *event)
     assert(event);
 
     unsigned state = irq_disable();
-    clist_remove(&queue->event_list, &event->list_node);
+    if (clist_remove(&queue->event_list, &event->list_node)) {
+        _dequeued(queue, 1);
+    }
     event->list_node.next = NULL;
     irq_restore(state);
 }
@@ -77,6 +141,9 @@ event_t *event_get(event_queue_t *queue)
 {
     unsigned state = irq_disable();
     event_t *result = (event_t *) clist_lpop(&queue->event_list);
+    if (result) {
+        _dequeued(queue, 1);
+    }
     irq_restore(state);
 
     if (result) {
@@ -92,16 +159,12 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
 
     while (1) {
         unsigned state = irq_disable();
-        for (size_t i = 0; i < n_queues; i++) {
-            assert(queues[i].waiter);
-            result = container_of(clist_lpop(&queues[i].event_list),
-                                  event_t, list_node);
-            if (result) {
-                break;
-            }
-        }
+        event_queue_t *queue = _first_pending(queues, n_queues);
 
-        if (result != NULL) {
+        if (queue != NULL) {
+            result = container_of(clist_lpop(&queue->event_list),
+                                  event_t, list_node);
+            _dequeued(queue, 1);
             result->list_node.next = NULL;
             irq_restore(state);
             return result;
@@ -112,6 +175,147 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
     }
 }
 
+#if IS_USED(MODULE_EVENT_LOOP_BATCH)
+/* list_node.next of events taken into a batch points here, so they are not
+ * queued again by event_post() while still pending in the batch */
+static clist_node_t _batched;
+
+/* returns true if the event was not cancelled since it was taken into the
+ * batch, the event is then no longer queued */
+static bool _claim(event_t *event)
+{
+    unsigned state = irq_disable();
+    bool claimed = (event->list_node.next == &_batched);
+    if (claimed) {
+        event->list_node.next = NULL;
+    }
+    irq_restore(state);
+    return claimed;
+}
+
+static void _requeue(event_queue_t *queue, event_t **batch, size_t numof)
+{
+    unsigned requeued = 0;
+
+    unsigned state = irq_disable();
+    while (numof--) {
+        if (batch[numof]->list_node.next == &_batched) {
+            clist_lpush(&queue->event_list, &batch[numof]->list_node);
+            requeued++;
+        }
+    }
+    _queued(queue, requeued);
+    irq_restore(state);
+}
+
+static bool _higher_pending(event_queue_t *queues, event_queue_t *queue)
+{
+    /* only a hint, reading without disabling interrupts is fine */
+    if (queue->pending && (queue->pending == queues[0].pending) &&
+        (queues[0].index == 0)) {
+        return *queue->pending & ((1U << queue->index) - 1);
+    }
+    for (event_queue_t *q = queues; q < queue; q++) {
+        if (!clist_is_empty(&q->event_list)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void _dispatch(event_queue_t *queue, event_t *event)
+{
+#if IS_USED(MODULE_EVENT_QUEUE_STATS)
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint32_t latency = start - event->posted_us;
+
+    /* the event may be reused by its handler, don't touch it afterwards */
+    event->handler(event);
+
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+    unsigned state = irq_disable();
+    event_queue_stats_t *stats = &queue->stats;
+    stats->dispatched++;
+    stats->latency_sum_us += latency;
+    if (latency > stats->latency_max_us) {
+        stats->latency_max_us = latency;
+    }
+    stats->handler_sum_us += duration;
+    if (duration > stats->handler_max_us) {
+        stats->handler_max_us = duration;
+    }
+    irq_restore(state);
+#else
+    (void)queue;
+    event->handler(event);
+#endif
+}
+
+void event_loop_batch_multi(event_queue_t *queues, size_t n_queues)
+{
+    assert(queues && n_queues);
+    event_t *batch[CONFIG_EVENT_LOOP_BATCH_SIZE];
+
+#if IS_USED(MODULE_EVENT_QUEUE_STATS)
+    ztimer_acquire(ZTIMER_USEC);
+#endif
+
+    while (1) {
+        event_queue_t *queue;
+        size_t numof = 0;
+
+        unsigned state = irq_disable();
+        while ((queue = _first_pending(queues, n_queues)) == NULL) {
+            irq_restore(state);
+            thread_flags_wait_any(THREAD_FLAG_EVENT);
+            state = irq_disable();
+        }
+        clist_node_t *node;
+        while ((numof < CONFIG_EVENT_LOOP_BATCH_SIZE) &&
+               (node = clist_lpop(&queue->event_list))) {
+            node->next = &_batched;
+            batch[numof++] = container_of(node, event_t, list_node);
+        }
+        _dequeued(queue, numof);
+        irq_restore(state);
+
+        for (size_t i = 0; i < numof; i++) {
+            if ((i > 0) && _higher_pending(queues, queue)) {
+                _requeue(queue, &batch[i], numof - i);
+                break;
+            }
+            if (_claim(batch[i])) {
+                _dispatch(queue, batch[i]);
+            }
+        }
+    }
+}
+#endif
+
+#if IS_USED(MODULE_EVENT_QUEUE_STATS)
+void event_queue_stats_get(const event_queue_t *queue,
+                           event_queue_stats_t *stats)
+{
+    assert(queue && stats);
+
+    unsigned state = irq_disable();
+    *stats = queue->stats;
+    irq_restore(state);
+}
+
+void event_queue_stats_reset(event_queue_t *queue)
+{
+    assert(queue);
+
+    unsigned state = irq_disable();
+    uint16_t depth = queue->stats.depth;
+    memset(&queue->stats, 0, sizeof(queue->stats));
+    queue->stats.depth = depth;
+    queue->stats.depth_max = depth;
+    irq_restore(state);
+}
+#endif
+
 #if IS_USED(MODULE_XTIMER) || IS_USED(MODULE_ZTIMER)
 static event_t *_wait_timeout(event_queue_t *queue)
 {
@@ -0,0 +1,249 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Work-stealing task executor implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+
+#include "event/executor.h"
+#include "irq.h"
+#include "thread.h"
+#include "thread_flags.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static_assert(CONFIG_EVENT_EXECUTOR_DEQUE_SIZE <= UINT8_MAX,
+              "CONFIG_EVENT_EXECUTOR_DEQUE_SIZE must fit into 8 bits");
+
+/* The deques are protected by disabling IRQs, the functions below must be
+ * called with IRQs disabled. */
+
+static void _push(event_executor_worker_t *w, event_task_t *task)
+{
+    unsigned idx = (w->head + w->numof) % CONFIG_EVENT_EXECUTOR_DEQUE_SIZE;
+
+    w->deque[idx] = task;
+    w->numof++;
+}
+
+static event_task_t *_pop_oldest(event_executor_worker_t *w)
+{
+    if (w->numof == 0) {
+        return NULL;
+    }
+    event_task_t *task = w->deque[w->head];
+    w->head = (w->head + 1) % CONFIG_EVENT_EXECUTOR_DEQUE_SIZE;
+    w->numof--;
+    return task;
+}
+
+static event_task_t *_pop_newest(event_executor_worker_t *w)
+{
+    if (w->numof == 0) {
+        return NULL;
+    }
+    w->numof--;
+    return w->deque[(w->head + w->numof) % CONFIG_EVENT_EXECUTOR_DEQUE_SIZE];
+}
+
+static event_task_t *_steal(event_executor_t *ex, event_executor_worker_t *me)
+{
+    event_executor_worker_t *victim = NULL;
+
+    for (unsigned i = 0; i < ex->numof; i++) {
+        event_executor_worker_t *w = &ex->workers[i];
+        if ((w != me) && (w->numof > 0) &&
+            (!victim || (w->numof > victim->numof))) {
+            victim = w;
+        }
+    }
+    if (!victim) {
+        return NULL;
+    }
+    me->stolen++;
+    return _pop_newest(victim);
+}
+
+/* prefers an idle worker, then the one with the fewest queued tasks */
+static event_executor_worker_t *_select(event_executor_t *ex)
+{
+    event_executor_worker_t *best = NULL;
+
+    for (unsigned i = 0; i < ex->numof; i++) {
+        event_executor_worker_t *w = &ex->workers[(ex->next + i) % ex->numof];
+        if (w->idle && (w->numof == 0)) {
+            best = w;
+            break;
+        }
+        if ((w->numof < CONFIG_EVENT_EXECUTOR_DEQUE_SIZE) &&
+            (!best || (w->numof < best->numof))) {
+            best = w;
+        }
+    }
+    if (best) {
+        ex->next = (best - ex->workers + 1) % ex->numof;
+    }
+    return best;
+}
+
+static event_executor_worker_t *_current(event_executor_t *ex)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    for (unsigned i = 0; i < ex->numof; i++) {
+        if (ex->workers[i].pid == pid) {
+            return &ex->workers[i];
+        }
+    }
+    return NULL;
+}
+
+static void *_worker(void *arg)
+{
+    event_executor_worker_t *me = arg;
+    event_executor_t *ex = me->executor;
+
+    /* the worker may run before thread_create() returned */
+    me->pid = thread_getpid();
+
+    while (1) {
+        unsigned state = irq_disable();
+        event_task_t *task = _pop_oldest(me);
+        if (!task) {
+            task = _steal(ex, me);
+        }
+        if (!task) {
+            /* set while IRQs are still disabled, so a task posted from now
+             * on wakes us up */
+            me->idle = true;
+            irq_restore(state);
+            thread_flags_wait_any(THREAD_FLAG_EVENT_EXECUTOR);
+            continue;
+        }
+        me->idle = false;
+        irq_restore(state);
+
+        DEBUG("event_executor: worker %" PRIkernel_pid " runs %p\n",
+              me->pid, (void *)task);
+        task->super.handler(&task->super);
+        me->executed++;
+        /* the task may be reused as soon as it is unlocked, e.g. re-posted
+         * by the done handler, so nothing may touch it afterwards */
+        event_queue_t *done_queue = task->done_queue;
+        event_t *done_event = task->done_event;
+        mutex_unlock(&task->done);
+        if (done_queue) {
+            event_post(done_queue, done_event);
+        }
+    }
+
+    return NULL;
+}
+
+int event_executor_init(event_executor_t *executor,
+                        event_executor_worker_t *workers, unsigned numof,
+                        uint8_t priority)
+{
+    if ((numof == 0) || (numof > UINT8_MAX)) {
+        return -EINVAL;
+    }
+
+    executor->workers = workers;
+    executor->numof = numof;
+    executor->next = 0;
+    for (unsigned i = 0; i < numof; i++) {
+        event_executor_worker_t *w = &workers[i];
+        w->executor = executor;
+        w->head = 0;
+        w->numof = 0;
+        w->idle = true;
+        w->pid = KERNEL_PID_UNDEF;
+        w->executed = 0;
+        w->stolen = 0;
+    }
+
+    for (unsigned i = 0; i < numof; i++) {
+        event_executor_worker_t *w = &workers[i];
+        kernel_pid_t pid = thread_create(w->stack, sizeof(w->stack), priority,
+                                         0, _worker, w, "executor");
+        if (pid < 0) {
+            /* keep using the workers that were started */
+            executor->numof = i;
+            return pid;
+        }
+        w->pid = pid;
+    }
+
+    return 0;
+}
+
+int event_executor_post(event_executor_t *executor, event_task_t *task)
+{
+    assert(task->super.handler);
+
+    mutex_init_locked(&task->done);
+
+    unsigned state = irq_disable();
+    event_executor_worker_t *target = _current(executor);
+    if (!target || (target->numof == CONFIG_EVENT_EXECUTOR_DEQUE_SIZE)) {
+        target = _select(executor);
+    }
+    if (!target) {
+        irq_restore(state);
+        mutex_init(&task->done);
+        return -ENOBUFS;
+    }
+    _push(target, task);
+
+    /* wake up the target, or an idle worker to steal the task */
+    event_executor_worker_t *wake = NULL;
+    if (target->idle) {
+        wake = target;
+    }
+    else {
+        for (unsigned i = 0; i < executor->numof; i++) {
+            if (executor->workers[i].idle) {
+                wake = &executor->workers[i];
+                break;
+            }
+        }
+    }
+    if (wake) {
+        /* so the next task wakes up another idle worker */
+        wake->idle = false;
+    }
+    irq_restore(state);
+
+    if (wake) {
+        thread_flags_set(thread_get(wake->pid), THREAD_FLAG_EVENT_EXECUTOR);
+    }
+    return 0;
+}
+
+bool event_task_done(event_task_t *task)
+{
+    if (!mutex_trylock(&task->done)) {
+        return false;
+    }
+    mutex_unlock(&task->done);
+    return true;
+}
+
+void event_task_wait(event_task_t *task)
+{
+    mutex_lock(&task->done);
+    mutex_unlock(&task->done);
+}
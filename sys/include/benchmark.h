@@ -12,6 +12,24 @@
  * @defgroup    sys_benchmark Benchmark
  * @ingroup     sys
  * @brief       Framework for running simple runtime benchmarks
+ *
+ * @ref BENCHMARK_RUN measures the runtime of a statement in cycles of the
+ * CPU, using the DWT cycle counter on Cortex-M and the time stamp counter
+ * on x86 hosts (i.e. `native`). Other platforms fall back to
+ * microseconds of `ZTIMER_USEC`.
+ *
+ * A benchmark first calibrates the number of runs per sample, so that a
+ * sample takes at least @ref CONFIG_BENCHMARK_SAMPLE_US. After
+ * @ref CONFIG_BENCHMARK_WARMUP samples that are thrown away, it takes
+ * @ref CONFIG_BENCHMARK_SAMPLES samples and prints the minimum, median,
+ * 99th percentile and maximum runtime of a single run as one line of JSON:
+ *
+ *     { "bench" : "mutex lock/unlock", "unit" : "cycles", "runs" : 4096, "samples" : 100, "min" : 48.125, "median" : 48.250, "p99" : 51.500, "max" : 62.000 }
+ *
+ * With @ref CONFIG_BENCHMARK_OUTPUT_CSV, it prints a line of CSV instead.
+ * The output of two versions can be compared with
+ * `dist/tools/benchmark/compare.py`.
+ *
  * @{
  *
  * @file
@@ -20,18 +38,179 @@
  * @author      Hauke Petersen <hauke.petersen@fu-berlin.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "cpu.h"
 #include "irq.h"
+#include "ztimer.h"
 #include "ztimer/stopwatch.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @defgroup sys_benchmark_conf Benchmark configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of samples each benchmark takes
+ */
+#ifndef CONFIG_BENCHMARK_SAMPLES
+#define CONFIG_BENCHMARK_SAMPLES        (100U)
+#endif
+
+/**
+ * @brief   Number of samples thrown away before sampling
+ */
+#ifndef CONFIG_BENCHMARK_WARMUP
+#define CONFIG_BENCHMARK_WARMUP         (3U)
+#endif
+
+/**
+ * @brief   Minimum duration of a sample in microseconds
+ *
+ * The number of runs per sample is increased until a sample takes at least
+ * this long, up to @ref CONFIG_BENCHMARK_RUNS_MAX.
+ */
+#ifndef CONFIG_BENCHMARK_SAMPLE_US
+#define CONFIG_BENCHMARK_SAMPLE_US      (1000U)
+#endif
+
+/**
+ * @brief   Maximum number of runs per sample
+ */
+#ifndef CONFIG_BENCHMARK_RUNS_MAX
+#define CONFIG_BENCHMARK_RUNS_MAX       (1UL << 24)
+#endif
+
+/**
+ * @brief   Print the results as CSV instead of JSON
+ */
+#ifdef DOXYGEN
+#define CONFIG_BENCHMARK_OUTPUT_CSV
+#endif
+/** @} */
+
+#if defined(DOXYGEN)
+/**
+ * @brief   Unit of @ref benchmark_now
+ */
+#define BENCHMARK_UNIT      "cycles"
+#elif defined(__x86_64__) || defined(__i386__)
+#define BENCHMARK_UNIT      "cycles"
+#elif defined(DWT_CTRL_CYCCNTENA_Msk) && defined(CoreDebug_DEMCR_TRCENA_Msk)
+#define BENCHMARK_UNIT      "cycles"
+#define BENCHMARK_DWT       1
+#else
+#define BENCHMARK_UNIT      "us"
+#endif
+
+/**
+ * @brief   Read the counter used for benchmarks
+ *
+ * @return  the current value, in @ref BENCHMARK_UNIT
+ */
+static inline uint32_t benchmark_now(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    uint32_t lo, hi;
+    __asm__ volatile ("rdtsc" : "=a" (lo), "=d" (hi));
+    (void)hi;
+    return lo;
+#elif defined(BENCHMARK_DWT)
+    return DWT->CYCCNT;
+#else
+    return ztimer_now(ZTIMER_USEC);
+#endif
+}
+
+/**
+ * @brief   State of a running benchmark
+ *
+ * Used by @ref BENCHMARK_RUN, only one benchmark can run at a time.
+ */
+typedef struct {
+    const char *name;       /**< name for labeling the output */
+    uint32_t runs;          /**< runs per sample */
+    uint32_t start_us;      /**< start of the current sample */
+    uint16_t done;          /**< samples taken in the current phase */
+    uint8_t phase;          /**< calibration, warm-up or sampling */
+} benchmark_t;
+
+/**
+ * @brief   Measure the runtime of a statement
+ *
+ * Runs @p statement in a loop, see @ref sys_benchmark. The loop is part of
+ * the measured code, its overhead is included in the result.
+ *
+ * @param[in] name      name for labeling the output
+ * @param[in] statement statement to benchmark, may be run millions of times
+ */
+#define BENCHMARK_RUN(name, statement)                                  \
+    do {                                                                \
+        benchmark_t _bench;                                             \
+        benchmark_begin(&_bench, name);                                 \
+        while (benchmark_next(&_bench)) {                               \
+            uint32_t _runs = _bench.runs;                               \
+            uint32_t _start = benchmark_now();                          \
+            for (uint32_t _i = 0; _i < _runs; _i++) {                   \
+                statement;                                              \
+            }                                                           \
+            benchmark_record(&_bench, benchmark_now() - _start);        \
+        }                                                               \
+        benchmark_report(&_bench);                                      \
+    } while (0)
+
+/**
+ * @brief   Start a benchmark
+ *
+ * Used by @ref BENCHMARK_RUN.
+ *
+ * @param[out] bench    benchmark to start
+ * @param[in]  name     name for labeling the output
+ */
+void benchmark_begin(benchmark_t *bench, const char *name);
+
+/**
+ * @brief   Prepare the next sample
+ *
+ * Used by @ref BENCHMARK_RUN.
+ *
+ * @param[in,out] bench the benchmark
+ *
+ * @return  true, if another sample is needed
+ */
+bool benchmark_next(benchmark_t *bench);
+
+/**
+ * @brief   Record a sample
+ *
+ * Used by @ref BENCHMARK_RUN.
+ *
+ * @param[in,out] bench the benchmark
+ * @param[in]     ticks duration of benchmark_t::runs runs, in
+ *                      @ref BENCHMARK_UNIT
+ */
+void benchmark_record(benchmark_t *bench, uint32_t ticks);
+
+/**
+ * @brief   Print the results of a benchmark
+ *
+ * Used by @ref BENCHMARK_RUN.
+ *
+ * @param[in] bench     the finished benchmark
+ */
+void benchmark_report(const benchmark_t *bench);
+
 /**
  * @brief   Measure the runtime of a given function call
  *
+ * Prints the average of @p runs runs in microseconds. Prefer
+ * @ref BENCHMARK_RUN, which reports the distribution of the runtime.
+ *
  * As we are doing a time sensitive measurement here, there is no way around
  * using a preprocessor function, as going with a function pointer or similar
  * would influence the measured runtime...
@@ -119,6 +119,22 @@ extern "C" {
 #define THREAD_FLAG_EVENT   (0x1)
 #endif
 
+/**
+ * @defgroup sys_event_conf Event queue configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Maximum number of events the event loop takes from a queue at once
+ *
+ * Only used with the `event_loop_batch` module, see
+ * @ref event_loop_batch_multi.
+ */
+#ifndef CONFIG_EVENT_LOOP_BATCH_SIZE
+#define CONFIG_EVENT_LOOP_BATCH_SIZE    (8U)
+#endif
+/** @} */
+
 /**
  * @brief   event_queue_t static initializer
  */
@@ -145,16 +161,84 @@ typedef void (*event_handler_t)(event_t *);
 struct event {
     clist_node_t list_node;     /**< event queue list entry             */
     event_handler_t handler;    /**< pointer to event handler function  */
+#if IS_USED(MODULE_EVENT_QUEUE_STATS) || defined(DOXYGEN)
+    uint32_t posted_us;         /**< time the event was queued          */
+#endif
 };
 
+#if IS_USED(MODULE_EVENT_QUEUE_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Statistics of an event queue
+ *
+ * Dispatch latency and handler time are measured by the event loop in
+ * microseconds, the latency of an event covers the time from posting it until
+ * its handler is called.
+ */
+typedef struct {
+    uint32_t posted;            /**< events queued                      */
+    uint32_t dispatched;        /**< events handled by the event loop   */
+    uint16_t depth;             /**< events currently queued            */
+    uint16_t depth_max;         /**< maximum of event_queue_stats_t::depth */
+    uint32_t latency_max_us;    /**< maximum dispatch latency           */
+    uint64_t latency_sum_us;    /**< sum of all dispatch latencies      */
+    uint32_t handler_max_us;    /**< maximum handler execution time     */
+    uint64_t handler_sum_us;    /**< sum of all handler execution times */
+} event_queue_stats_t;
+#endif
+
 /**
  * @brief   event queue structure
  */
 typedef struct PTRTAG {
     clist_node_t event_list;    /**< list of queued events              */
     thread_t *waiter;           /**< thread owning event queue          */
+#if IS_USED(MODULE_EVENT_LOOP_BATCH) || defined(DOXYGEN)
+    /**
+     * @brief   Bitmap of the non-empty queues of the array this queue was
+     *          initialized with, NULL if not available
+     */
+    unsigned *pending;
+    unsigned pending_bits;      /**< the bitmap, kept in the first queue  */
+    uint8_t index;              /**< index of the queue in its array    */
+#endif
+#if IS_USED(MODULE_EVENT_QUEUE_STATS) || defined(DOXYGEN)
+    event_queue_stats_t stats;  /**< statistics of the queue            */
+#endif
 } event_queue_t;
 
+#if IS_USED(MODULE_EVENT_LOOP_BATCH) || defined(DOXYGEN)
+/**
+ * @brief   Maximum number of queues in an array that share a bitmap of
+ *          non-empty queues
+ */
+#define EVENT_QUEUES_BITMAP_NUMOF   (sizeof(unsigned) * 8)
+#endif
+
+/**
+ * @brief   Prepare an array of zeroed event queues (internal)
+ *
+ * @param[out]  queues      event queue objects to prepare
+ * @param[in]   n_queues    number of queues in @p queues
+ */
+static inline void _event_queues_prepare(event_queue_t *queues,
+                                         size_t n_queues)
+{
+#if IS_USED(MODULE_EVENT_LOOP_BATCH)
+    if (n_queues <= EVENT_QUEUES_BITMAP_NUMOF) {
+        for (size_t i = 0; i < n_queues; i++) {
+            queues[i].pending = &queues[0].pending_bits;
+            queues[i].index = i;
+        }
+    }
+#endif
+#if IS_USED(MODULE_EVENT_QUEUE_STATS)
+    /* keeps the clock running, so posting events can timestamp them */
+    ztimer_acquire(ZTIMER_USEC);
+#endif
+    (void)queues;
+    (void)n_queues;
+}
+
 /**
  * @brief   Initialize an array of event queues
  *
@@ -172,6 +256,7 @@ static inline void event_queues_init(event_queue_t *queues,
         memset(&queues[i], '\0', sizeof(queues[0]));
         queues[i].waiter = me;
     }
+    _event_queues_prepare(queues, n_queues);
 }
 
 /**
@@ -199,6 +284,7 @@ static inline void event_queues_init_detached(event_queue_t *queues,
     for (size_t i = 0; i < n_queues; i++) {
         memset(&queues[i], '\0', sizeof(queues[0]));
     }
+    _event_queues_prepare(queues, n_queues);
 }
 
 /**
@@ -353,6 +439,26 @@ static inline event_t *event_wait(event_queue_t *queue)
     return event_wait_multi(queue, 1);
 }
 
+#if IS_USED(MODULE_EVENT_QUEUE_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Get the statistics of an event queue
+ *
+ * @param[in]   queue   event queue to get the statistics of
+ * @param[out]  stats   the statistics
+ */
+void event_queue_stats_get(const event_queue_t *queue,
+                           event_queue_stats_t *stats);
+
+/**
+ * @brief   Reset the statistics of an event queue
+ *
+ * The high-water mark of the queue depth restarts at the current depth.
+ *
+ * @param[in]   queue   event queue to reset the statistics of
+ */
+void event_queue_stats_reset(event_queue_t *queue);
+#endif
+
 #if IS_USED(MODULE_XTIMER) || defined(DOXYGEN)
 /**
  * @brief   Get next event from event queue, blocking until timeout expires
@@ -405,6 +511,37 @@ event_t *event_wait_timeout_ztimer(event_queue_t *queue,
                                    ztimer_clock_t *clock, uint32_t timeout);
 #endif
 
+/**
+ * @brief   Event loop with multiple queues, handling events in batches
+ *
+ * Like @ref event_loop_multi, but each time the calling thread wakes up it
+ * takes up to @ref CONFIG_EVENT_LOOP_BATCH_SIZE events from the queue with
+ * the highest priority in a single critical section. Between two events of a
+ * batch, the loop checks whether a queue of higher priority got an event. If
+ * so, the rest of the batch is put back to the head of its queue and the
+ * higher priority queue is served first.
+ *
+ * Events of a batch still count as queued: posting them again has no effect
+ * and cancelling them keeps their handler from being called. However,
+ * @ref event_is_queued returns false for them.
+ *
+ * If the queues were initialized together, e.g. with
+ * @ref event_queues_init, the queue to serve is selected from a bitmap of
+ * non-empty queues instead of checking every queue.
+ *
+ * @note    Available with the `event_loop_batch` module, which makes
+ *          @ref event_loop_multi and @ref event_loop use this function unless
+ *          `event_loop_debug` is used. With `event_queue_stats`, it also
+ *          accounts dispatch latency and handler time of each queue.
+ *
+ * @pre     The queue must have a waiter (i.e. it should have been claimed, or
+ *          initialized using @ref event_queue_init, @ref event_queues_init)
+ *
+ * @param[in]   queues      Event queues to process
+ * @param[in]   n_queues    Number of queues passed with @p queues
+ */
+void event_loop_batch_multi(event_queue_t *queues, size_t n_queues);
+
 /**
  * @brief   Simple event loop with multiple queues
  *
@@ -429,12 +566,17 @@ event_t *event_wait_timeout_ztimer(event_queue_t *queue,
  *
  * @note    Enable the `event_loop_debug` module to print the execution times of
  *          the event handler functions.
+ * @note    Enable the `event_loop_batch` module to handle events in batches,
+ *          see @ref event_loop_batch_multi.
  *
  * @param[in]   queues      Event queues to process
  * @param[in]   n_queues    Number of queues passed with @p queues
  */
 static inline void event_loop_multi(event_queue_t *queues, size_t n_queues)
 {
+    if (IS_USED(MODULE_EVENT_LOOP_BATCH) && !IS_USED(MODULE_EVENT_LOOP_DEBUG)) {
+        event_loop_batch_multi(queues, n_queues);
+    }
     while (1) {
         event_t *event = event_wait_multi(queues, n_queues);
         if (IS_USED(MODULE_EVENT_LOOP_DEBUG)) {
@@ -0,0 +1,279 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup     sys_event
+ * @brief       Stackless coroutines running on an event queue
+ *
+ * A coroutine is a function that can wait for something to happen without
+ * blocking the thread it runs on. When it has to wait, it returns, and is
+ * called again when woken up, continuing where it left off. Many coroutines
+ * can therefore share the stack of a single event thread.
+ *
+ * The coroutine function brackets its body with @ref EVENT_CORO_BEGIN and
+ * @ref EVENT_CORO_END and waits with @ref EVENT_CORO_WAIT_UNTIL and friends.
+ * It is resumed by posting the event embedded in the coroutine, see
+ * @ref event_coro_wake, which is safe to call from any context.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * typedef struct {
+ *     event_coro_t coro;
+ *     unsigned count;
+ * } session_t;
+ *
+ * static int _session(event_coro_t *coro)
+ * {
+ *     session_t *s = container_of(coro, session_t, coro);
+ *
+ *     EVENT_CORO_BEGIN(coro);
+ *     for (s->count = 0; s->count < 3; s->count++) {
+ *         EVENT_CORO_SLEEP(coro, ZTIMER_MSEC, 1000);
+ *         printf("tick %u\n", s->count);
+ *     }
+ *     EVENT_CORO_END(coro);
+ * }
+ *
+ * event_coro_init(&session.coro, EVENT_PRIO_MEDIUM, _session);
+ * event_coro_start(&session.coro);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @warning The coroutine function is left whenever it waits, so local
+ *          variables lose their values. State that is needed after waiting
+ *          has to be kept in a structure extending @ref event_coro_t, like
+ *          `count` above.
+ * @warning The macros use `switch` and `__LINE__`. There must not be more
+ *          than one of them per line, and they can't be used within a
+ *          `switch` statement of the coroutine function.
+ *
+ * The timeouts need the `ztimer` module.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Stackless coroutine API
+ */
+
+#include <stdbool.h>
+
+#include "event.h"
+#include "modules.h"
+
+#if IS_USED(MODULE_ZTIMER) || defined(DOXYGEN)
+#include "ztimer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Returned by a coroutine function that waits
+ */
+#define EVENT_CORO_WAITING  (0)
+
+/**
+ * @brief   Returned by a coroutine function that finished
+ */
+#define EVENT_CORO_DONE     (1)
+
+/**
+ * @brief   Coroutine structure
+ */
+typedef struct event_coro event_coro_t;
+
+/**
+ * @brief   Coroutine function
+ *
+ * @param[in]   coro    the coroutine
+ *
+ * @return  EVENT_CORO_WAITING or EVENT_CORO_DONE, returned by the macros
+ */
+typedef int (*event_coro_fn_t)(event_coro_t *coro);
+
+/**
+ * @brief   Coroutine structure
+ */
+struct event_coro {
+    event_t super;              /**< posted to resume the coroutine */
+    event_queue_t *queue;       /**< queue the coroutine runs on */
+    event_coro_fn_t fn;         /**< coroutine function */
+    void (*done)(event_coro_t *coro);   /**< called when the coroutine
+                                             finished, may be NULL */
+    unsigned resume;            /**< where to continue, 0 to start over */
+#if IS_USED(MODULE_ZTIMER) || defined(DOXYGEN)
+    ztimer_t timer;             /**< timer of the current timeout */
+    ztimer_clock_t *clock;      /**< clock of the current timeout */
+    bool timed_out;             /**< the last timeout expired */
+#endif
+};
+
+/**
+ * @brief   Initialize a coroutine
+ *
+ * @param[out]  coro    coroutine to initialize
+ * @param[in]   queue   event queue to run the coroutine on
+ * @param[in]   fn      coroutine function
+ */
+void event_coro_init(event_coro_t *coro, event_queue_t *queue,
+                     event_coro_fn_t fn);
+
+/**
+ * @brief   Set a function to call when a coroutine finished
+ *
+ * The function is called on the event queue of the coroutine. It may reuse
+ * or free the coroutine, provided that nothing wakes it up anymore, e.g.
+ * its socks have been closed.
+ *
+ * @param[in,out]   coro    the coroutine
+ * @param[in]       done    function to call, or NULL
+ */
+static inline void event_coro_set_done(event_coro_t *coro,
+                                       void (*done)(event_coro_t *coro))
+{
+    coro->done = done;
+}
+
+/**
+ * @brief   Start a coroutine from the beginning
+ *
+ * @pre     The coroutine is not running
+ *
+ * @param[in,out]   coro    the coroutine
+ */
+static inline void event_coro_start(event_coro_t *coro)
+{
+    coro->resume = 0;
+    event_post(coro->queue, &coro->super);
+}
+
+/**
+ * @brief   Resume a waiting coroutine
+ *
+ * May be called from any context, including interrupts. Waking up a
+ * coroutine that already is about to be resumed has no effect.
+ *
+ * @param[in,out]   coro    the coroutine
+ */
+static inline void event_coro_wake(event_coro_t *coro)
+{
+    event_post(coro->queue, &coro->super);
+}
+
+/**
+ * @brief   Start the body of a coroutine function
+ */
+#define EVENT_CORO_BEGIN(coro)  switch ((coro)->resume) { case 0:
+
+/**
+ * @brief   End the body of a coroutine function, finishing it
+ */
+#define EVENT_CORO_END(coro) \
+    } \
+    (coro)->resume = 0; \
+    return EVENT_CORO_DONE
+
+/**
+ * @brief   Finish a coroutine right away
+ */
+#define EVENT_CORO_EXIT(coro) \
+    do { \
+        (coro)->resume = 0; \
+        return EVENT_CORO_DONE; \
+    } while (0)
+
+/**
+ * @brief   Wait until @p cond is true
+ *
+ * @p cond is evaluated right away and each time the coroutine is woken up.
+ */
+#define EVENT_CORO_WAIT_UNTIL(coro, cond) \
+    do { \
+        (coro)->resume = __LINE__; \
+        /* fall through */ \
+        case __LINE__: \
+        if (!(cond)) { \
+            return EVENT_CORO_WAITING; \
+        } \
+    } while (0)
+
+/**
+ * @brief   Let the other events on the queue run, then continue
+ */
+#define EVENT_CORO_YIELD(coro) \
+    do { \
+        (coro)->resume = __LINE__; \
+        event_coro_wake(coro); \
+        return EVENT_CORO_WAITING; \
+        case __LINE__:; \
+    } while (0)
+
+#if IS_USED(MODULE_ZTIMER) || defined(DOXYGEN)
+/**
+ * @brief   Start a timeout waking up the coroutine
+ *
+ * Used by @ref EVENT_CORO_WAIT_UNTIL_TIMEOUT.
+ *
+ * @param[in,out]   coro    the coroutine
+ * @param[in]       clock   clock of the timeout
+ * @param[in]       timeout timeout in ticks of @p clock
+ */
+void event_coro_timeout_set(event_coro_t *coro, ztimer_clock_t *clock,
+                            uint32_t timeout);
+
+/**
+ * @brief   Stop the timeout of a coroutine
+ *
+ * Used by @ref EVENT_CORO_WAIT_UNTIL_TIMEOUT.
+ *
+ * @param[in,out]   coro    the coroutine
+ */
+void event_coro_timeout_clear(event_coro_t *coro);
+
+/**
+ * @brief   Check whether the last wait of a coroutine timed out
+ *
+ * @param[in]   coro    the coroutine
+ *
+ * @return  true, if the timeout expired
+ */
+static inline bool event_coro_timed_out(const event_coro_t *coro)
+{
+    return coro->timed_out;
+}
+
+/**
+ * @brief   Wait until @p cond is true, but at most @p timeout ticks of
+ *          @p clock
+ *
+ * Use @ref event_coro_timed_out to find out whether the timeout expired.
+ */
+#define EVENT_CORO_WAIT_UNTIL_TIMEOUT(coro, cond, clock, timeout) \
+    do { \
+        event_coro_timeout_set(coro, clock, timeout); \
+        (coro)->resume = __LINE__; \
+        /* fall through */ \
+        case __LINE__: \
+        if (!(cond) && !(coro)->timed_out) { \
+            return EVENT_CORO_WAITING; \
+        } \
+        event_coro_timeout_clear(coro); \
+    } while (0)
+
+/**
+ * @brief   Wait for @p duration ticks of @p clock
+ */
+#define EVENT_CORO_SLEEP(coro, clock, duration) \
+    EVENT_CORO_WAIT_UNTIL_TIMEOUT(coro, false, clock, duration)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -0,0 +1,222 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @ingroup     sys_event
+ * @brief       Runs tasks on a set of worker threads with work stealing
+ *
+ * An event queue is served by exactly one thread, so a handler doing
+ * seconds of crypto or compression work delays every event behind it. An
+ * executor instead runs tasks on several worker threads of the same
+ * priority. Each worker has a bounded deque of tasks:
+ *
+ * - A task posted from outside the executor goes to an idle worker, or to
+ *   the worker with the fewest queued tasks.
+ * - A task posted from within a task goes to the deque of the current
+ *   worker.
+ * - A worker runs the tasks of its own deque in order. When it is empty, it
+ *   steals the newest task from the deque of another worker, i.e. the one
+ *   that would have to wait longest.
+ *
+ * Tasks extend @ref event_t like @ref event_callback_t does. A task can be
+ * waited for with @ref event_task_wait, and can post a completion event to
+ * an event queue once it is done.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static event_executor_t executor;
+ * static event_executor_worker_t workers[2];
+ *
+ * static void _compress(event_t *event)
+ * {
+ *     job_t *job = container_of(event, job_t, task.super);
+ *     [...]
+ * }
+ *
+ * event_executor_init(&executor, workers, ARRAY_SIZE(workers),
+ *                     THREAD_PRIORITY_MAIN + 1);
+ * event_task_init(&job.task, _compress);
+ * event_executor_post(&executor, &job.task);
+ * event_task_wait(&job.task);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @note    RIOT runs one thread at a time. A worker busy with a long task
+ *          only lets other workers steal from it while it blocks, or while it
+ *          is preempted by the @ref sched_round_robin module, which time-slices
+ *          threads of the same priority. Short tasks are no longer stuck
+ *          behind long ones either way.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Work-stealing task executor API
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "mutex.h"
+#include "sched.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_event_executor_conf Event executor configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of tasks each worker can queue
+ */
+#ifndef CONFIG_EVENT_EXECUTOR_DEQUE_SIZE
+#define CONFIG_EVENT_EXECUTOR_DEQUE_SIZE    (8U)
+#endif
+
+/**
+ * @brief   Stack size of each worker thread
+ */
+#ifndef CONFIG_EVENT_EXECUTOR_STACKSIZE
+#define CONFIG_EVENT_EXECUTOR_STACKSIZE     (THREAD_STACKSIZE_DEFAULT)
+#endif
+/** @} */
+
+/**
+ * @brief   Thread flag used to wake up idle workers
+ */
+#define THREAD_FLAG_EVENT_EXECUTOR          (0x2)
+
+/**
+ * @brief   Task structure
+ */
+typedef struct {
+    event_t super;              /**< event_t structure that gets extended,
+                                     its handler runs the task */
+    event_queue_t *done_queue;  /**< queue to post event_task_t::done_event
+                                     to, or NULL */
+    event_t *done_event;        /**< completion event */
+    mutex_t done;               /**< unlocked when the task is done */
+} event_task_t;
+
+/**
+ * @brief   Executor structure
+ */
+typedef struct event_executor event_executor_t;
+
+/**
+ * @brief   Worker of an executor
+ */
+typedef struct {
+    event_executor_t *executor; /**< executor of the worker */
+    event_task_t *deque[CONFIG_EVENT_EXECUTOR_DEQUE_SIZE]; /**< queued tasks */
+    uint8_t head;               /**< index of the oldest queued task */
+    uint8_t numof;              /**< number of queued tasks */
+    bool idle;                  /**< the worker waits for tasks */
+    kernel_pid_t pid;           /**< thread of the worker */
+    uint32_t executed;          /**< number of tasks run by the worker */
+    uint32_t stolen;            /**< number of tasks it stole from others */
+    char stack[CONFIG_EVENT_EXECUTOR_STACKSIZE]; /**< stack of the worker */
+} event_executor_worker_t;
+
+/**
+ * @brief   Executor structure
+ */
+struct event_executor {
+    event_executor_worker_t *workers;   /**< the workers */
+    uint8_t numof;                      /**< number of workers */
+    uint8_t next;                       /**< worker to consider first for the
+                                             next task */
+};
+
+/**
+ * @brief   Initialize an executor and start its workers
+ *
+ * @param[out]  executor    executor to initialize
+ * @param[out]  workers     workers to initialize
+ * @param[in]   numof       number of entries in @p workers
+ * @param[in]   priority    priority of the worker threads
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p numof is 0 or exceeds UINT8_MAX
+ * @return  negative errno if a thread could not be created
+ */
+int event_executor_init(event_executor_t *executor,
+                        event_executor_worker_t *workers, unsigned numof,
+                        uint8_t priority);
+
+/**
+ * @brief   Initialize a task
+ *
+ * @param[out]  task        task to initialize
+ * @param[in]   handler     function run by the task
+ */
+static inline void event_task_init(event_task_t *task, event_handler_t handler)
+{
+    task->super.handler = handler;
+    task->done_queue = NULL;
+    task->done_event = NULL;
+    mutex_init(&task->done);
+}
+
+/**
+ * @brief   Post an event to an event queue when a task is done
+ *
+ * @param[in,out]   task    task to set up
+ * @param[in]       queue   queue to post @p event to, or NULL for none
+ * @param[in]       event   completion event
+ */
+static inline void event_task_set_completion(event_task_t *task,
+                                             event_queue_t *queue,
+                                             event_t *event)
+{
+    task->done_queue = queue;
+    task->done_event = event;
+}
+
+/**
+ * @brief   Queue a task on an executor
+ *
+ * @pre     @p task is not queued or running
+ *
+ * @param[in,out]   executor    executor to run @p task
+ * @param[in,out]   task        task to queue
+ *
+ * @return  0 on success
+ * @return  -ENOBUFS if the deques of all workers are full
+ */
+int event_executor_post(event_executor_t *executor, event_task_t *task);
+
+/**
+ * @brief   Check whether a task is done
+ *
+ * @param[in]   task    task posted with @ref event_executor_post
+ *
+ * @return  true, if the task has been run
+ * @return  false, if it is queued or running
+ */
+bool event_task_done(event_task_t *task);
+
+/**
+ * @brief   Block until a task is done
+ *
+ * Returns right away if the task is already done.
+ *
+ * @warning Waiting within a task may deadlock if all workers do so.
+ *
+ * @param[in]   task    task posted with @ref event_executor_post
+ */
+void event_task_wait(event_task_t *task);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
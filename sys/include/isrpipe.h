@@ -82,6 +82,34 @@ int isrpipe_write_one(isrpipe_t *isrpipe, uint8_t c);
  */
 int isrpipe_write(isrpipe_t *isrpipe, const uint8_t *buf, size_t n);
 
+/**
+ * @brief   Get contiguous free space of the isrpipe's buffer to write to
+ *
+ * Allows e.g. a DMA transfer straight into the isrpipe's buffer. The written
+ * bytes are passed to the reader with @ref isrpipe_write_commit.
+ *
+ * @warning The caller must be the only writer of @p isrpipe, see
+ *          @ref tsrb_write_reserve.
+ *
+ * @param[in]   isrpipe     isrpipe object to operate on
+ * @param[out]  buf         start of the free space
+ *
+ * @returns     number of bytes that may be written to @p buf
+ */
+static inline size_t isrpipe_write_reserve(isrpipe_t *isrpipe, uint8_t **buf)
+{
+    return tsrb_write_reserve(&isrpipe->tsrb, buf);
+}
+
+/**
+ * @brief   Pass bytes written to a reserved area to the reader
+ *
+ * @param[in]   isrpipe     isrpipe object to operate on
+ * @param[in]   n           number of bytes written, at most the size
+ *                          returned by @ref isrpipe_write_reserve
+ */
+void isrpipe_write_commit(isrpipe_t *isrpipe, size_t n);
+
 /**
  * @brief   Read data from isrpipe (blocking)
  *
@@ -44,8 +44,11 @@ extern "C" {
  * @{
  */
 #define DNS_TYPE_A              (1)
+#define DNS_TYPE_SOA            (6)
 #define DNS_TYPE_AAAA           (28)
 #define DNS_CLASS_IN            (1)
+#define DNS_RCODE_MASK          (0x000f)
+#define DNS_RCODE_NXDOMAIN      (3)
 /** @} */
 
 /**
@@ -21,6 +21,17 @@
  *
  * This implements a simple DNS cache for A and AAAA entries.
  *
+ * Entries are stored in an open-addressing hash table keyed by the hash of
+ * the DNS name, so a lookup usually only touches the entries of the queried
+ * name. A name can have multiple A and AAAA records, each of them is kept as
+ * separate entry with its own lifetime.
+ *
+ * Failed lookups can be stored as negative entries (RFC 2308), a query that
+ * hits such an entry returns `-ENOENT` until the entry expires.
+ *
+ * Entries are removed by a timer once their lifetime is over, the lookup
+ * itself does not need to check the lifetime.
+ *
  * The cache eviction strategy is based on the remaining time to live
  * of the cache entries, so the first entry to expire will be evicted.
  *
@@ -61,6 +72,24 @@ extern "C" {
 #define CONFIG_DNS_CACHE_AAAA   IS_USED(MODULE_IPV6)
 #endif
 
+/**
+ * @brief   Upper limit for the lifetime of an entry in seconds
+ *
+ * Larger TTLs are capped to this value.
+ */
+#ifndef CONFIG_DNS_CACHE_TTL_MAX
+#define CONFIG_DNS_CACHE_TTL_MAX            (7LU * 24 * 60 * 60)
+#endif
+
+/**
+ * @brief   Upper limit for the lifetime of a negative entry in seconds
+ *
+ * RFC 2308, section 5 recommends one to three hours.
+ */
+#ifndef CONFIG_DNS_CACHE_NEGATIVE_TTL_MAX
+#define CONFIG_DNS_CACHE_NEGATIVE_TTL_MAX   (3LU * 60 * 60)
+#endif
+
 #if IS_USED(MODULE_DNS_CACHE) || DOXYGEN
 /**
  * @brief Get IP address for a DNS name from the DNS cache
@@ -70,7 +99,8 @@ extern "C" {
  * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
  *
  * @return      the size of the resolved address on success
- * @return      <= 0 otherwise
+ * @return      -ENOENT if the name is cached as non-existent
+ * @return      0 if the name is not in the cache
  */
 int dns_cache_query(const char *domain_name, void *addr_out, int family);
 
@@ -81,8 +111,27 @@ int dns_cache_query(const char *domain_name, void *addr_out, int family);
  * @param[in]   addr            buffer containing the address
  * @param[in]   addr_len        length of the address in bytes
  * @param[in]   ttl             lifetime of the entry in seconds
+ *
+ * If the address is already cached for @p domain_name, only its lifetime is
+ * updated. A @p ttl of 0 removes the address from the cache.
+ * Negative entries covering the address family are removed.
  */
 void dns_cache_add(const char *domain_name, const void *addr, int addr_len, uint32_t ttl);
+
+/**
+ * @brief Add a negative entry for a DNS name to the DNS cache
+ *
+ * Caches that @p domain_name has no address of @p family, either because
+ * the name does not exist (NXDOMAIN) or because it has no records of the
+ * requested type (NODATA), see RFC 2308.
+ * Cached addresses covered by @p family are removed.
+ *
+ * @param[in]   domain_name     DNS name that could not be resolved
+ * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC for
+ *                              all address families
+ * @param[in]   ttl             lifetime of the entry in seconds
+ */
+void dns_cache_add_negative(const char *domain_name, int family, uint32_t ttl);
 #else
 static inline int dns_cache_query(const char *domain_name, void *addr_out, int family)
 {
@@ -100,6 +149,14 @@ static inline void dns_cache_add(const char *domain_name, const void *addr,
     (void)addr_len;
     (void)ttl;
 }
+
+static inline void dns_cache_add_negative(const char *domain_name, int family,
+                                          uint32_t ttl)
+{
+    (void)domain_name;
+    (void)family;
+    (void)ttl;
+}
 #endif
 
 #ifdef __cplusplus
@@ -20,6 +20,7 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
@@ -113,6 +114,61 @@ size_t dns_msg_compose_query(void *dns_buf, const char *domain_name,
 int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
                         void *addr_out, uint32_t *ttl);
 
+/**
+ * @brief   Callback for the addresses of a DNS response message
+ *
+ * @param[in] arg           Argument passed to @ref dns_msg_parse_reply_addrs()
+ * @param[in] addr          The IP address of the record
+ * @param[in] addr_len      Length of @p addr
+ * @param[in] ttl           The live time of the record in seconds
+ *
+ * @return  true to stop parsing
+ * @return  false to continue with the next record
+ */
+typedef bool (*dns_msg_addr_cb_t)(void *arg, const void *addr, size_t addr_len,
+                                  uint32_t ttl);
+
+/**
+ * @brief   Parses all addresses of a DNS response message
+ *
+ * Calls @p cb for every A or AAAA record in the answer section that
+ * corresponds to @p family.
+ *
+ * @param[in] buf           The message to parse.
+ * @param[in] len           Length of @p buf.
+ * @param[in] family        The address family used to compose the query for
+ *                          this response (see @ref dns_msg_compose_query())
+ * @param[in] cb            Callback for each address
+ * @param[in] arg           Argument for @p cb
+ *
+ * @return  Number of addresses passed to @p cb on success.
+ * @return  -EBADMSG, when no address corresponding to @p family can be found
+ *          in @p buf.
+ */
+int dns_msg_parse_reply_addrs(const uint8_t *buf, size_t len, int family,
+                              dns_msg_addr_cb_t cb, void *arg);
+
+/**
+ * @brief   Parses a negative DNS response message
+ *
+ * Checks whether @p buf is a cacheable negative response as defined in
+ * [RFC 2308](https://tools.ietf.org/html/rfc2308): either the name does
+ * not exist (NXDOMAIN) or it has no address corresponding to @p family
+ * (NODATA), and the authority section contains the SOA record of the zone.
+ *
+ * @param[in] buf           The message to parse.
+ * @param[in] len           Length of @p buf.
+ * @param[in] family        The address family used to compose the query for
+ *                          this response (see @ref dns_msg_compose_query())
+ * @param[out] ttl          The live time of the negative answer in seconds
+ *
+ * @return  `AF_UNSPEC` if the name does not exist.
+ * @return  @p family if the name has no address of @p family.
+ * @return  -EBADMSG, when @p buf is not a cacheable negative response.
+ */
+int dns_msg_parse_negative(const uint8_t *buf, size_t len, int family,
+                           uint32_t *ttl);
+
 #ifdef __cplusplus
 }
 #endif
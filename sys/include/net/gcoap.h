@@ -675,6 +675,28 @@ extern "C" {
 #define CONFIG_GCOAP_RESEND_BUFS_MAX      (1)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Count of resource index nodes shared by all listeners
+ *
+ * Only used with module `nanocoap_resource_trie`. A listener whose resources
+ * do not fit into the remaining nodes falls back to the linear lookup.
+ */
+#ifndef CONFIG_GCOAP_RESOURCE_TRIE_NODES
+#define CONFIG_GCOAP_RESOURCE_TRIE_NODES  (32)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Count of listeners that can be indexed
+ *
+ * Only used with module `nanocoap_resource_trie`. Includes the listeners
+ * registered by gcoap itself.
+ */
+#ifndef CONFIG_GCOAP_RESOURCE_TRIE_LISTENERS
+#define CONFIG_GCOAP_RESOURCE_TRIE_LISTENERS  (4)
+#endif
+
 /**
  * @name Bitwise positional flags for encoding resource links
  * @anchor COAP_LINK_FLAG_
@@ -59,6 +59,14 @@
  *    the (if necessary prepended) gnrc_netif_hdr_t::if_pid has the appropriate
  *    link-layer destination addresses to the next hop towards the destination.
  *
+ * ### Forwarding fast path
+ *
+ * With the `gnrc_ipv6_fastpath` module, a router forwards plain unicast packets
+ * from the thread of the receiving interface, see
+ * @ref gnrc_ipv6_fastpath_forward(). This saves the round trip through the IPv6
+ * thread, i.e. two context switches and two message queue operations per
+ * packet. Other packets still take the path described above.
+ *
  * ## `GNRC_NETAPI_MSG_TYPE_SND`
  *
  * @ref GNRC_NETAPI_MSG_TYPE_SND expects a @ref net_gnrc_pkt (referred to as
@@ -269,6 +277,35 @@ kernel_pid_t gnrc_ipv6_init(void);
  */
 ipv6_hdr_t *gnrc_ipv6_get_header(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Forwards a received packet without handing it to the IPv6 thread
+ *
+ * Called by @ref net_gnrc_netif for each received packet when the module
+ * `gnrc_ipv6_fastpath` is used. The packet is only taken if
+ *
+ * - it is an IPv6 packet without a Hop-by-Hop Options header,
+ * - neither source nor destination address are link-local and the
+ *   destination is a unicast address that is not assigned to this host,
+ * - its hop limit does not reach 0 on forwarding,
+ * - it fits the MTU of the outgoing interface,
+ * - the link-layer address of the next hop is already known, and
+ * - nobody but the IPv6 thread is subscribed to all IPv6 packets.
+ *
+ * The hop limit is decremented and the packet is handed to the outgoing
+ * interface directly. Everything else, including all error reporting via
+ * ICMPv6, is left to the IPv6 thread.
+ *
+ * @param[in] netif The interface @p pkt was received on.
+ * @param[in] pkt   A received packet in receive order, as passed on by the
+ *                  interface.
+ *
+ * @return  true, if @p pkt was forwarded (or dropped on allocation failure).
+ *          The caller must not touch it anymore.
+ * @return  false, if @p pkt needs to be handled by the IPv6 thread. It is
+ *          unchanged.
+ */
+bool gnrc_ipv6_fastpath_forward(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,6 +26,7 @@
 #include <stdlib.h>
 
 #include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
 #include "net/ipv6/ext.h"
 #include "timex.h"
 
@@ -77,6 +78,20 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_POOL_SIZE (CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE * 2U)
 #endif
 
+/**
+ * @brief   Maximum number of bytes all IPv6 fragmentation reassembly buffer
+ *          entries may hold in the packet buffer
+ *
+ * When a fragment would exceed this budget, the entries that received their
+ * last fragment the longest time ago are removed until it fits. This keeps
+ * incomplete datagrams from exhausting the packet buffer for everything else.
+ *
+ * @note    Only applicable with [gnrc_ipv6_ext_frag](@ref net_gnrc_ipv6_ext_frag) module
+ */
+#ifndef CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_BUDGET
+#define CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_BUDGET      (CONFIG_GNRC_PKTBUF_SIZE / 2U)
+#endif
+
 /**
  * @brief   Timeout for IPv6 fragmentation reassembly buffer entries in microseconds
  *
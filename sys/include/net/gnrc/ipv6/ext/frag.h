@@ -99,6 +99,10 @@ typedef struct {
 typedef struct {
     unsigned rbuf_full;     /**< counts the number of events where the
                              *   reassembly buffer is full */
+    unsigned rbuf_evicted;  /**< counts the number of reassembly buffer
+                             *   entries removed to stay within
+                             *   @ref CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_BUDGET or
+                             *   because the packet buffer was full */
     unsigned frag_full;     /**< counts the number of events that there where
                              *   no @ref gnrc_sixlowpan_frag_fb_t available */
     unsigned datagrams;     /**< reassembled datagrams */
@@ -156,6 +160,9 @@ gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt);
  * @param[in] hdr   IPv6 header to get source and destination address from.
  * @param[in] id    The identification from the fragment header.
  *
+ * Entries are found through a hash table on the identifying parameters, so
+ * this takes constant time unless a new entry needs to replace the oldest one.
+ *
  * @return  A reassembly buffer matching @p id ipv6_hdr_t::src and ipv6_hdr::dst
  *          of @p hdr or first free reassembly buffer. Will never be NULL, as
  *          in the case of the reassembly buffer being full, the entry with the
@@ -56,6 +56,31 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_burst   Burst extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Passes bursts of received packets between GNRC threads
+ * @{
+ * @details Without this extension, every received packet costs one message
+ *          per subscriber on every layer. The submodule `gnrc_netapi_burst`
+ *          lets a thread collect the packets it passes up the stack while it
+ *          works through a burst (see @ref gnrc_netapi_burst_begin()). Threads
+ *          that announced support via @ref gnrc_netapi_burst_accept() then get
+ *          them in a single @ref GNRC_NETAPI_MSG_TYPE_RCV_BURST message.
+ *          All other subscribers still get one
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV message per packet.
+ *
+ * Network interfaces use a burst for all frames fetched within one ISR event,
+ * and the IPv6, 6LoWPAN, UDP, and TCP threads accept bursts and again use one
+ * while handling them.
+ *
+ * To use, add the module `gnrc_netapi_burst` to the `USEMODULE` macro in your
+ * application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_burst
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 
 #include "thread.h"
@@ -92,6 +117,56 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing multiple @ref net_gnrc_pkt up the
+ *          network stack
+ *
+ * The message points to a snip whose data is an array of packets. Use
+ * @ref gnrc_netapi_burst_receive() to handle it.
+ *
+ * @note    Only sent with @ref net_gnrc_netapi_burst to threads that called
+ *          @ref gnrc_netapi_burst_accept().
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_BURST  (0x0207)
+
+#if defined(MODULE_GNRC_NETAPI_BURST) || defined(DOXYGEN)
+/**
+ * @brief   Maximum number of packets collected in one burst
+ *
+ * A full burst is passed on before the next packet is collected.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_burst.
+ */
+#ifndef CONFIG_GNRC_NETAPI_BURST_SIZE
+#define CONFIG_GNRC_NETAPI_BURST_SIZE   (8U)
+#endif
+
+/**
+ * @brief   Packets collected by a thread, see @ref gnrc_netapi_burst_begin()
+ *
+ * @note    Only available with @ref net_gnrc_netapi_burst.
+ */
+typedef struct {
+    /**
+     * @brief   The collected packets and the thread each one is for
+     */
+    struct {
+        gnrc_pktsnip_t *pkt;    /**< the packet */
+        kernel_pid_t pid;       /**< the receiving thread */
+    } pending[CONFIG_GNRC_NETAPI_BURST_SIZE];
+    uint8_t numof;              /**< number of collected packets */
+} gnrc_netapi_burst_t;
+
+/**
+ * @brief   Handler for a single packet of a burst
+ *
+ * @note    Only available with @ref net_gnrc_netapi_burst.
+ *
+ * @param[in] pkt   A received packet
+ */
+typedef void (*gnrc_netapi_burst_cb_t)(gnrc_pktsnip_t *pkt);
+#endif
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -260,6 +335,59 @@ static inline int gnrc_netapi_set(kernel_pid_t pid, netopt_t opt,
                                 GNRC_NETAPI_MSG_TYPE_SET);
 }
 
+#if defined(MODULE_GNRC_NETAPI_BURST) || defined(DOXYGEN)
+/**
+ * @brief   Announces that the calling thread handles
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BURST messages
+ *
+ * This covers all registrations of the thread in @ref net_gnrc_netreg with
+ * its PID. The thread must handle bursts for the rest of its lifetime.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_burst.
+ */
+void gnrc_netapi_burst_accept(void);
+
+/**
+ * @brief   Starts collecting the packets the calling thread passes up the
+ *          stack
+ *
+ * Until @ref gnrc_netapi_burst_end() is called, @ref GNRC_NETAPI_MSG_TYPE_RCV
+ * messages of this thread to threads accepting bursts are kept in @p burst.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_burst.
+ *
+ * @param[out] burst    Storage for the collected packets. Must stay valid until
+ *                      @ref gnrc_netapi_burst_end() is called.
+ */
+void gnrc_netapi_burst_begin(gnrc_netapi_burst_t *burst);
+
+/**
+ * @brief   Passes on the packets collected in @p burst
+ *
+ * Packets for the same thread are sent in one
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV_BURST message. A packet that cannot be
+ * delivered is released.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_burst.
+ *
+ * @param[in] burst     A burst started by the calling thread
+ */
+void gnrc_netapi_burst_end(gnrc_netapi_burst_t *burst);
+
+/**
+ * @brief   Handles a @ref GNRC_NETAPI_MSG_TYPE_RCV_BURST message
+ *
+ * Calls @p cb for each packet within a burst of its own, so the packets are
+ * passed on up the stack together, and releases @p pkts afterwards.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_burst.
+ *
+ * @param[in] pkts  The content of the message
+ * @param[in] cb    The receive handler of the thread
+ */
+void gnrc_netapi_burst_receive(gnrc_pktsnip_t *pkts, gnrc_netapi_burst_cb_t cb);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
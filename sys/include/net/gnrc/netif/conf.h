@@ -79,6 +79,53 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Number of flow queues per interface
+ *
+ * @note        Only applicable with module `gnrc_netif_pktq_fq`. Must be
+ *              smaller than `UINT8_MAX`.
+ *
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS       (8U)
+#endif
+
+/**
+ * @brief       Bytes a flow queue may send per round of the deficit round robin
+ *
+ * @note        Only applicable with module `gnrc_netif_pktq_fq`
+ *
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM     (256U)
+#endif
+
+/**
+ * @brief       Acceptable queueing delay in microseconds (CoDel target)
+ *
+ * @note        Only applicable with module `gnrc_netif_pktq_fq`
+ *
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_TARGET_US
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_TARGET_US   (20000U)
+#endif
+
+/**
+ * @brief       Time in microseconds the queueing delay may stay above
+ *              @ref CONFIG_GNRC_NETIF_PKTQ_FQ_TARGET_US before packets are
+ *              dropped (CoDel interval)
+ *
+ * @note        Only applicable with module `gnrc_netif_pktq_fq`
+ *
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_FQ_INTERVAL_US
+#define CONFIG_GNRC_NETIF_PKTQ_FQ_INTERVAL_US (200000U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
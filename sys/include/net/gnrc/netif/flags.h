@@ -146,6 +146,13 @@ enum {
  */
 #define GNRC_NETIF_FLAGS_TX_FROM_PKTQUEUE          (0x00020000U)
 
+/**
+ * @brief   The device calculates the upper layer checksums of outgoing packets
+ *
+ * @see @ref NETOPT_CSUM_OFFLOAD
+ */
+#define GNRC_NETIF_FLAGS_CSUM_OFFLOAD              (0x00040000U)
+
 /** @} */
 
 #ifdef __cplusplus
@@ -87,6 +87,16 @@ extern "C" {
  */
 #define GNRC_NETIF_HDR_FLAGS_MULTICAST  (0x40)
 
+/**
+ * @brief   Upper layer checksum was verified
+ *
+ * @details The network device verified the UDP, TCP or ICMPv6 checksum of
+ *          this received packet, so the upper layers can skip verifying it.
+ *
+ * @see     @ref NETOPT_CSUM_OFFLOAD
+ */
+#define GNRC_NETIF_HDR_FLAGS_CSUM_VALID (0x20)
+
 /**
  * @brief   More data will follow
  *
@@ -12,6 +12,37 @@
  * @defgroup    net_gnrc_netif_pktq Send queue for @ref net_gnrc_netif
  * @ingroup     net_gnrc_netif
  * @brief
+ *
+ * Packets an interface cannot send right away are queued and sent in order once
+ * the device is available again.
+ *
+ * Flow queueing
+ * -------------
+ * With module `gnrc_netif_pktq_fq`, the packets are instead sorted into
+ * @ref CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS flow queues per interface by a hash of
+ * their link-layer destination, IPv6 source and destination address, next
+ * header and, for UDP and TCP, ports, so a bulk transfer does not delay the
+ * packets of other flows. The flows take turns by deficit round robin with
+ * @ref CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM bytes per round, with flows that just
+ * became active being served first (RFC 8290). Each flow drops stale packets
+ * when dequeuing by CoDel (RFC 8289): once the queueing delay stayed above
+ * @ref CONFIG_GNRC_NETIF_PKTQ_FQ_TARGET_US for
+ * @ref CONFIG_GNRC_NETIF_PKTQ_FQ_INTERVAL_US, packets are dropped at an
+ * increasing rate until it falls below the target again. When the pool of
+ * entries is depleted, the oldest packet of the longest flow of the interface
+ * is dropped to make room for a new one.
+ *
+ * Neither operation allocates from the packet buffer and both take bounded
+ * time: enqueuing is linear in @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE and
+ * @ref CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS, dequeuing visits each flow at most
+ * `1 + MTU / CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM` times and drops at most all
+ * queued packets.
+ *
+ * The queueing delay and drops of each flow are provided as an array of
+ * @ref netstats_fq_t by @ref NETOPT_STATS with @ref NETSTATS_FQ as context.
+ * Since packets of 6LoWPAN interfaces are already compressed when they are
+ * queued, they are only told apart by their link-layer destination.
+ *
  * @{
  *
  * @file
@@ -42,7 +73,9 @@ extern "C" {
  *
  * @return  0 on success
  * @return  -1 when the pool of available gnrc_pktqueue_t entries (of size
- *          @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) is depleted
+ *          @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) is depleted. With module
+ *          `gnrc_netif_pktq_fq` only when no packet of @p netif can be
+ *          dropped instead.
  */
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 
@@ -53,6 +86,19 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
  */
 unsigned gnrc_netif_pktq_usage(void);
 
+/**
+ * @brief   Gets a packet from the flow queues of a network interface
+ *
+ * @note    Only available with module `gnrc_netif_pktq_fq`, use
+ *          @ref gnrc_netif_pktq_get() instead.
+ *
+ * @param[in] netif A network interface. May not be NULL.
+ *
+ * @return  A packet on success
+ * @return  NULL when the queue is empty
+ */
+gnrc_pktsnip_t *gnrc_netif_pktq_fq_get(gnrc_netif_t *netif);
+
 /**
  * @brief   Gets a packet from the packet send queue of a network interface
  *
@@ -65,7 +111,9 @@ unsigned gnrc_netif_pktq_usage(void);
  */
 static inline gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
 {
-#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    return gnrc_netif_pktq_fq_get(netif);
+#elif IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
     gnrc_pktsnip_t *pkt = NULL;
@@ -130,7 +178,12 @@ static inline bool gnrc_netif_pktq_empty(gnrc_netif_t *netif)
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+    return (netif->send_queue.queue == NULL) &&
+           (netif->send_queue.numof == 0);
+#else
     return (netif->send_queue.queue == NULL);
+#endif
 #else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
     (void)netif;
     return false;
@@ -23,18 +23,59 @@
  * @author  Martine S. Lenders <m.lenders@fu-berlin.de>
  */
 
+#include "modules.h"
+#include "net/gnrc/netif/conf.h"
 #include "net/gnrc/pktqueue.h"
+#include "net/netstats.h"
 #include "xtimer.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) || DOXYGEN
+/**
+ * @brief   A flow queue of @ref gnrc_netif_pktq_t
+ *
+ * @note    Only available with module `gnrc_netif_pktq_fq`
+ */
+typedef struct {
+    gnrc_pktqueue_t *head;      /**< oldest packet of the flow */
+    gnrc_pktqueue_t *tail;      /**< newest packet of the flow */
+    netstats_fq_t stats;        /**< statistics of the flow */
+    uint32_t first_above;       /**< time the queueing delay will have been
+                                 *   above the target for an interval */
+    uint32_t drop_next;         /**< time of the next drop */
+    uint16_t drop_count;        /**< drops since entering the dropping state */
+    uint16_t last_drop_count;   /**< gnrc_netif_pktq_flow_t::drop_count when
+                                 *   last leaving the dropping state */
+    int16_t deficit;            /**< bytes the flow may send in this round */
+    uint16_t numof;             /**< number of queued packets */
+    uint8_t next;               /**< next flow in the list of active flows */
+    uint8_t list;               /**< list of active flows the flow is in */
+    bool dropping;              /**< the flow is in the dropping state */
+} gnrc_netif_pktq_flow_t;
+#endif
+
 /**
  * @brief   A packet queue for @ref net_gnrc_netif with a de-queue timer
  */
 typedef struct {
-    gnrc_pktqueue_t *queue;     /**< the actual packet queue class */
+    gnrc_pktqueue_t *queue;     /**< the actual packet queue class. With module
+                                 *   `gnrc_netif_pktq_fq` only the packets
+                                 *   pushed back, which are sent first */
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) || DOXYGEN
+    /**
+     * @brief   flow queues, packets are assigned to them by a hash of their
+     *          addresses and ports
+     */
+    gnrc_netif_pktq_flow_t flows[CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS];
+    uint16_t numof;             /**< number of packets in the flow queues */
+    uint8_t new_flows;          /**< flows that recently became active */
+    uint8_t new_flows_tail;     /**< last flow in gnrc_netif_pktq_t::new_flows */
+    uint8_t old_flows;          /**< flows that exhausted their deficit */
+    uint8_t old_flows_tail;     /**< last flow in gnrc_netif_pktq_t::old_flows */
+#endif
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
     msg_t dequeue_msg;          /**< message for gnrc_netif_pktq_t::dequeue_timer to send */
     xtimer_t dequeue_timer;     /**< timer to schedule next sending of
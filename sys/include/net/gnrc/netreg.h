@@ -226,8 +226,8 @@ typedef struct gnrc_netreg_entry {
  *
  * There is an exclusive counterpart to the lock, which is
  * internal to netreg (and used through functions such as @ref
- * gnrc_netreg_register and @ref gnrc_netreg_unregister). The current
- * implementation prioritizes shared locks. This means that shared locks are
+ * gnrc_netreg_register and @ref gnrc_netreg_unregister). The lock is a
+ * @ref core_sync_rwlock, which prioritizes shared locks. This means that shared locks are
  * generally acquired fast (they only block if an exclusive operation has
  * already started), but constant access through shared locks might starve
  * registration and deregistration.
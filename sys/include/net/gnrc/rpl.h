@@ -84,8 +84,7 @@
  *   CFLAGS += -DCONFIG_GNRC_RPL_WITHOUT_VALIDATION
  *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *
- * - This RPL implementation currently only supports storing mode.
- *   That means, in order to have downwards routes to all nodes the
+ * - In storing mode, in order to have downwards routes to all nodes the
  *   storage space within [@c gnrc_ipv6's Neighbor Information Base](@ref net_gnrc_ipv6_nib)
  *   must be big enough to store information for each node.
  *
@@ -98,6 +97,10 @@
  *   CFLAGS += -DCONFIG_GNRC_IPV6_NIB_OFFL_NUMOF=50
  *   ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * - In non-storing mode, the root keeps the downward routes in the
+ *   [@c gnrc_rpl_sr_table](@ref net_gnrc_rpl_sr_table) module instead, which
+ *   needs considerably less memory per node.
+ *
  * - If you want to allow for alternative parents, increase the number of
  *   default routers in the NIB.
  *
@@ -109,20 +112,23 @@
  * TODO
  * ------
  *
- * The GNRC RPL implementation only implements storing mode
- * with OF0 ([RFC6552](https://tools.ietf.org/html/rfc6552)).
+ * The GNRC RPL implementation implements storing mode
+ * with OF0 ([RFC6552](https://tools.ietf.org/html/rfc6552)) and, with the
+ * [@c gnrc_rpl_mrhof](@ref net_gnrc_rpl_mrhof) module, MRHOF
+ * ([RFC6719](https://tools.ietf.org/html/rfc6719)) based on ETX.
  * The RPL routing header is parsed by the nodes when the [@c gnrc_rpl_srh](@ref net_gnrc_rpl_srh)
- * module is used, but anything else
- * for non-storing mode is missing.
+ * module is used. In non-storing mode, the root adds it to the packets it
+ * sends with the [@c gnrc_rpl_sr_table](@ref net_gnrc_rpl_sr_table) module,
+ * but it does not tunnel the packets it forwards into the DODAG.
  * For interoperability with other RPL implementations, open task include:
  *
  * - IPv6 Hop-by-hop RPL option
  *   (see [#7231](https://github.com/RIOT-OS/RIOT/pull/7231#issuecomment-651237343))
- * - Metric based routing ([RFC6551](https://tools.ietf.org/html/rfc6551)
- *   and [RFC6719](https://tools.ietf.org/html/rfc6719))
+ * - Metric based routing with the DAG Metric Container
+ *   ([RFC6551](https://tools.ietf.org/html/rfc6551))
  *   (see [14448](https://github.com/RIOT-OS/RIOT/pull/14448) and
  *   [#14623](https://github.com/RIOT-OS/RIOT/pull/14623))
- * - Non-Storing mode
+ * - Non-Storing mode for packets forwarded by the root
  * - DAG-Metric Container ([RFC6550#6.7.4](https://tools.ietf.org/html/rfc6550#section-6.7.4)
  *   and [RFC6551](https://tools.ietf.org/html/rfc6551))
  *
@@ -247,12 +253,22 @@ extern "C" {
 /**
  * @brief   Number of implemented Objective Functions
  */
-#define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (1)
+#define GNRC_RPL_IMPLEMENTED_OFS_NUMOF (1 + IS_USED(MODULE_GNRC_RPL_MRHOF))
+
+/**
+ * @brief   Default Objective Code Point
+ *
+ * Used by the root of a DODAG. Defaults to OF0, set to 1 for
+ * @ref net_gnrc_rpl_mrhof.
+ */
+#ifndef CONFIG_GNRC_RPL_DEFAULT_OCP
+#define CONFIG_GNRC_RPL_DEFAULT_OCP (0)
+#endif
 
 /**
- * @brief   Default Objective Code Point (OF0)
+ * @brief   Default Objective Code Point (OF0, unless configured otherwise)
  */
-#define GNRC_RPL_DEFAULT_OCP (0)
+#define GNRC_RPL_DEFAULT_OCP (CONFIG_GNRC_RPL_DEFAULT_OCP)
 
 /**
  * @brief   Default Instance ID
@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_rpl_mrhof Minimum Rank with Hysteresis Objective Function
+ * @ingroup     net_gnrc_rpl
+ * @brief       Implementation of MRHOF using the ETX of the links to parents
+ * @see <a href="https://tools.ietf.org/html/rfc6719">
+ *          RFC 6719
+ *      </a>
+ *
+ * The link ETX is taken from @ref net_netstats with the
+ * `netstats_neighbor_etx` module, which is pulled in automatically. Links
+ * without fresh statistics are assumed to have an ETX of
+ * @ref NETSTATS_NB_ETX_INIT. As no DAG Metric Container is used, the path cost
+ * is the rank of a parent plus the ETX of the link to it, with an ETX of 1
+ * corresponding to the minimum hop rank increase of the instance.
+ *
+ * The root of a DODAG chooses the objective function. To use MRHOF, set
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_rpl_mrhof
+ * CFLAGS += -DCONFIG_GNRC_RPL_DEFAULT_OCP=1
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Other nodes only need the module to join such a DODAG.
+ * @{
+ *
+ * @file
+ * @brief       Definitions for MRHOF
+ */
+
+#include "net/gnrc/rpl/structs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Objective Code Point of MRHOF
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-6">
+ *          RFC 6719, section 6, IANA Considerations
+ *      </a>
+ */
+#define GNRC_RPL_OCP_MRHOF      (0x1)
+
+/**
+ * @brief   Maximum ETX of a link to a parent, in units of 1/128
+ *
+ * Parents with links beyond this are not used.
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5, MRHOF Variables and Parameters
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC
+#define CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC           (512)
+#endif
+
+/**
+ * @brief   ETX a new parent must be better than the preferred parent by,
+ *          in units of 1/128
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc6719#section-5">
+ *          RFC 6719, section 5, MRHOF Variables and Parameters
+ *      </a>
+ */
+#ifndef CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD
+#define CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD   (192)
+#endif
+
+/**
+ * @brief   Return the address to the MRHOF objective function
+ *
+ * @return  Address of the MRHOF objective function
+ */
+gnrc_rpl_of_t *gnrc_rpl_get_of_mrhof(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
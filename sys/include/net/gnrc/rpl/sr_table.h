@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_rpl_sr_table RPL non-storing mode source route table
+ * @ingroup     net_gnrc_rpl
+ * @brief       Downward routes of a non-storing mode root
+ * @see <a href="https://tools.ietf.org/html/rfc6550#section-9.7">
+ *          RFC 6550, section 9.7, Non-Storing Mode
+ *      </a>
+ *
+ * In non-storing mode every node reports its parent to the root by a DAO. The
+ * root keeps these as a tree of parent pointers and, for each packet it sends
+ * down the DODAG, walks the tree from the destination up to itself to build an
+ * RPL source routing header (@ref net_gnrc_rpl_srh) carrying the path.
+ *
+ * All nodes of a DODAG share the /64 prefix of the DODAG ID, so the table
+ * stores this prefix once and keeps only the interface identifier of each
+ * node. Nodes are found through a hash table on the interface identifier, so
+ * handling a DAO and routing a packet take constant time per hop. An entry
+ * takes 16 bytes, so a root serving 512 nodes needs a bit more than 8 KiB with
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_rpl_sr_table
+ * CFLAGS += -DCONFIG_GNRC_RPL_MOP_NON_STORING_MODE=1
+ * CFLAGS += -DCONFIG_GNRC_RPL_SR_TABLE_SIZE=512
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Only packets originating at the root are source routed. Packets the root
+ * forwards into the DODAG would need to be tunneled (RFC 6554, section 4),
+ * which is not supported.
+ * @{
+ *
+ * @file
+ * @brief       Definitions for the RPL non-storing mode source route table
+ */
+
+#include <stdint.h>
+
+#include "net/gnrc/pkt.h"
+#include "net/ipv6/addr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of nodes the table can hold
+ *
+ * @note    Must be smaller than `UINT16_MAX`.
+ */
+#ifndef CONFIG_GNRC_RPL_SR_TABLE_SIZE
+#define CONFIG_GNRC_RPL_SR_TABLE_SIZE       (64)
+#endif
+
+/**
+ * @brief   Maximum number of hops of a downward route
+ *
+ * Longer routes, including the ones created by loops in the reported parents,
+ * are treated as unknown.
+ */
+#ifndef CONFIG_GNRC_RPL_SR_TABLE_MAX_HOPS
+#define CONFIG_GNRC_RPL_SR_TABLE_MAX_HOPS   (16)
+#endif
+
+/**
+ * @brief   Lifetime that never expires
+ */
+#define GNRC_RPL_SR_TABLE_LIFETIME_INF      (UINT32_MAX)
+
+/**
+ * @brief   Removes all entries and sets the prefix of the DODAG
+ *
+ * @param[in] dodag_id  ID of the DODAG, only the first 64 bits are used
+ */
+void gnrc_rpl_sr_table_reset(const ipv6_addr_t *dodag_id);
+
+/**
+ * @brief   Adds a node or updates its parent
+ *
+ * A parent that is not known yet is added as well, but routes through it are
+ * unknown until it reports its own parent.
+ *
+ * @param[in] target    Address of the node
+ * @param[in] parent    Address of the parent of @p target, NULL if the parent
+ *                      is the root
+ * @param[in] lifetime  Lifetime of the entry in seconds, 0 removes the entry,
+ *                      @ref GNRC_RPL_SR_TABLE_LIFETIME_INF for infinite
+ *
+ * @return  0 on success
+ * @return  -EINVAL, if @p target or @p parent are not within the prefix of the
+ *          DODAG
+ * @return  -ENOMEM, if the table is full
+ */
+int gnrc_rpl_sr_table_update(const ipv6_addr_t *target,
+                             const ipv6_addr_t *parent, uint32_t lifetime);
+
+/**
+ * @brief   Looks up the downward route to a node
+ *
+ * @param[in] dst           Destination address of a packet
+ * @param[out] first_hop    The child of the root to send the packet to
+ * @param[out] srh          A source routing header with the rest of the route,
+ *                          NULL if @p dst is a child of the root. Must be
+ *                          inserted after the IPv6 header, with its next
+ *                          header field set, or released.
+ *
+ * @return  0 on success
+ * @return  -ENOENT, if no route to @p dst is known
+ * @return  -ENOMEM, if there is no space left in the packet buffer
+ */
+int gnrc_rpl_sr_table_route(const ipv6_addr_t *dst, ipv6_addr_t *first_hop,
+                            gnrc_pktsnip_t **srh);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -102,6 +102,11 @@
  * - @ref ieee802154_submac_ack_timer_cancel
  * - @ref ieee802154_submac_bh_request
  *
+ * With the `ieee802154_submac_stats` module, the SubMAC counts the transitions
+ * into each state and the time spent in it, as well as retransmissions,
+ * CSMA-CA retries and the time spent in random backoff. See
+ * @ref ieee802154_submac_get_stats.
+ *
  * @{
  *
  * @author       José I. Alamos <jose.alamos@haw-hamburg.de>
@@ -185,6 +190,24 @@ typedef enum {
     IEEE802154_FSM_EV_NUMOF,                /**< Number of SubMAC FSM events */
 } ieee802154_fsm_ev_t;
 
+/**
+ * @brief SubMAC profiling counters
+ *
+ * Only available with the `ieee802154_submac_stats` module. Times are in µs
+ * and wrap around after about 71 minutes.
+ */
+typedef struct {
+    uint32_t state_enter[IEEE802154_FSM_STATE_NUMOF];   /**< transitions into each state */
+    uint32_t state_us[IEEE802154_FSM_STATE_NUMOF];      /**< time spent in each state */
+    uint32_t since;         /**< ZTIMER_USEC time of the last state transition */
+    uint32_t tx_frames;     /**< frames passed to @ref ieee802154_send, without ACKs */
+    uint32_t tx_noack;      /**< transmissions that failed because of missing ACKs */
+    uint32_t tx_busy;       /**< transmissions that failed because the channel was busy */
+    uint32_t retrans;       /**< retransmissions because of a missing ACK */
+    uint32_t cca_retries;   /**< CSMA-CA attempts repeated because the channel was busy */
+    uint32_t backoff_us;    /**< time spent in CSMA-CA random backoff */
+} ieee802154_submac_stats_t;
+
 /**
  * @brief IEEE 802.15.4 SubMAC descriptor
  */
@@ -208,6 +231,9 @@ struct ieee802154_submac {
     ieee802154_fsm_state_t fsm_state;    /**< State of the SubMAC */
     ieee802154_phy_mode_t phy_mode;     /**< IEEE 802.15.4 PHY mode */
     const iolist_t *psdu;               /**< stores the current PSDU */
+#if IS_USED(MODULE_IEEE802154_SUBMAC_STATS) || DOXYGEN
+    ieee802154_submac_stats_t stats;    /**< profiling counters */
+#endif
 };
 
 /**
@@ -512,6 +538,30 @@ static inline bool ieee802154_submac_state_is_idle(ieee802154_submac_t *submac)
 int ieee802154_submac_init(ieee802154_submac_t *submac, const network_uint16_t *short_addr,
                            const eui64_t *ext_addr);
 
+/**
+ * @brief Get the profiling counters of the SubMAC
+ *
+ * The time spent in the current state is accounted up to now. Like the other
+ * SubMAC functions, this must not be called concurrently with the SubMAC
+ * processing events.
+ *
+ * @pre The `ieee802154_submac_stats` module is used
+ *
+ * @param[in] submac pointer to the SubMAC descriptor
+ * @param[out] stats destination for the counters
+ */
+void ieee802154_submac_get_stats(ieee802154_submac_t *submac,
+                                 ieee802154_submac_stats_t *stats);
+
+/**
+ * @brief Reset the profiling counters of the SubMAC
+ *
+ * @pre The `ieee802154_submac_stats` module is used
+ *
+ * @param[in] submac pointer to the SubMAC descriptor
+ */
+void ieee802154_submac_reset_stats(ieee802154_submac_t *submac);
+
 /**
  * @brief Set the ACK timeout timer
  *
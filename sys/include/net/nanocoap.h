@@ -66,6 +66,11 @@
  * and exact matching should be register, and then a second one with the path
  * `/resource01/` and subtree matching.
  *
+ * By default, resources are matched in array order. Servers with many
+ * resources can use the module `nanocoap_resource_trie`
+ * (@ref net_nanocoap_resource_trie), which indexes the resources by path
+ * segment with the same matching rules.
+ *
  * @{
  *
  * @file
@@ -224,7 +229,8 @@ typedef struct {
     iolist_t *snips;                                  /**< payload snips (optional)*/
     uint16_t payload_len;                             /**< length of payload       */
     uint16_t options_len;                             /**< length of options array */
-    coap_optpos_t options[CONFIG_NANOCOAP_NOPTS_MAX]; /**< option offset array     */
+    coap_optpos_t options[CONFIG_NANOCOAP_NOPTS_MAX]; /**< option offset array,
+                                                           sorted by option number */
     BITFIELD(opt_crit, CONFIG_NANOCOAP_NOPTS_MAX);    /**< unhandled critical option */
 #ifdef MODULE_GCOAP
     uint32_t observe_value;                           /**< observe value           */
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_nanocoap_resource_trie nanoCoAP resource index
+ * @ingroup     net_nanocoap
+ * @brief       Path segment trie for fast request dispatch
+ *
+ * Matching a request against a plain array of @ref coap_resource_t requires
+ * reassembling the Uri-Path options into a string and comparing it with
+ * every resource path in turn. With many resources this becomes a noticeable
+ * part of the request latency.
+ *
+ * This module builds an index over a resource array once, at registration
+ * time. The index is a trie over the path segments of the resources and is
+ * walked directly along the Uri-Path options of a request, so the path is
+ * never copied and each option is compared only against the resources that
+ * share the same parent path.
+ *
+ * Matching semantics are the same as for the linear lookup: the first
+ * resource in the array whose path and method match is chosen, and
+ * @ref COAP_MATCH_SUBTREE resources match any request path they are a string
+ * prefix of. Like the linear lookup, requests whose path does not fit into
+ * @ref CONFIG_NANOCOAP_URI_MAX are rejected.
+ *
+ * @note    The index compares whole Uri-Path options with the segments of a
+ *          resource path. Unlike the linear lookup, it does not match a
+ *          single option that contains a '/' against several segments,
+ *          e.g. the option "a/b" does not match the resource "/a/b".
+ *
+ * The nodes of the trie are taken from a caller supplied array. Each path
+ * segment of each resource needs at most one node, segments shared between
+ * resources are only stored once.
+ *
+ * To use the index for the nanoCoAP server and for gcoap listeners, add
+ *
+ *     USEMODULE += nanocoap_resource_trie
+ *
+ * to your application Makefile.
+ *
+ * @{
+ *
+ * @file
+ * @brief       nanoCoAP resource index definitions
+ */
+
+#include <stdint.h>
+
+#include "net/nanocoap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_nanocoap_resource_trie_conf    nanoCoAP resource index compile configurations
+ * @ingroup  net_nanocoap_conf
+ * @{
+ */
+/**
+ * @brief   Number of trie nodes available to index the nanoCoAP server resources
+ */
+#ifndef CONFIG_NANOCOAP_RESOURCE_TRIE_NODES
+#define CONFIG_NANOCOAP_RESOURCE_TRIE_NODES     (32)
+#endif
+/** @} */
+
+/**
+ * @brief   Marker for an unused node or resource index
+ */
+#define COAP_RESOURCE_TRIE_NONE     (UINT16_MAX)
+
+/**
+ * @brief   Node flag: segment is matched as prefix of a @ref COAP_MATCH_SUBTREE
+ *          resource
+ */
+#define COAP_RESOURCE_TRIE_PREFIX   (0x01)
+
+/**
+ * @brief   A single path segment in the resource index
+ */
+typedef struct {
+    const char *seg;    /**< segment inside the resource path, not terminated */
+    uint16_t child;     /**< index of the first child node */
+    uint16_t sibling;   /**< index of the next node with the same parent */
+    uint16_t res;       /**< index of the resource ending at this node */
+    uint8_t seg_len;    /**< length of @ref seg */
+    uint8_t flags;      /**< node flags */
+} coap_resource_trie_node_t;
+
+/**
+ * @brief   Resource index over an array of resources
+ */
+typedef struct {
+    const coap_resource_t *resources;   /**< indexed resources */
+    coap_resource_trie_node_t *nodes;   /**< node storage */
+    uint16_t nodes_numof;               /**< number of entries in @ref nodes */
+    uint16_t nodes_used;                /**< number of nodes in use */
+    uint16_t root;                      /**< first node of the top level */
+} coap_resource_trie_t;
+
+/**
+ * @brief   Build the index for a resource array
+ *
+ * @param[out]  trie            index to initialize
+ * @param[in]   nodes           storage for the trie nodes
+ * @param[in]   nodes_numof     number of entries in @p nodes
+ * @param[in]   resources       resources to index, must stay valid while
+ *                              @p trie is in use
+ * @param[in]   resources_numof number of entries in @p resources
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if @p nodes is too small
+ * @return  -EINVAL if a resource path can not be indexed (it does not
+ *          start with a '/' or has a segment longer than 255 characters)
+ */
+int coap_resource_trie_init(coap_resource_trie_t *trie,
+                            coap_resource_trie_node_t *nodes, size_t nodes_numof,
+                            const coap_resource_t *resources,
+                            size_t resources_numof);
+
+/**
+ * @brief   Find the resource for a request
+ *
+ * @param[in]   trie        index to search
+ * @param[in]   pkt         parsed request
+ * @param[out]  resource    matching resource
+ *
+ * @return  0 if a resource with matching path and method was found
+ * @return  -ENOTSUP if the path matched, but none of the matching
+ *          resources accepts the request method
+ * @return  -ENOENT if no resource path matched
+ * @return  -EBADMSG if the path is longer than @ref CONFIG_NANOCOAP_URI_MAX
+ */
+int coap_resource_trie_find(const coap_resource_trie_t *trie, coap_pkt_t *pkt,
+                            const coap_resource_t **resource);
+
+/**
+ * @brief   Pass a CoAP request to the matching handler of an index
+ *
+ * Equivalent to @ref coap_tree_handler, but looks up the handler in @p trie.
+ *
+ * @param[in]   pkt             pointer to (parsed) CoAP packet
+ * @param[out]  resp_buf        buffer for response
+ * @param[in]   resp_buf_len    size of response buffer
+ * @param[in]   ctx             CoAP request context information
+ * @param[in]   trie            index of the resources
+ *
+ * @returns     size of the reply packet on success
+ * @returns     <0 on error
+ */
+ssize_t coap_resource_trie_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                                   unsigned resp_buf_len, coap_request_ctx_t *ctx,
+                                   const coap_resource_trie_t *trie);
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
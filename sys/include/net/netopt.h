@@ -409,6 +409,10 @@ typedef enum {
      * A get operation expects a @ref netstats_t and will copy the current
      * statistics into it, atomically. A set operation resets the statistics
      * (zeros it out) regardless of the parameter given.
+     *
+     * With @ref NETSTATS_FQ as context, a get operation of a
+     * @ref net_gnrc_netif "GNRC network interface" instead copies a
+     * @ref netstats_fq_t for each of its flow queues.
      */
     NETOPT_STATS,
 
@@ -870,6 +874,21 @@ typedef enum {
      */
     NETOPT_GTS_TX,
 
+    /**
+     * @brief   (@ref netopt_csum_offload_t) upper layer checksums the device
+     *          handles for the network stack
+     *
+     * Read-only. With @ref NETOPT_CSUM_OFFLOAD_TX the device calculates the
+     * UDP, TCP and ICMPv6 checksums of outgoing IPv6 packets that carry the
+     * upper layer header directly after the IPv6 header and are not fragmented.
+     * The network stack leaves the checksum field of these packets undefined.
+     *
+     * With @ref NETOPT_CSUM_OFFLOAD_RX the device verifies these checksums of
+     * incoming packets and reports the packets it verified with the receive
+     * information of the frame, e.g. @ref NETDEV_ETH_RX_INFO_FLAG_CSUM_VALID.
+     */
+    NETOPT_CSUM_OFFLOAD,
+
     /**
      * @brief   maximum number of options defined here.
      *
@@ -920,6 +939,16 @@ typedef enum {
     NETOPT_RF_TESTMODE_CTX_PRBS9,   /**< PRBS9 continuous tx mode */
 } netopt_rf_testmode_t;
 
+/**
+ * @brief   Option parameter to be used with @ref NETOPT_CSUM_OFFLOAD
+ */
+typedef enum {
+    NETOPT_CSUM_OFFLOAD_RX = 0x1,   /**< checksums of incoming packets are
+                                     *   verified */
+    NETOPT_CSUM_OFFLOAD_TX = 0x2,   /**< checksums of outgoing packets are
+                                     *   calculated */
+} netopt_csum_offload_t;
+
 /**
  * @brief   Netopt RF channel type
  */
@@ -0,0 +1,338 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_netsim  In-process radio medium simulator
+ * @ingroup     net
+ * @brief       Connects many virtual radios within one process
+ *
+ * Simulating a network on `native` usually means one process per node,
+ * connected through TAP bridges or @ref drivers_socket_zep. This module
+ * instead simulates a shared medium for many virtual radios in a single
+ * process, so no frame ever crosses the host kernel.
+ *
+ * Each node is a @ref sys_netdev_test device. A frame sent by a node is
+ * copied once and handed to every other node the link model connects it to,
+ * after the link's delay and unless the link's loss drops it. The link model
+ * is a callback (@ref netsim_link_cb_t), so any topology can be expressed;
+ * @ref netsim_link_full and @ref netsim_link_grid cover the common cases.
+ *
+ * Nodes are used in one of two ways:
+ *
+ * - **netdev mode**: pass @ref netsim_node_netdev to a network stack, e.g.
+ *   `gnrc_netif_ieee802154_create()`. Frames are received through the usual
+ *   @ref NETDEV_EVENT_RX_COMPLETE event. Options the stack needs are
+ *   provided with `netdev_test_set_get_cb()` on netsim_node_t::dev. As GNRC
+ *   is a singleton, all nodes attached this way are interfaces of the same
+ *   stack.
+ * - **raw mode**: set a receive callback with @ref netsim_node_set_rx_cb and
+ *   send with @ref netsim_send or @ref netsim_forward. This allows simple
+ *   per-node protocols, e.g. flooding or static forwarding, with hundreds
+ *   of nodes.
+ *
+ * Frames carry the time they were first sent, which @ref netsim_forward
+ * preserves. Every node accounts the end-to-end latency of the frames it
+ * receives, along with frame counters and the usage of its receive queue
+ * (see @ref netsim_stats_t and @ref netsim_print_stats).
+ *
+ * Loss is drawn from a PRNG private to the simulation. Combined with the
+ * `native_virtual_time` module, a simulation runs as fast as the host
+ * allows and gives the same result on every run.
+ *
+ * @{
+ *
+ * @file
+ * @brief       In-process radio medium simulator definitions
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mutex.h"
+#include "net/netdev_test.h"
+#include "sched.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_netsim_conf    In-process radio medium simulator configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Maximum size of a frame in bytes
+ */
+#ifndef CONFIG_NETSIM_FRAME_SIZE
+#define CONFIG_NETSIM_FRAME_SIZE        (127U)
+#endif
+
+/**
+ * @brief   Number of frames in flight at the same time
+ */
+#ifndef CONFIG_NETSIM_FRAME_NUMOF
+#define CONFIG_NETSIM_FRAME_NUMOF       (64U)
+#endif
+
+/**
+ * @brief   Number of deliveries of frames to nodes pending at the same time
+ *
+ * A broadcast frame needs one delivery per neighbor of the sender, it stays
+ * pending until the link delay expired and the receiver read the frame.
+ */
+#ifndef CONFIG_NETSIM_DELIVERY_NUMOF
+#define CONFIG_NETSIM_DELIVERY_NUMOF    (256U)
+#endif
+
+/**
+ * @brief   Priority of the simulator thread
+ */
+#ifndef CONFIG_NETSIM_PRIO
+#define CONFIG_NETSIM_PRIO              (THREAD_PRIORITY_MAIN - 2)
+#endif
+
+/**
+ * @brief   Stack size of the simulator thread
+ */
+#ifndef CONFIG_NETSIM_STACKSIZE
+#define CONFIG_NETSIM_STACKSIZE         (THREAD_STACKSIZE_DEFAULT)
+#endif
+/** @} */
+
+/**
+ * @brief   Properties of a directed link between two nodes
+ */
+typedef struct {
+    uint32_t delay_us;          /**< time from sending until reception */
+    uint16_t loss;              /**< loss probability in 1/1000 */
+} netsim_link_t;
+
+/**
+ * @brief   Simulation descriptor
+ */
+typedef struct netsim netsim_t;
+
+/**
+ * @brief   Simulation node descriptor
+ */
+typedef struct netsim_node netsim_node_t;
+
+/**
+ * @brief   Link model
+ *
+ * @param[in]   sim     the simulation
+ * @param[in]   src     index of the sending node
+ * @param[in]   dst     index of the receiving node, never equal to @p src
+ * @param[out]  link    properties of the link from @p src to @p dst
+ *
+ * @return  true, if @p dst can hear @p src
+ * @return  false, otherwise
+ */
+typedef bool (*netsim_link_cb_t)(const netsim_t *sim, unsigned src,
+                                 unsigned dst, netsim_link_t *link);
+
+/**
+ * @brief   A frame in flight
+ */
+typedef struct {
+    uint32_t origin_us;             /**< time the frame was first sent */
+    uint16_t src;                   /**< index of the last sender */
+    uint16_t len;                   /**< length of netsim_frame_t::data */
+    uint16_t refs;                  /**< pending deliveries of the frame */
+    uint8_t data[CONFIG_NETSIM_FRAME_SIZE]; /**< frame content */
+} netsim_frame_t;
+
+/**
+ * @brief   Receive callback of a node in raw mode
+ *
+ * Called in the thread of the simulation. The frame is only valid during
+ * the call, but may be passed to @ref netsim_forward.
+ *
+ * @param[in]   node    the receiving node
+ * @param[in]   frame   the received frame
+ */
+typedef void (*netsim_rx_cb_t)(netsim_node_t *node, const netsim_frame_t *frame);
+
+/**
+ * @brief   Statistics of a node
+ */
+typedef struct {
+    uint32_t tx;                /**< frames sent */
+    uint32_t tx_failed;         /**< frames not sent for lack of buffers */
+    uint32_t rx;                /**< frames received */
+    uint32_t lost;              /**< frames to this node lost on the link */
+    uint32_t dropped;           /**< frames to this node dropped for lack of
+                                     buffers */
+    uint16_t queued;            /**< frames waiting for this node to read them */
+    uint16_t queued_max;        /**< maximum of netsim_stats_t::queued */
+    uint32_t latency_max_us;    /**< maximum end-to-end latency */
+    uint64_t latency_sum_us;    /**< sum of all end-to-end latencies */
+} netsim_stats_t;
+
+/**
+ * @brief   Pending delivery of a frame to a node (internal)
+ */
+typedef struct netsim_delivery {
+    struct netsim_delivery *next;   /**< next in the medium or node queue */
+    netsim_frame_t *frame;          /**< frame to deliver */
+    uint32_t due_us;                /**< time of the delivery */
+    uint16_t dst;                   /**< index of the receiving node */
+} netsim_delivery_t;
+
+/**
+ * @brief   Simulation node descriptor
+ */
+struct netsim_node {
+    netdev_test_t dev;              /**< the virtual radio, must be first */
+    netsim_t *sim;                  /**< simulation of the node */
+    netsim_rx_cb_t rx_cb;           /**< receive callback in raw mode */
+    void *arg;                      /**< argument for the receive callback */
+    netsim_delivery_t *rx_queue;    /**< frames waiting to be read */
+    netsim_stats_t stats;           /**< statistics of the node */
+    uint16_t id;                    /**< index of the node */
+};
+
+/**
+ * @brief   Simulation descriptor
+ */
+struct netsim {
+    netsim_node_t *nodes;           /**< the nodes */
+    unsigned numof;                 /**< number of nodes */
+    netsim_link_cb_t link_cb;       /**< link model */
+    const void *link_arg;           /**< argument of the link model */
+    netsim_delivery_t *pending;     /**< deliveries sorted by due time */
+    netsim_delivery_t *free;        /**< unused deliveries */
+    mutex_t lock;                   /**< protects the simulation state */
+    uint32_t prng;                  /**< state of the loss PRNG */
+    kernel_pid_t pid;               /**< simulator thread */
+    /** frame buffers, unused while netsim_frame_t::refs is 0 */
+    netsim_frame_t frames[CONFIG_NETSIM_FRAME_NUMOF];
+    /** delivery buffers */
+    netsim_delivery_t deliveries[CONFIG_NETSIM_DELIVERY_NUMOF];
+    char stack[CONFIG_NETSIM_STACKSIZE]; /**< stack of the simulator thread */
+};
+
+/**
+ * @brief   Argument of @ref netsim_link_grid
+ */
+typedef struct {
+    unsigned width;                 /**< number of nodes per row */
+    netsim_link_t link;             /**< properties of every link */
+} netsim_grid_t;
+
+/**
+ * @brief   Link model connecting all nodes
+ *
+ * The argument of the link model must be a `const netsim_link_t *`, which
+ * is used for every link.
+ */
+bool netsim_link_full(const netsim_t *sim, unsigned src, unsigned dst,
+                      netsim_link_t *link);
+
+/**
+ * @brief   Link model connecting each node to its horizontal and vertical
+ *          neighbors in a grid
+ *
+ * The argument of the link model must be a `const netsim_grid_t *`. Node
+ * `i` is placed in row `i / width` and column `i % width`. A grid of width 1
+ * is a line.
+ */
+bool netsim_link_grid(const netsim_t *sim, unsigned src, unsigned dst,
+                      netsim_link_t *link);
+
+/**
+ * @brief   Initialize a simulation and start its thread
+ *
+ * @param[out]  sim         simulation to initialize
+ * @param[out]  nodes       nodes to initialize
+ * @param[in]   numof       number of entries in @p nodes
+ * @param[in]   link_cb     link model
+ * @param[in]   link_arg    argument of @p link_cb, see netsim_t::link_arg
+ * @param[in]   seed        seed of the PRNG deciding about losses
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p numof is 0 or does not fit into 16 bits
+ * @return  negative errno if the thread could not be created
+ */
+int netsim_init(netsim_t *sim, netsim_node_t *nodes, unsigned numof,
+                netsim_link_cb_t link_cb, const void *link_arg,
+                uint32_t seed);
+
+/**
+ * @brief   Get the network device of a node
+ *
+ * @param[in]   node    the node
+ *
+ * @return  network device to attach to a network stack
+ */
+static inline netdev_t *netsim_node_netdev(netsim_node_t *node)
+{
+    return &node->dev.netdev.netdev;
+}
+
+/**
+ * @brief   Put a node into raw mode
+ *
+ * @param[in]   node    the node
+ * @param[in]   cb      receive callback
+ * @param[in]   arg     argument for @p cb, see netsim_node_t::arg
+ */
+void netsim_node_set_rx_cb(netsim_node_t *node, netsim_rx_cb_t cb, void *arg);
+
+/**
+ * @brief   Send a frame from a node to all nodes that hear it
+ *
+ * @param[in]   node    the sending node
+ * @param[in]   data    frame content
+ * @param[in]   len     length of @p data
+ *
+ * @return  @p len on success
+ * @return  -EMSGSIZE if @p len exceeds @ref CONFIG_NETSIM_FRAME_SIZE
+ * @return  -ENOBUFS if no frame buffer was available
+ */
+int netsim_send(netsim_node_t *node, const void *data, size_t len);
+
+/**
+ * @brief   Resend a received frame from a node, keeping its origin time
+ *
+ * @param[in]   node    the sending node
+ * @param[in]   frame   frame passed to the receive callback
+ *
+ * @return  length of the frame on success
+ * @return  -ENOBUFS if no frame buffer was available
+ */
+int netsim_forward(netsim_node_t *node, const netsim_frame_t *frame);
+
+/**
+ * @brief   Get the statistics of a node
+ *
+ * @param[in]   node    the node
+ * @param[out]  stats   the statistics
+ */
+void netsim_get_stats(netsim_node_t *node, netsim_stats_t *stats);
+
+/**
+ * @brief   Reset the statistics of all nodes
+ *
+ * @param[in]   sim     the simulation
+ */
+void netsim_reset_stats(netsim_t *sim);
+
+/**
+ * @brief   Print a table of the statistics of all nodes
+ *
+ * @param[in]   sim     the simulation
+ */
+void netsim_print_stats(netsim_t *sim);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
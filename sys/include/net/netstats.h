@@ -43,6 +43,20 @@ extern "C" {
 #define NETSTATS_NB_QUEUE_SIZE  (4)
 #endif
 
+/**
+ * @brief   The number of time windows in the throughput history of a peer
+ */
+#ifndef NETSTATS_NB_HISTORY_SIZE
+#define NETSTATS_NB_HISTORY_SIZE    (4)
+#endif
+
+/**
+ * @brief   The length of a time window of the throughput history in seconds
+ */
+#ifndef NETSTATS_NB_HISTORY_WINDOW
+#define NETSTATS_NB_HISTORY_WINDOW  (10)
+#endif
+
 /**
  * @name @ref net_netstats module names
  * @{
@@ -50,6 +64,7 @@ extern "C" {
 #define NETSTATS_LAYER2     (0x01)
 #define NETSTATS_IPV6       (0x02)
 #define NETSTATS_RPL        (0x03)
+#define NETSTATS_FQ         (0x04)
 #define NETSTATS_ALL        (0xFF)
 /** @} */
 
@@ -69,6 +84,20 @@ typedef struct {
     uint32_t rx_bytes;          /**< received bytes */
 } netstats_t;
 
+/**
+ * @brief       Statistics of a flow queue of @ref net_gnrc_netif_pktq
+ *
+ * Retrieved by @ref NETOPT_STATS with @ref NETSTATS_FQ as an array with one
+ * entry per flow queue of the interface.
+ */
+typedef struct {
+    uint32_t delay_avg;         /**< moving average of the queueing delay of
+                                     dequeued packets in µs */
+    uint32_t delay_max;         /**< maximum queueing delay in µs */
+    uint32_t tx_count;          /**< dequeued packets */
+    uint32_t drop_count;        /**< packets dropped by the queue */
+} netstats_fq_t;
+
 /**
  * @brief       Stats per peer struct
  */
@@ -83,6 +112,21 @@ typedef struct {
     uint16_t tx_count;      /**< Number of sent frames to this peer */
     uint16_t tx_fail;       /**< Number of sent frames that did not get ACKed */
     uint16_t rx_count;      /**< Number of received frames */
+    uint16_t tx_retries;    /**< Number of retransmissions to this peer */
+    uint16_t tx_busy;       /**< Number of frames to this peer that were not
+                                 sent because the medium was busy */
+#endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_TRAFFIC) || DOXYGEN
+    uint32_t tx_bytes;      /**< Bytes sent to this peer */
+    uint32_t rx_bytes;      /**< Bytes received from this peer */
+    /**
+     * @brief Bytes sent to and received from this peer per time window
+     *
+     * Element 0 is the current window, element i the window i windows ago.
+     * Each window is @ref NETSTATS_NB_HISTORY_WINDOW seconds long.
+     */
+    uint32_t history[NETSTATS_NB_HISTORY_SIZE];
+    uint16_t history_window; /**< Number of netstats_nb_t::history[0] */
 #endif
     uint16_t last_updated;  /**< seconds timestamp of last update */
     uint16_t last_halved;   /**< seconds timestamp of last halving */
@@ -116,6 +160,13 @@ typedef struct {
      */
     uint32_t stats_queue_time_tx[NETSTATS_NB_QUEUE_SIZE];
 
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_TRAFFIC) || DOXYGEN
+    /**
+     * @brief Frame length of stats_queue entries
+     */
+    uint16_t stats_queue_bytes[NETSTATS_NB_QUEUE_SIZE];
+#endif
+
     /**
      * @brief Per neighbor statistics array
      */
@@ -108,6 +108,28 @@ typedef enum {
 #define NETSTATS_NB_TX_TIMEOUT_MS         100
 /** @} */
 
+/**
+ * @brief Map keys of the CBOR encoding of a neighbor stat
+ *
+ * @see netstats_nb_to_cbor
+ */
+typedef enum {
+    NETSTATS_NB_CBOR_L2_ADDR = 0,   /**< netstats_nb_t::l2_addr as byte string */
+    NETSTATS_NB_CBOR_FRESHNESS,     /**< netstats_nb_t::freshness, 0 if stale */
+    NETSTATS_NB_CBOR_ETX,           /**< netstats_nb_t::etx */
+    NETSTATS_NB_CBOR_TX_COUNT,      /**< netstats_nb_t::tx_count */
+    NETSTATS_NB_CBOR_TX_FAIL,       /**< netstats_nb_t::tx_fail */
+    NETSTATS_NB_CBOR_TX_RETRIES,    /**< netstats_nb_t::tx_retries */
+    NETSTATS_NB_CBOR_TX_BUSY,       /**< netstats_nb_t::tx_busy */
+    NETSTATS_NB_CBOR_RX_COUNT,      /**< netstats_nb_t::rx_count */
+    NETSTATS_NB_CBOR_RSSI,          /**< netstats_nb_t::rssi in [dBm] */
+    NETSTATS_NB_CBOR_LQI,           /**< netstats_nb_t::lqi */
+    NETSTATS_NB_CBOR_TX_TIME,       /**< netstats_nb_t::time_tx_avg */
+    NETSTATS_NB_CBOR_TX_BYTES,      /**< netstats_nb_t::tx_bytes */
+    NETSTATS_NB_CBOR_RX_BYTES,      /**< netstats_nb_t::rx_bytes */
+    NETSTATS_NB_CBOR_HISTORY,       /**< netstats_nb_t::history as array */
+} netstats_nb_cbor_key_t;
+
 /**
  * @brief Initialize the neighbor stats
  *
@@ -137,9 +159,11 @@ bool netstats_nb_get(netif_t *netif, const uint8_t *l2_addr, uint8_t len, netsta
  * @param[in] netif     network interface descriptor
  * @param[in] l2_addr   pointer to the L2 address
  * @param[in] len       length of the L2 address
+ * @param[in] frame_len number of bytes to send
  *
  */
-void netstats_nb_record(netif_t *netif, const uint8_t *l2_addr, uint8_t len);
+void netstats_nb_record(netif_t *netif, const uint8_t *l2_addr, uint8_t len,
+                        size_t frame_len);
 
 /**
  * @brief Update the next recorded neighbor with the provided numbers
@@ -167,11 +191,54 @@ netstats_nb_t *netstats_nb_update_tx(netif_t *netif, netstats_nb_result_t result
  * @param[in] l2_addr_len  length of the L2 address
  * @param[in] rssi         RSSI of the received transmission in abs([dBm])
  * @param[in] lqi          Link Quality Indication provided by the radio
+ * @param[in] frame_len    number of bytes received
  *
  * @return pointer to the updated record
  */
 netstats_nb_t *netstats_nb_update_rx(netif_t *netif, const uint8_t *l2_addr,
-                                     uint8_t l2_addr_len, uint8_t rssi, uint8_t lqi);
+                                     uint8_t l2_addr_len, uint8_t rssi, uint8_t lqi,
+                                     size_t frame_len);
+
+/**
+ * @brief Copy the next neighbor stat in use
+ *
+ * Only takes the lock of the neighbor table while copying a single entry, so
+ * the statistics can be polled while the interface is sending. Entries are
+ * copied one by one, so they are not a consistent snapshot of the whole table.
+ *
+ * @code{.c}
+ * netstats_nb_t stats;
+ * unsigned state = 0;
+ *
+ * while (netstats_nb_iter(netif, &state, &stats)) {
+ *     ...
+ * }
+ * @endcode
+ *
+ * @param[in] netif      network interface descriptor
+ * @param[in,out] state  iteration state, set to 0 to start at the first entry
+ * @param[out] out       destination for the neighbor entry
+ *
+ * @return true if an entry was copied to @p out, false after the last entry
+ */
+bool netstats_nb_iter(netif_t *netif, unsigned *state, netstats_nb_t *out);
+
+/**
+ * @brief Encode the neighbor stats of an interface as CBOR
+ *
+ * Requires the `netstats_neighbor_cbor` module. The stats are encoded as an
+ * array with a map per neighbor, using the keys of
+ * @ref netstats_nb_cbor_key_t. Keys of statistics that are not compiled in
+ * are left out. The buffer can be the payload of a CoAP response.
+ *
+ * @param[in] netif     network interface descriptor
+ * @param[out] buf      buffer to encode to
+ * @param[in] len       length of @p buf
+ *
+ * @return number of bytes written to @p buf
+ * @return -ENOBUFS if @p buf is too small
+ */
+int netstats_nb_to_cbor(netif_t *netif, uint8_t *buf, size_t len);
 
 /**
  * @brief Check if a record is fresh
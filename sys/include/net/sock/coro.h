@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup        net_sock_coro   Sock with stackless coroutines
+ * @ingroup         net_sock
+ * @brief           Waits for socks within @ref event/coro.h "coroutines"
+ *
+ * A thread blocking in `sock_udp_recv()` needs a stack of its own per
+ * session, and with @ref net_sock_async_event the state of a session is spread
+ * across callbacks. With this module, a session is written as a coroutine that
+ * reads like blocking code, but only needs a few bytes of state. Hundreds of
+ * sessions can run on one event thread.
+ *
+ * A sock is attached to the coroutine waiting for it with e.g.
+ * @ref sock_udp_coro_attach. Each event of the sock then wakes up the
+ * coroutine, which retries the operation with a timeout of 0 in
+ * @ref SOCK_CORO_AWAIT until it no longer returns `-EAGAIN`.
+ *
+ * Example, an echo client sending three requests:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * typedef struct {
+ *     event_coro_t coro;
+ *     sock_udp_t sock;
+ *     sock_udp_ep_t remote;
+ *     unsigned round;
+ *     ssize_t res;
+ *     uint8_t buf[32];
+ * } client_t;
+ *
+ * static int _client(event_coro_t *coro)
+ * {
+ *     client_t *c = container_of(coro, client_t, coro);
+ *
+ *     EVENT_CORO_BEGIN(coro);
+ *     sock_udp_create(&c->sock, NULL, &c->remote, 0);
+ *     sock_udp_coro_attach(&c->sock, coro);
+ *     for (c->round = 0; c->round < 3; c->round++) {
+ *         sock_udp_send(&c->sock, "ping", 4, NULL);
+ *         SOCK_CORO_AWAIT_TIMEOUT(coro, c->res,
+ *                                 sock_udp_recv(&c->sock, c->buf,
+ *                                               sizeof(c->buf), 0, NULL),
+ *                                 ZTIMER_MSEC, 1000);
+ *         if (c->res == -ETIMEDOUT) {
+ *             break;
+ *         }
+ *     }
+ *     sock_udp_close(&c->sock);
+ *     EVENT_CORO_END(coro);
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * Use the `sock_coro` module and a sock implementation supporting
+ * @ref net_sock_async, e.g. `gnrc_sock_async`.
+ *
+ * @warning As with @ref net_sock_async_event, a sock attached to a coroutine
+ *          may only be closed from the thread running the coroutine.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Sock with stackless coroutines definitions
+ */
+
+#include <errno.h>
+
+#include "event/coro.h"
+
+#ifdef MODULE_SOCK_DTLS
+#include "net/sock/dtls.h"
+#endif
+#include "net/sock/ip.h"
+#include "net/sock/tcp.h"
+#include "net/sock/udp.h"
+#include "net/sock/async.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Wait until @p call no longer returns `-EAGAIN`
+ *
+ * @p call is a sock operation with a timeout of 0 whose result is stored in
+ * @p res. It is retried each time the coroutine is woken up.
+ */
+#define SOCK_CORO_AWAIT(coro, res, call) \
+    EVENT_CORO_WAIT_UNTIL(coro, ((res) = (call)) != -EAGAIN)
+
+#if IS_USED(MODULE_ZTIMER) || defined(DOXYGEN)
+/**
+ * @brief   Like @ref SOCK_CORO_AWAIT, but give up after @p timeout ticks of
+ *          @p clock
+ *
+ * @p res is `-ETIMEDOUT` if the timeout expired.
+ */
+#define SOCK_CORO_AWAIT_TIMEOUT(coro, res, call, clock, timeout) \
+    do { \
+        EVENT_CORO_WAIT_UNTIL_TIMEOUT(coro, ((res) = (call)) != -EAGAIN, \
+                                      clock, timeout); \
+        if ((res) == -EAGAIN) { \
+            (res) = -ETIMEDOUT; \
+        } \
+    } while (0)
+#endif
+
+#ifndef DOXYGEN
+/* wakes up the coroutine on any event of the sock, the retried call finds
+ * out what happened */
+#define _SOCK_CORO_CB(type) \
+    static inline void _sock_coro_##type##_cb(type##_t *sock, \
+                                              sock_async_flags_t flags, \
+                                              void *arg) \
+    { \
+        (void)sock; \
+        (void)flags; \
+        event_coro_wake(arg); \
+    }
+#endif
+
+#if defined(MODULE_SOCK_DTLS) || defined(DOXYGEN)
+#ifndef DOXYGEN
+_SOCK_CORO_CB(sock_dtls)
+#endif
+
+/**
+ * @brief   Wake up @p coro on events of a DTLS sock
+ *
+ * @param[in]   sock    A DTLS sock object
+ * @param[in]   coro    The coroutine to wake up, or NULL to detach
+ */
+static inline void sock_dtls_coro_attach(sock_dtls_t *sock, event_coro_t *coro)
+{
+    sock_dtls_set_cb(sock, coro ? _sock_coro_sock_dtls_cb : NULL, coro);
+}
+#endif
+
+#if defined(MODULE_SOCK_IP) || defined(DOXYGEN)
+#ifndef DOXYGEN
+_SOCK_CORO_CB(sock_ip)
+#endif
+
+/**
+ * @brief   Wake up @p coro on events of a raw IP sock
+ *
+ * @param[in]   sock    A raw IP sock object
+ * @param[in]   coro    The coroutine to wake up, or NULL to detach
+ */
+static inline void sock_ip_coro_attach(sock_ip_t *sock, event_coro_t *coro)
+{
+    sock_ip_set_cb(sock, coro ? _sock_coro_sock_ip_cb : NULL, coro);
+}
+#endif
+
+#if defined(MODULE_SOCK_TCP) || defined(DOXYGEN)
+#ifndef DOXYGEN
+_SOCK_CORO_CB(sock_tcp)
+_SOCK_CORO_CB(sock_tcp_queue)
+#endif
+
+/**
+ * @brief   Wake up @p coro on events of a TCP sock
+ *
+ * @param[in]   sock    A TCP sock object
+ * @param[in]   coro    The coroutine to wake up, or NULL to detach
+ */
+static inline void sock_tcp_coro_attach(sock_tcp_t *sock, event_coro_t *coro)
+{
+    sock_tcp_set_cb(sock, coro ? _sock_coro_sock_tcp_cb : NULL, coro);
+}
+
+/**
+ * @brief   Wake up @p coro on events of a TCP listening queue
+ *
+ * @param[in]   queue   A TCP listening queue
+ * @param[in]   coro    The coroutine to wake up, or NULL to detach
+ */
+static inline void sock_tcp_queue_coro_attach(sock_tcp_queue_t *queue,
+                                              event_coro_t *coro)
+{
+    sock_tcp_queue_set_cb(queue, coro ? _sock_coro_sock_tcp_queue_cb : NULL,
+                          coro);
+}
+#endif
+
+#if defined(MODULE_SOCK_UDP) || defined(DOXYGEN)
+#ifndef DOXYGEN
+_SOCK_CORO_CB(sock_udp)
+#endif
+
+/**
+ * @brief   Wake up @p coro on events of a UDP sock
+ *
+ * @param[in]   sock    A UDP sock object
+ * @param[in]   coro    The coroutine to wake up, or NULL to detach
+ */
+static inline void sock_udp_coro_attach(sock_udp_t *sock, event_coro_t *coro)
+{
+    sock_udp_set_cb(sock, coro ? _sock_coro_sock_udp_cb : NULL, coro);
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
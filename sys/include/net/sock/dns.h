@@ -92,6 +92,13 @@ extern "C" {
  * This function will return the first DNS record it receives. IF both A and
  * AAAA are requested, AAAA will be preferred.
  *
+ * With the `dns_cache` module, all addresses of the response are cached, as
+ * well as negative responses (see [RFC 2308](https://tools.ietf.org/html/rfc2308)).
+ *
+ * With the `sock_dns_coalesce` module, concurrent calls for the same
+ * @p domain_name and @p family share a single query to the DNS server.
+ * Calls for other names wait until the pending query is finished.
+ *
  * @note @p addr_out needs to provide space for any possible result!
  *       (4byte when family==AF_INET, 16byte otherwise)
  *
@@ -100,6 +107,7 @@ extern "C" {
  * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
  *
  * @return      the size of the resolved address on success
+ * @return      -ENOENT if @p domain_name has no address of @p family
  * @return      < 0 otherwise
  */
 int sock_dns_query(const char *domain_name, void *addr_out, int family);
@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_sched_accounting Scheduler latency accounting
+ * @ingroup     sys
+ * @brief       Per thread wakeup latency, blocking and preemption accounting
+ *
+ * @ref schedstatistics records how long each thread ran. This module adds
+ * where the rest of the time went, per thread:
+ *
+ * - the latency from a thread becoming runnable until it actually runs, as
+ *   a histogram with power of two buckets, plus sum and maximum
+ * - the time spent blocked, split by the reason for blocking
+ *   (@ref sched_accounting_block_t)
+ * - the number of times a thread was switched out while still runnable,
+ *   i.e. preempted by a higher priority thread or yielding
+ *
+ * Additionally, the number of interrupts and the time spent handling them
+ * is recorded, if the CPU port calls @ref sched_accounting_isr_enter and
+ * @ref sched_accounting_isr_exit. Currently, only `native` does.
+ *
+ * The accounting is done in the scheduler hooks with interrupts disabled and
+ * costs one timer read per status change of a thread, so it can stay enabled
+ * in production. It uses
+ * `(KERNEL_PID_LAST + 1) * sizeof(sched_accounting_t)` bytes of RAM, which
+ * can be reduced with @ref CONFIG_SCHED_ACCOUNTING_HIST_NUMOF.
+ *
+ * The counters of a PID are reset when a new thread is created with it.
+ * Use @ref sched_accounting_get to query them, or the `schedacct` shell
+ * command.
+ *
+ * @note    @ref ztimer_sleep and most other timeouts block on a mutex and
+ *          are thus accounted as @ref SCHED_ACCOUNTING_BLOCK_MUTEX.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Scheduler latency accounting API
+ */
+
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_sched_accounting_conf  Scheduler latency accounting configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of buckets of the wakeup latency histogram
+ *
+ * Bucket 0 counts latencies of 0 µs, bucket n > 0 counts latencies in
+ * [2^(n-1), 2^n) µs. The last bucket also counts all longer latencies.
+ */
+#ifndef CONFIG_SCHED_ACCOUNTING_HIST_NUMOF
+#define CONFIG_SCHED_ACCOUNTING_HIST_NUMOF  (16U)
+#endif
+/** @} */
+
+/**
+ * @brief   Reasons for a thread to block
+ */
+typedef enum {
+    SCHED_ACCOUNTING_BLOCK_MUTEX,   /**< waiting for a mutex */
+    SCHED_ACCOUNTING_BLOCK_MSG,     /**< waiting to send or receive a message */
+    SCHED_ACCOUNTING_BLOCK_FLAGS,   /**< waiting for thread flags */
+    SCHED_ACCOUNTING_BLOCK_SLEEP,   /**< sleeping in @ref thread_sleep */
+    SCHED_ACCOUNTING_BLOCK_OTHER,   /**< e.g. waiting for a condition variable */
+    SCHED_ACCOUNTING_BLOCK_NUMOF,   /**< number of reasons */
+} sched_accounting_block_t;
+
+/**
+ * @brief   Accounting data of a thread
+ */
+typedef struct {
+    uint32_t wakeups;               /**< number of times the thread became
+                                         runnable */
+    uint32_t preemptions;           /**< number of times the thread was
+                                         switched out while runnable */
+    uint64_t latency_sum_us;        /**< sum of all wakeup latencies */
+    uint32_t latency_max_us;        /**< longest wakeup latency */
+    /** wakeup latency histogram */
+    uint32_t latency_hist[CONFIG_SCHED_ACCOUNTING_HIST_NUMOF];
+    /** time spent blocked per reason */
+    uint64_t blocked_us[SCHED_ACCOUNTING_BLOCK_NUMOF];
+} sched_accounting_t;
+
+/**
+ * @brief   Interrupt accounting data
+ */
+typedef struct {
+    uint32_t count;                 /**< number of interrupts handled */
+    uint32_t max_us;                /**< longest time spent in an interrupt */
+    uint64_t time_us;               /**< total time spent in interrupts */
+} sched_accounting_isr_t;
+
+/**
+ * @brief   Get the accounting data of a thread
+ *
+ * The data of the thread currently blocking is updated when it is woken up,
+ * so a long block is not yet included.
+ *
+ * @param[in]   pid     PID of the thread
+ * @param[out]  stats   accounting data
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p pid is not a valid PID
+ */
+int sched_accounting_get(kernel_pid_t pid, sched_accounting_t *stats);
+
+/**
+ * @brief   Get the interrupt accounting data
+ *
+ * @param[out]  stats   accounting data
+ */
+void sched_accounting_get_isr(sched_accounting_isr_t *stats);
+
+/**
+ * @brief   Reset all counters
+ */
+void sched_accounting_reset(void);
+
+/**
+ * @brief   Get the upper bound of a histogram bucket
+ *
+ * @param[in]   bucket  index of the bucket
+ *
+ * @return  the smallest latency in µs that is not counted in @p bucket,
+ *          UINT32_MAX for the last bucket
+ */
+static inline uint32_t sched_accounting_hist_limit(unsigned bucket)
+{
+    return (bucket + 1 < CONFIG_SCHED_ACCOUNTING_HIST_NUMOF)
+           ? (1UL << bucket) : UINT32_MAX;
+}
+
+/**
+ * @brief   Signal the start of an interrupt handler
+ *
+ * To be called by the CPU port.
+ */
+void sched_accounting_isr_enter(void);
+
+/**
+ * @brief   Signal the end of an interrupt handler
+ *
+ * To be called by the CPU port.
+ */
+void sched_accounting_isr_exit(void);
+
+/**
+ * @brief   Account a context switch
+ *
+ * @internal    Called by @ref schedstatistics, see @ref sched_callback_t
+ *
+ * @param[in]   active  PID of the thread switched out
+ * @param[in]   next    PID of the thread switched in
+ * @param[in]   now     current time in µs
+ */
+void sched_accounting_switch(kernel_pid_t active, kernel_pid_t next,
+                             uint32_t now);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
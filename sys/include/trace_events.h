@@ -0,0 +1,258 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_trace_events Binary event tracer
+ * @ingroup     sys
+ * @brief       Low overhead binary tracing of kernel and network events
+ *
+ * Unlike @ref trace.h, which records a user value into a buffer that is
+ * printed as text, this module records fixed size binary records into a
+ * ring buffer that is meant to be read out by a host tool. Each record
+ * carries an event ID, a timestamp in microseconds and a small payload.
+ *
+ * Events are emitted through compile-time tracepoints (@ref TRACE_EVENT).
+ * Without the `trace_events` module they compile to nothing, with the module
+ * each class of events can still be disabled using
+ * @ref CONFIG_TRACE_EVENTS_MASK. The following tracepoints are built in:
+ *
+ * | Event                            | arg0                   | arg1                   |
+ * |:-------------------------------- |:---------------------- |:---------------------- |
+ * | @ref TRACE_EVENT_SCHED_SWITCH    | PID of the next thread | PID of the last thread |
+ * | @ref TRACE_EVENT_ISR_ENTER       | IRQ number             | -                      |
+ * | @ref TRACE_EVENT_ISR_EXIT        | IRQ number             | -                      |
+ * | @ref TRACE_EVENT_MSG_SEND        | target PID             | message type           |
+ * | @ref TRACE_EVENT_MSG_RECV        | sender PID             | message type           |
+ * | @ref TRACE_EVENT_MUTEX_CONTENDED | PID of the owner (1)   | address of the mutex   |
+ * | @ref TRACE_EVENT_PKTBUF_ALLOC    | size                   | address of the chunk   |
+ * | @ref TRACE_EVENT_PKTBUF_FREE     | size                   | address of the chunk   |
+ *
+ * (1) only with `core_mutex_priority_inheritance` or `core_mutex_debug`,
+ * @ref KERNEL_PID_UNDEF otherwise.
+ *
+ * ISR tracepoints depend on the CPU port, currently only `native` provides
+ * them.
+ *
+ * Writing a record is lock-free: a writer reserves a slot by atomically
+ * incrementing the head of the ring and marks the slot as valid once it is
+ * filled. Any number of readers (@ref trace_events_read) can follow the
+ * ring independently, records that got overwritten before a reader got to
+ * them are reported as lost.
+ *
+ * The memory of the ring is provided by a backend. By default, the ring is
+ * a static buffer of @ref CONFIG_TRACE_EVENTS_NUMOF records. On `native`,
+ * the `trace_events_mmap` module places the ring into a memory mapped file
+ * (see the `--trace-file` command line option), which can be read while the
+ * application is running. `dist/tools/trace_events/trace_events.py`
+ * converts the ring into Common Trace Format or into a JSON trace that can
+ * be opened with Perfetto.
+ *
+ * RIOT schedules a single CPU, so there is one ring.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Binary event tracer API
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "modules.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_trace_events_conf  Binary event tracer configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of records in the static ring buffer
+ *
+ * Must be a power of two.
+ */
+#ifndef CONFIG_TRACE_EVENTS_NUMOF
+#define CONFIG_TRACE_EVENTS_NUMOF   (256)
+#endif
+
+/**
+ * @brief   Bitmask of the event IDs that are recorded
+ *
+ * Bit n enables the tracepoints of event ID n, tracepoints of disabled
+ * events are removed at compile time.
+ */
+#ifndef CONFIG_TRACE_EVENTS_MASK
+#define CONFIG_TRACE_EVENTS_MASK    (0xffffffffUL)
+#endif
+/** @} */
+
+/**
+ * @brief   Magic number at the start of a ring ("RTRC")
+ */
+#define TRACE_EVENTS_MAGIC          (0x43525452UL)
+
+/**
+ * @brief   Version of the ring layout
+ */
+#define TRACE_EVENTS_VERSION        (1)
+
+/**
+ * @brief   Event IDs
+ */
+typedef enum {
+    TRACE_EVENT_USER,               /**< user defined event */
+    TRACE_EVENT_SCHED_SWITCH,       /**< the scheduler switched threads */
+    TRACE_EVENT_ISR_ENTER,          /**< an interrupt handler is entered */
+    TRACE_EVENT_ISR_EXIT,           /**< an interrupt handler returned */
+    TRACE_EVENT_MSG_SEND,           /**< a message was sent */
+    TRACE_EVENT_MSG_RECV,           /**< a message was received */
+    TRACE_EVENT_MUTEX_CONTENDED,    /**< a thread blocks on a locked mutex */
+    TRACE_EVENT_PKTBUF_ALLOC,       /**< packet buffer memory was allocated */
+    TRACE_EVENT_PKTBUF_FREE,        /**< packet buffer memory was freed */
+    TRACE_EVENT_NUMOF,              /**< number of built-in events */
+} trace_event_id_t;
+
+/**
+ * @brief   A single record in the ring
+ */
+typedef struct {
+    uint32_t seq;       /**< position in the stream + 1, 0 while written */
+    uint32_t time;      /**< timestamp in microseconds */
+    uint16_t id;        /**< event ID */
+    uint16_t arg0;      /**< first payload value */
+    uint32_t arg1;      /**< second payload value */
+} trace_event_t;
+
+/**
+ * @brief   Ring buffer layout
+ *
+ * All fields are stored in the byte order of the CPU.
+ */
+typedef struct {
+    uint32_t magic;         /**< @ref TRACE_EVENTS_MAGIC */
+    uint16_t version;       /**< @ref TRACE_EVENTS_VERSION */
+    uint16_t record_size;   /**< size of a record in bytes */
+    uint32_t numof;         /**< number of records, a power of two */
+    uint32_t head;          /**< number of records written since start */
+    uint32_t ticks_per_sec; /**< resolution of the timestamps */
+    uint32_t reserved[3];   /**< reserved, aligns the records */
+    trace_event_t records[];    /**< the records */
+} trace_events_ring_t;
+
+/**
+ * @brief   Reader state
+ */
+typedef struct {
+    uint32_t pos;       /**< stream position of the next record to read */
+} trace_events_reader_t;
+
+/**
+ * @brief   Tracepoint
+ *
+ * Records an event if the `trace_events` module is used and @p id is enabled
+ * in @ref CONFIG_TRACE_EVENTS_MASK. Otherwise, this does not generate any
+ * code.
+ *
+ * @param[in]   id      event ID
+ * @param[in]   arg0    first payload value, truncated to 16 bit
+ * @param[in]   arg1    second payload value, truncated to 32 bit
+ */
+#if IS_USED(MODULE_TRACE_EVENTS) || DOXYGEN
+#define TRACE_EVENT(id, arg0, arg1)                                     \
+    do {                                                                \
+        if (CONFIG_TRACE_EVENTS_MASK & (1UL << (id))) {                 \
+            trace_event((id), (uint16_t)(arg0), (uint32_t)(uintptr_t)(arg1)); \
+        }                                                               \
+    } while (0)
+#else
+#define TRACE_EVENT(id, arg0, arg1) do { } while (0)
+#endif
+
+/**
+ * @brief   Initialize the ring in a memory area
+ *
+ * @param[out]  mem     memory for the ring, word aligned
+ * @param[in]   size    size of @p mem in bytes
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p mem can not hold a single record
+ */
+int trace_events_init(void *mem, size_t size);
+
+/**
+ * @brief   Start recording events
+ *
+ * Called by auto_init once the timestamp source is available.
+ */
+void trace_events_start(void);
+
+/**
+ * @brief   Stop recording events
+ */
+void trace_events_stop(void);
+
+/**
+ * @brief   Record an event
+ *
+ * Safe to call from any context. Use @ref TRACE_EVENT instead of calling this
+ * directly, so the tracepoint can be compiled out.
+ *
+ * @param[in]   id      event ID
+ * @param[in]   arg0    first payload value
+ * @param[in]   arg1    second payload value
+ */
+void trace_event(uint16_t id, uint16_t arg0, uint32_t arg1);
+
+/**
+ * @brief   Get the ring
+ *
+ * @return  the ring, NULL if it is not initialized
+ */
+const trace_events_ring_t *trace_events_ring(void);
+
+/**
+ * @brief   Initialize a reader at the oldest record in the ring
+ *
+ * @param[out]  reader  reader to initialize
+ */
+void trace_events_reader_init(trace_events_reader_t *reader);
+
+/**
+ * @brief   Read the next record
+ *
+ * @param[in,out]   reader  reader state
+ * @param[out]      event   the record
+ *
+ * @return  1 if a record was read
+ * @return  0 if there is no new record
+ * @return  -EOVERFLOW if records were overwritten before they could be read,
+ *          the reader continues at the oldest record still available
+ */
+int trace_events_read(trace_events_reader_t *reader, trace_event_t *event);
+
+/**
+ * @brief   Provide the memory for the ring
+ *
+ * Called once by auto_init. The default implementation returns a static
+ * buffer of @ref CONFIG_TRACE_EVENTS_NUMOF records, backends override it.
+ *
+ * @param[out]  size    size of the memory in bytes
+ *
+ * @return  memory for the ring, NULL if none is available
+ */
+void *trace_events_backend_mem(size_t *size);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
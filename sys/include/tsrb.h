@@ -16,6 +16,22 @@
  *
  * @attention   Buffer size must be a power of two!
  *
+ * All functions can be used by any number of threads and ISRs at the same
+ * time, as they disable interrupts while accessing the ringbuffer. Bulk
+ * transfers copy at most two chunks with `memcpy()`.
+ *
+ * If there is only a single producer and a single consumer, e.g. an ISR
+ * writing and a thread reading, the `tsrb_spsc_*()` functions and the
+ * reserve/commit functions transfer data without disabling interrupts: only
+ * the producer updates tsrb_t::writes and only the consumer updates
+ * tsrb_t::reads. The reserve/commit functions give direct access to the
+ * buffer, e.g. for a DMA transfer into or out of the ringbuffer.
+ *
+ * @warning The lock-free functions must not be mixed with functions that
+ *          change the same index from the other side, e.g. a producer must
+ *          not call @ref tsrb_clear or @ref tsrb_drop while the consumer uses
+ *          @ref tsrb_spsc_get.
+ *
  * @file
  * @brief       Thread-safe ringbuffer interface definition
  *
@@ -198,6 +214,89 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @name    Lock-free single-producer, single-consumer access
+ * @{
+ */
+/**
+ * @brief       Add bytes to ringbuffer, lock-free
+ *
+ * Must only be called by the single producer of @p rb.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   src buffer to read from
+ * @param[in]   n   max number of bytes to read from @p src
+ * @return      nr of bytes read from @p src
+ */
+int tsrb_spsc_add(tsrb_t *rb, const uint8_t *src, size_t n);
+
+/**
+ * @brief       Get bytes from ringbuffer, lock-free
+ *
+ * Must only be called by the single consumer of @p rb.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  dst buffer to write to
+ * @param[in]   n   max number of bytes to write to @p dst
+ * @return      nr of bytes written to @p dst
+ */
+int tsrb_spsc_get(tsrb_t *rb, uint8_t *dst, size_t n);
+
+/**
+ * @brief       Get the contiguous free space at the write position
+ *
+ * The producer may write up to the returned number of bytes to @p buf and
+ * then make them available to the consumer with @ref tsrb_write_commit. If
+ * the free space wraps around the end of the buffer, only the part up to the
+ * end is returned, a second call after committing returns the rest.
+ *
+ * Must only be called by the single producer of @p rb.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  buf start of the free space
+ * @return      nr of bytes that may be written to @p buf
+ */
+size_t tsrb_write_reserve(tsrb_t *rb, uint8_t **buf);
+
+/**
+ * @brief       Make bytes written to a reserved area available for reading
+ *
+ * @pre         @p n does not exceed the size returned by the last call of
+ *              @ref tsrb_write_reserve
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes written
+ */
+void tsrb_write_commit(tsrb_t *rb, size_t n);
+
+/**
+ * @brief       Get the contiguous data at the read position
+ *
+ * The consumer may read up to the returned number of bytes from @p buf and
+ * then release them with @ref tsrb_read_commit. If the data wraps around the
+ * end of the buffer, only the part up to the end is returned, a second call
+ * after committing returns the rest.
+ *
+ * Must only be called by the single consumer of @p rb.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  buf start of the data
+ * @return      nr of bytes that may be read from @p buf
+ */
+size_t tsrb_read_reserve(tsrb_t *rb, const uint8_t **buf);
+
+/**
+ * @brief       Release bytes read from a reserved area
+ *
+ * @pre         @p n does not exceed the size returned by the last call of
+ *              @ref tsrb_read_reserve
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes read
+ */
+void tsrb_read_commit(tsrb_t *rb, size_t n);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
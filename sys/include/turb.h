@@ -20,6 +20,8 @@
  * @author      Karl Fessel <karl.fessel@ml-pa.com>
  */
 
+#include <string.h>
+
 #include "tsrb.h"
 
 #ifdef __cplusplus
@@ -102,6 +104,36 @@ static inline uint8_t _turb_peek(tsrb_t *rb, unsigned int idx)
 {
     return rb->buf[(rb->reads + idx) & (rb->size - 1)];
 }
+
+/* copies n bytes starting at the ring position pos to dst, in at most two
+ * chunks */
+static inline void _turb_copy_out(const tsrb_t *rb, unsigned int pos,
+                                  uint8_t *dst, size_t n)
+{
+    unsigned int idx = pos & (rb->size - 1);
+    size_t first = rb->size - idx;
+
+    if (first > n) {
+        first = n;
+    }
+    memcpy(dst, &rb->buf[idx], first);
+    memcpy(dst + first, rb->buf, n - first);
+}
+
+/* copies n bytes from src to the ring starting at position pos, in at most
+ * two chunks */
+static inline void _turb_copy_in(tsrb_t *rb, unsigned int pos,
+                                 const uint8_t *src, size_t n)
+{
+    unsigned int idx = pos & (rb->size - 1);
+    size_t first = rb->size - idx;
+
+    if (first > n) {
+        first = n;
+    }
+    memcpy(&rb->buf[idx], src, first);
+    memcpy(rb->buf, src + first, n - first);
+}
 #endif
 
 /**
@@ -146,12 +178,13 @@ static inline int turb_peek_one(tsrb_t *rb)
  */
 static inline int turb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t cnt = 0;
-    while (n-- && !turb_empty(rb)) {
-        *dst++ = _turb_pop(rb);
-        cnt++;
+    unsigned int avail = turb_avail(rb);
+    if (n > avail) {
+        n = avail;
     }
-    return (int) cnt;
+    _turb_copy_out(rb, rb->reads, dst, n);
+    rb->reads += n;
+    return (int) n;
 }
 
 /**
@@ -164,12 +197,12 @@ static inline int turb_get(tsrb_t *rb, uint8_t *dst, size_t n)
  */
 static inline int turb_peek(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t idx = 0;
     unsigned int avail = turb_avail(rb);
-    while (idx < n && idx != avail) {
-        *dst++ = _turb_peek(rb, idx++);
+    if (n > avail) {
+        n = avail;
     }
-    return (int) idx;
+    _turb_copy_out(rb, rb->reads, dst, n);
+    return (int) n;
 }
 
 /**
@@ -181,12 +214,12 @@ static inline int turb_peek(tsrb_t *rb, uint8_t *dst, size_t n)
  */
 static inline int turb_drop(tsrb_t *rb, size_t n)
 {
-    size_t cnt = 0;
-    while (n-- && !turb_empty(rb)) {
-        _turb_pop(rb);
-        cnt++;
+    unsigned int avail = turb_avail(rb);
+    if (n > avail) {
+        n = avail;
     }
-    return (int) cnt;
+    rb->reads += n;
+    return (int) n;
 }
 
 /**
@@ -217,12 +250,13 @@ static inline int turb_add_one(tsrb_t *rb, uint8_t c)
  */
 static inline int turb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t ret = 0;
-    while (n-- && !turb_full(rb)) {
-        _turb_push(rb, *src++);
-        ret++;
+    unsigned int free = turb_free(rb);
+    if (n > free) {
+        n = free;
     }
-    return (int) ret;
+    _turb_copy_in(rb, rb->writes, src, n);
+    rb->writes += n;
+    return (int) n;
 }
 
 #ifdef __cplusplus
@@ -46,6 +46,13 @@ int isrpipe_write(isrpipe_t *isrpipe, const uint8_t *buf, size_t n)
     return res;
 }
 
+void isrpipe_write_commit(isrpipe_t *isrpipe, size_t n)
+{
+    tsrb_write_commit(&isrpipe->tsrb, n);
+
+    mutex_unlock(&isrpipe->mutex);
+}
+
 int isrpipe_read(isrpipe_t *isrpipe, uint8_t *buffer, size_t count)
 {
     int res;
@@ -15,7 +15,10 @@
  * @}
  */
 
-#include "bitfield.h"
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
 #include "checksum/fletcher32.h"
 #include "mutex.h"
 #include "net/af.h"
@@ -28,9 +31,18 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/*
+ * Positive entries use the address length as type, negative entries
+ * additionally set _TYPE_NEG. A negative entry without address length
+ * covers all address families.
+ */
+#define _TYPE_EMPTY     (0x00)
+#define _TYPE_NEG       (0x80)
+#define _TYPE_LEN_MASK  (0x7f)
+
 static struct dns_cache_entry {
     uint32_t hash;
-    uint32_t expires;
+    uint32_t expires;   /* in ZTIMER_MSEC ticks */
     union {
 #if IS_ACTIVE(CONFIG_DNS_CACHE_A)
         ipv4_addr_t v4;
@@ -39,60 +51,35 @@ static struct dns_cache_entry {
         ipv6_addr_t v6;
 #endif
     } addr;
+    uint8_t type;
 } cache[CONFIG_DNS_CACHE_SIZE];
 static mutex_t cache_mutex = MUTEX_INIT;
+static ztimer_t cache_timer;
+static volatile bool cache_purge_pending;
 
-#if IS_ACTIVE(CONFIG_DNS_CACHE_A) && IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-BITFIELD(cache_is_v6, CONFIG_DNS_CACHE_SIZE);
-
-static inline uint8_t _get_len(unsigned idx)
-{
-    return bf_isset(cache_is_v6, idx) ? 16 : 4;
-}
-#elif IS_ACTIVE(CONFIG_DNS_CACHE_A)
 static inline uint8_t _get_len(unsigned idx)
 {
-    (void)idx;
-    return 4;
+    return cache[idx].type & _TYPE_LEN_MASK;
 }
-#elif IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-static inline uint8_t _get_len(unsigned idx)
+
+static inline bool _is_empty(unsigned idx)
 {
-    (void)idx;
-    return 16;
+    return cache[idx].type == _TYPE_EMPTY;
 }
-#endif
 
-static void _set_len(unsigned idx, uint8_t len)
+static inline bool _is_negative(unsigned idx)
 {
-#if IS_ACTIVE(CONFIG_DNS_CACHE_A) && IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-    if (len == 16) {
-        bf_set(cache_is_v6, idx);
-    } else {
-        bf_unset(cache_is_v6, idx);
-    }
-#else
-    (void)idx;
-    (void)len;
-#endif
+    return cache[idx].type & _TYPE_NEG;
 }
 
-static bool _is_empty(unsigned idx)
+static inline unsigned _home(uint32_t hash)
 {
-    const uint8_t len = _get_len(idx);
-    const uint8_t *addr = (void *)&cache[idx].addr;
-    for (unsigned i = 0; i < len; ++i) {
-        if (addr[i]) {
-            return false;
-        }
-    }
-
-    return true;
+    return hash % CONFIG_DNS_CACHE_SIZE;
 }
 
-static void _set_empty(unsigned idx)
+static inline unsigned _next(unsigned idx)
 {
-    memset(&cache[idx].addr, 0, _get_len(idx));
+    return (idx + 1) % CONFIG_DNS_CACHE_SIZE;
 }
 
 static uint8_t _addr_len(int family)
@@ -103,7 +90,7 @@ static uint8_t _addr_len(int family)
         return sizeof(ipv4_addr_t);
 #endif
 #if IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-   case AF_INET6:
+    case AF_INET6:
         return sizeof(ipv6_addr_t);
 #endif
     case AF_UNSPEC:
@@ -118,90 +105,291 @@ static uint32_t _hash(const void *data, size_t len)
     return fletcher32(data, (len + 1) / 2);
 }
 
+static inline bool _expired(unsigned idx, uint32_t now)
+{
+    return (int32_t)(cache[idx].expires - now) <= 0;
+}
+
+static uint32_t _expires(uint32_t now, uint32_t ttl, uint32_t ttl_max)
+{
+    if (ttl > ttl_max) {
+        ttl = ttl_max;
+    }
+    return now + ttl * MS_PER_SEC;
+}
+
+/*
+ * Removes entry idx from the hash table. Linear probing does not tolerate
+ * holes inside a probe sequence, so entries behind idx are shifted back into
+ * the gap unless they are already located at or behind their home slot.
+ */
+static void _remove(unsigned idx)
+{
+    DEBUG("dns_cache[%u] remove\n", idx);
+    cache[idx].type = _TYPE_EMPTY;
+    for (unsigned j = _next(idx); !_is_empty(j); j = _next(j)) {
+        unsigned home = _home(cache[j].hash);
+        bool stays = (idx <= j) ? ((idx < home) && (home <= j))
+                                : ((idx < home) || (home <= j));
+        if (stays) {
+            continue;
+        }
+        cache[idx] = cache[j];
+        cache[j].type = _TYPE_EMPTY;
+        idx = j;
+    }
+}
+
+static void _purge(uint32_t now)
+{
+    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE;) {
+        if (!_is_empty(i) && _expired(i, now)) {
+            DEBUG("dns_cache[%u] expired\n", i);
+            /* _remove() may shift another entry into slot i */
+            _remove(i);
+            continue;
+        }
+        i++;
+    }
+}
+
+static void _expire_cb(void *arg);
+
+/* (Re-)arms the timer for the entry that expires first */
+static void _arm(uint32_t now)
+{
+    bool armed = false;
+    uint32_t first = 0;
+
+    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
+        if (_is_empty(i)) {
+            continue;
+        }
+        uint32_t left = cache[i].expires - now;
+        if (!armed || (left < first)) {
+            first = left;
+            armed = true;
+        }
+    }
+
+    if (armed) {
+        cache_timer.callback = _expire_cb;
+        ztimer_set(ZTIMER_MSEC, &cache_timer, first);
+    }
+    else {
+        ztimer_remove(ZTIMER_MSEC, &cache_timer);
+    }
+}
+
+static void _expire_cb(void *arg)
+{
+    (void)arg;
+
+    /* the timer fires in interrupt context, so the cache can only be purged
+     * if nobody is using it right now. Otherwise the next user does it. */
+    if (!mutex_trylock(&cache_mutex)) {
+        cache_purge_pending = true;
+        return;
+    }
+
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    _purge(now);
+    _arm(now);
+    mutex_unlock(&cache_mutex);
+}
+
+static uint32_t _lock(void)
+{
+    mutex_lock(&cache_mutex);
+
+    uint32_t now = ztimer_now(ZTIMER_MSEC);
+    if (cache_purge_pending) {
+        cache_purge_pending = false;
+        _purge(now);
+        _arm(now);
+    }
+    return now;
+}
+
+static void _unlock(void)
+{
+    mutex_unlock(&cache_mutex);
+}
+
 int dns_cache_query(const char *domain_name, void *addr_out, int family)
 {
     int res = 0;
-    uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
     uint32_t hash = _hash(domain_name, strlen(domain_name));
     uint8_t addr_len = _addr_len(family);
+    unsigned idx = _home(hash);
 
-    mutex_lock(&cache_mutex);
-    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
-        /* empty slot */
-        if (_is_empty(i)) {
+    _lock();
+    for (unsigned n = 0; (n < CONFIG_DNS_CACHE_SIZE) && !_is_empty(idx);
+         n++, idx = _next(idx)) {
+        if (cache[idx].hash != hash) {
             continue;
         }
-        /* TTL expired - invalidate slot */
-        if (now > cache[i].expires) {
-            DEBUG("dns_cache[%u] expired\n", i);
-            _set_empty(i);
+        if (_is_negative(idx)) {
+            /* a positive entry of the same name takes precedence */
+            if (!_get_len(idx) || (_get_len(idx) == addr_len)) {
+                DEBUG("dns_cache[%u] negative hit\n", idx);
+                res = -ENOENT;
+            }
             continue;
         }
-        /* check if hash and length match */
-        if (cache[i].hash == hash && (!addr_len || addr_len == _get_len(i))) {
-            DEBUG("dns_cache[%u] hit\n", i);
-            memcpy(addr_out, &cache[i].addr, _get_len(i));
-            res = _get_len(i);
+        if (!addr_len || (addr_len == _get_len(idx))) {
+            DEBUG("dns_cache[%u] hit\n", idx);
+            memcpy(addr_out, &cache[idx].addr, _get_len(idx));
+            res = _get_len(idx);
             break;
         }
     }
     if (res == 0) {
         DEBUG("dns_cache miss\n");
     }
-    mutex_unlock(&cache_mutex);
+    _unlock();
     return res;
 }
 
-static void _add_entry(uint8_t i, uint32_t hash, const void *addr_out,
-                       int addr_len, uint32_t expires)
+/* Removes the entries of a name that are covered by an entry of type */
+static void _remove_conflicting(uint32_t hash, uint8_t type)
 {
-    DEBUG("dns_cache[%u] add cache entry\n", i);
-    cache[i].hash = hash;
-    cache[i].expires = expires;
-    memcpy(&cache[i].addr, addr_out, addr_len);
-    _set_len(i, addr_len);
+    unsigned idx = _home(hash);
+
+    for (unsigned n = 0; (n < CONFIG_DNS_CACHE_SIZE) && !_is_empty(idx); n++) {
+        bool conflict = false;
+
+        if (cache[idx].hash == hash) {
+            uint8_t len = type & _TYPE_LEN_MASK;
+            if (type & _TYPE_NEG) {
+                /* a negative answer invalidates the records it covers */
+                conflict = !_is_negative(idx) && (!len || (_get_len(idx) == len));
+            }
+            else {
+                /* a positive answer invalidates negative entries covering it */
+                conflict = _is_negative(idx) &&
+                           (!_get_len(idx) || (_get_len(idx) == len));
+            }
+        }
+
+        if (conflict) {
+            /* another entry may have been shifted into idx */
+            _remove(idx);
+        }
+        else {
+            idx = _next(idx);
+        }
+    }
+}
+
+static void _insert(uint32_t now, uint32_t hash, uint8_t type,
+                    const void *addr, uint32_t expires)
+{
+    unsigned idx = _home(hash);
+    unsigned n;
+
+    for (n = 0; (n < CONFIG_DNS_CACHE_SIZE) && !_is_empty(idx); n++) {
+        idx = _next(idx);
+    }
+
+    if (n == CONFIG_DNS_CACHE_SIZE) {
+        unsigned oldest = 0;
+        for (unsigned i = 1; i < CONFIG_DNS_CACHE_SIZE; ++i) {
+            if ((cache[i].expires - now) < (cache[oldest].expires - now)) {
+                oldest = i;
+            }
+        }
+        if ((expires - now) < (cache[oldest].expires - now)) {
+            DEBUG("dns_cache: full, new entry expires first\n");
+            return;
+        }
+        DEBUG("dns_cache: evict first entry to expire\n");
+        _remove(oldest);
+
+        idx = _home(hash);
+        while (!_is_empty(idx)) {
+            idx = _next(idx);
+        }
+    }
+
+    DEBUG("dns_cache[%u] add cache entry\n", idx);
+    cache[idx].hash = hash;
+    cache[idx].expires = expires;
+    cache[idx].type = type;
+    if (addr) {
+        memcpy(&cache[idx].addr, addr, type & _TYPE_LEN_MASK);
+    }
 }
 
 void dns_cache_add(const char *domain_name, const void *addr_out,
                         int addr_len, uint32_t ttl)
 {
-    uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
     uint32_t hash = _hash(domain_name, strlen(domain_name));
-    uint32_t oldest = ttl;
-    int idx = -1;
+    unsigned idx = _home(hash);
 
     assert(addr_len == 4 || addr_len == 16);
     DEBUG("dns_cache: lifetime of %s is %"PRIu32" s\n", domain_name, ttl);
 
-    mutex_lock(&cache_mutex);
-    /* iterate even if TTL = 0 just in case we need to expire */
-    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
-        if (ttl && (now > cache[i].expires || _is_empty(i))) {
-            _add_entry(i, hash, addr_out, addr_len, now + ttl);
-            goto exit;
-        }
-        if (cache[i].hash == hash && _get_len(i) == addr_len) {
-            DEBUG("dns_cache[%u] update ttl\n", i);
+    uint32_t now = _lock();
+    uint32_t expires = _expires(now, ttl, CONFIG_DNS_CACHE_TTL_MAX);
+
+    _remove_conflicting(hash, addr_len);
+
+    /* refresh the record if it is already known */
+    for (unsigned n = 0; (n < CONFIG_DNS_CACHE_SIZE) && !_is_empty(idx);
+         n++, idx = _next(idx)) {
+        if ((cache[idx].hash == hash) && (cache[idx].type == addr_len) &&
+                !memcmp(&cache[idx].addr, addr_out, addr_len)) {
+            DEBUG("dns_cache[%u] update ttl\n", idx);
             if (ttl) {
-                cache[i].expires = now + ttl;
+                cache[idx].expires = expires;
             }
             else {
-                /* put one second into past so that it is immediately expired */
-                cache[i].expires = now - 1;
+                _remove(idx);
             }
             goto exit;
         }
-        uint32_t _ttl = cache[i].expires - now;
-        if (_ttl < oldest) {
-            oldest = _ttl;
-            idx = i;
-        }
     }
 
-    if (ttl && idx >= 0) {
-        DEBUG("dns_cache: evict first entry to expire\n");
-        _add_entry(idx, hash, addr_out, addr_len, now + ttl);
+    if (ttl) {
+        _insert(now, hash, addr_len, addr_out, expires);
     }
+
 exit:
-    mutex_unlock(&cache_mutex);
+    _arm(now);
+    _unlock();
+}
+
+void dns_cache_add_negative(const char *domain_name, int family, uint32_t ttl)
+{
+    uint32_t hash = _hash(domain_name, strlen(domain_name));
+    uint8_t type = _TYPE_NEG | _addr_len(family);
+    unsigned idx = _home(hash);
+
+    assert(_addr_len(family) != 255);
+    DEBUG("dns_cache: %s does not exist for %"PRIu32" s\n", domain_name, ttl);
+
+    if (!ttl) {
+        return;
+    }
+
+    uint32_t now = _lock();
+    uint32_t expires = _expires(now, ttl, CONFIG_DNS_CACHE_NEGATIVE_TTL_MAX);
+
+    _remove_conflicting(hash, type);
+
+    for (unsigned n = 0; (n < CONFIG_DNS_CACHE_SIZE) && !_is_empty(idx);
+         n++, idx = _next(idx)) {
+        if ((cache[idx].hash == hash) && (cache[idx].type == type)) {
+            DEBUG("dns_cache[%u] update ttl\n", idx);
+            cache[idx].expires = expires;
+            goto exit;
+        }
+    }
+
+    _insert(now, hash, type, NULL, expires);
+
+exit:
+    _arm(now);
+    _unlock();
 }
@@ -16,6 +16,8 @@
 
 #include <arpa/inet.h>
 #include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include "net/dns.h"
@@ -93,6 +95,13 @@ static ssize_t _skip_hostname(const uint8_t *buf, size_t len,
     }
 
     while (bufpos[res]) {
+        if (bufpos[res] & 0xc0) {
+            /* remaining labels are compressed */
+            if ((&bufpos[res + 2]) >= buflim) {
+                return -EBADMSG;
+            }
+            return res + 2;
+        }
         res += bufpos[res] + 1;
         if ((&bufpos[res]) >= buflim) {
             /* out-of-bound */
@@ -137,10 +146,12 @@ size_t dns_msg_compose_query(void *dns_buf, const char *domain_name,
     return bufpos - buf;
 }
 
-int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
-                        void *addr_out, uint32_t *ttl)
+/* callback for every resource record of a section, returns true to stop */
+typedef bool (*_rr_cb_t)(void *arg, uint16_t type, uint32_t ttl,
+                         const uint8_t *rdata, unsigned rdlen);
+
+static const uint8_t *_skip_queries(const uint8_t *buf, size_t len)
 {
-    const uint8_t *buflim = buf + len;
     const dns_hdr_t *hdr = (dns_hdr_t *)buf;
     const uint8_t *bufpos = buf + sizeof(*hdr);
 
@@ -148,14 +159,24 @@ int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
     for (unsigned n = 0; n < ntohs(hdr->qdcount); n++) {
         ssize_t tmp = _skip_hostname(buf, len, bufpos);
         if (tmp < 0) {
-            return tmp;
+            return NULL;
         }
         bufpos += tmp;
         /* skip type and class of query */
         bufpos += (RR_TYPE_LENGTH + RR_CLASS_LENGTH);
     }
 
-    for (unsigned n = 0; n < ntohs(hdr->ancount); n++) {
+    return bufpos;
+}
+
+/* walks count IN records starting at *pos, returns 1 if cb stopped the walk */
+static int _walk_records(const uint8_t *buf, size_t len, const uint8_t **pos,
+                         unsigned count, _rr_cb_t cb, void *arg)
+{
+    const uint8_t *buflim = buf + len;
+    const uint8_t *bufpos = *pos;
+
+    for (unsigned n = 0; n < count; n++) {
         ssize_t tmp = _skip_hostname(buf, len, bufpos);
         if (tmp < 0) {
             return tmp;
@@ -170,46 +191,169 @@ int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
         bufpos += RR_TYPE_LENGTH;
         uint16_t class = ntohs(_get_short(bufpos));
         bufpos += RR_CLASS_LENGTH;
-        if (ttl) {
-            *ttl = byteorder_bebuftohl(bufpos);
-        }
+        uint32_t ttl = byteorder_bebuftohl(bufpos);
         bufpos += RR_TTL_LENGTH;
 
         unsigned rdlen = ntohs(_get_short(bufpos));
         bufpos += RR_RDLENGTH_LENGTH;
-        if ((bufpos + rdlen) > buflim) {
+        if ((rdlen > len) || ((bufpos + rdlen) > buflim)) {
+            /* rdlen > len: buffer wraps around memory space */
             return -EBADMSG;
         }
 
         DEBUG("dns_msg: type: %u, class: %u, len: %u\n", _type, class, rdlen);
 
-        /* skip unwanted answers */
-        if ((class != DNS_CLASS_IN) ||
-                ((_type == DNS_TYPE_A) && (family == AF_INET6)) ||
-                ((_type == DNS_TYPE_AAAA) && (family == AF_INET)) ||
-                ! ((_type == DNS_TYPE_A) || ((_type == DNS_TYPE_AAAA))
-                    )) {
-            if (rdlen > len) {
-                /* buffer wraps around memory space */
-                return -EBADMSG;
-            }
-            bufpos += rdlen;
-            /* other out-of-bound is checked in `_skip_hostname()` at start of
-             * loop */
-            continue;
-        }
-        if (((rdlen != INADDRSZ)  && (family == AF_INET))  ||
-            ((rdlen != IN6ADDRSZ) && (family == AF_INET6)) ||
-            ((rdlen != IN6ADDRSZ) && (rdlen != INADDRSZ) &&
-             (family == AF_UNSPEC))) {
-            return -EBADMSG;
+        if ((class == DNS_CLASS_IN) && cb(arg, _type, ttl, bufpos, rdlen)) {
+            return 1;
         }
+        /* other out-of-bound is checked in `_skip_hostname()` at start of
+         * loop */
+        bufpos += rdlen;
+    }
+
+    *pos = bufpos;
+    return 0;
+}
+
+typedef struct {
+    int family;
+    int res;
+    dns_msg_addr_cb_t cb;
+    void *arg;
+} _addr_ctx_t;
+
+static bool _addr_cb(void *arg, uint16_t type, uint32_t ttl,
+                     const uint8_t *rdata, unsigned rdlen)
+{
+    _addr_ctx_t *ctx = arg;
+    int family = ctx->family;
+
+    /* skip unwanted answers */
+    if (((type == DNS_TYPE_A) && (family == AF_INET6)) ||
+        ((type == DNS_TYPE_AAAA) && (family == AF_INET)) ||
+        !((type == DNS_TYPE_A) || (type == DNS_TYPE_AAAA))) {
+        return false;
+    }
+    if (((rdlen != INADDRSZ)  && (family == AF_INET))  ||
+        ((rdlen != IN6ADDRSZ) && (family == AF_INET6)) ||
+        ((rdlen != IN6ADDRSZ) && (rdlen != INADDRSZ) &&
+         (family == AF_UNSPEC))) {
+        ctx->res = -EBADMSG;
+        return true;
+    }
+
+    ctx->res++;
+    return ctx->cb(ctx->arg, rdata, rdlen, ttl);
+}
+
+int dns_msg_parse_reply_addrs(const uint8_t *buf, size_t len, int family,
+                              dns_msg_addr_cb_t cb, void *arg)
+{
+    const dns_hdr_t *hdr = (dns_hdr_t *)buf;
+    const uint8_t *bufpos = _skip_queries(buf, len);
+    _addr_ctx_t ctx = { .family = family, .cb = cb, .arg = arg };
+
+    if (!bufpos) {
+        return -EBADMSG;
+    }
 
-        memcpy(addr_out, bufpos, rdlen);
-        return rdlen;
+    int res = _walk_records(buf, len, &bufpos, ntohs(hdr->ancount),
+                            _addr_cb, &ctx);
+    if (res < 0) {
+        return res;
+    }
+    return ctx.res ? ctx.res : -EBADMSG;
+}
+
+typedef struct {
+    void *addr_out;
+    uint32_t *ttl;
+    int addr_len;
+} _first_addr_t;
+
+static bool _first_addr_cb(void *arg, const void *addr, size_t addr_len,
+                           uint32_t ttl)
+{
+    _first_addr_t *first = arg;
+
+    memcpy(first->addr_out, addr, addr_len);
+    first->addr_len = addr_len;
+    if (first->ttl) {
+        *first->ttl = ttl;
+    }
+    return true;
+}
+
+int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
+                        void *addr_out, uint32_t *ttl)
+{
+    _first_addr_t first = { .addr_out = addr_out, .ttl = ttl };
+
+    int res = dns_msg_parse_reply_addrs(buf, len, family, _first_addr_cb, &first);
+    if (res < 0) {
+        return res;
+    }
+    return first.addr_len;
+}
+
+static bool _no_addr_cb(void *arg, const void *addr, size_t addr_len,
+                        uint32_t ttl)
+{
+    (void)arg;
+    (void)addr;
+    (void)addr_len;
+    (void)ttl;
+    return true;
+}
+
+static bool _soa_cb(void *arg, uint16_t type, uint32_t ttl,
+                    const uint8_t *rdata, unsigned rdlen)
+{
+    uint32_t *neg_ttl = arg;
+
+    /* MNAME and RNAME take at least one byte each, followed by SERIAL,
+     * REFRESH, RETRY, EXPIRE and MINIMUM */
+    if ((type != DNS_TYPE_SOA) || (rdlen < (2 + 5 * sizeof(uint32_t)))) {
+        return false;
+    }
+
+    /* RFC 2308, section 5: the TTL of a negative answer is the minimum of
+     * the SOA MINIMUM field and the TTL of the SOA record itself */
+    uint32_t minimum = byteorder_bebuftohl(rdata + rdlen - sizeof(uint32_t));
+    *neg_ttl = (ttl < minimum) ? ttl : minimum;
+    return true;
+}
+
+int dns_msg_parse_negative(const uint8_t *buf, size_t len, int family,
+                           uint32_t *ttl)
+{
+    const dns_hdr_t *hdr = (dns_hdr_t *)buf;
+    const uint8_t *bufpos = _skip_queries(buf, len);
+    unsigned rcode = ntohs(hdr->flags) & DNS_RCODE_MASK;
+    _addr_ctx_t ctx = { .family = family, .cb = _no_addr_cb };
+
+    if (!bufpos) {
+        return -EBADMSG;
+    }
+
+    /* an answer for a non-existing name may still carry a CNAME chain,
+     * an answer without error code is NODATA if it has no address */
+    int res = _walk_records(buf, len, &bufpos, ntohs(hdr->ancount),
+                            _addr_cb, &ctx);
+    if ((res < 0) || (ctx.res != 0) ||
+            ((rcode != 0) && (rcode != DNS_RCODE_NXDOMAIN))) {
+        return -EBADMSG;
+    }
+
+    /* negative answers without SOA record must not be cached */
+    res = _walk_records(buf, len, &bufpos, ntohs(hdr->nscount), _soa_cb, ttl);
+    if (res != 1) {
+        return -EBADMSG;
     }
 
-    return -EBADMSG;
+    DEBUG("dns_msg: %s, ttl %" PRIu32 "\n",
+          (rcode == DNS_RCODE_NXDOMAIN) ? "NXDOMAIN" : "NODATA", *ttl);
+    return (rcode == DNS_RCODE_NXDOMAIN) ? AF_UNSPEC : family;
 }
 
 /** @} */
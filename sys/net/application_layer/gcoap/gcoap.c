@@ -32,6 +32,7 @@
 #include "net/ipv6/addr.h"
 #include "net/nanocoap.h"
 #include "net/nanocoap/cache.h"
+#include "net/nanocoap/resource_trie.h"
 #include "net/sock/async/event.h"
 #include "net/sock/udp.h"
 #include "net/sock/util.h"
@@ -99,6 +100,24 @@ static ssize_t _cache_build_response(nanocoap_cache_entry_t *ce, coap_pkt_t *pdu
                                      uint8_t *buf, size_t len);
 static void _receive_from_cache_cb(void *arg);
 
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE)
+/* Resource indices of the listeners using the default request matcher */
+static struct {
+    const gcoap_listener_t *listener;
+    coap_resource_trie_t trie;
+} _listener_tries[CONFIG_GCOAP_RESOURCE_TRIE_LISTENERS];
+
+static const coap_resource_trie_t *_listener_trie(const gcoap_listener_t *listener)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_listener_tries); i++) {
+        if (_listener_tries[i].listener == listener) {
+            return &_listener_tries[i].trie;
+        }
+    }
+    return NULL;
+}
+#endif
+
 static int _request_matcher_default(gcoap_listener_t *listener,
                                     const coap_resource_t **resource,
                                     coap_pkt_t *pdu);
@@ -842,6 +861,20 @@ static int _request_matcher_default(gcoap_listener_t *listener,
     uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
     int ret = GCOAP_RESOURCE_NO_PATH;
 
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE)
+    const coap_resource_trie_t *trie = _listener_trie(listener);
+    if (trie) {
+        switch (coap_resource_trie_find(trie, pdu, resource)) {
+        case 0:
+            return GCOAP_RESOURCE_FOUND;
+        case -ENOTSUP:
+            return GCOAP_RESOURCE_WRONG_METHOD;
+        default:
+            return GCOAP_RESOURCE_NO_PATH;
+        }
+    }
+#endif
+
     if (coap_get_uri_path(pdu, uri) <= 0) {
         /* The Uri-Path options are longer than
          * CONFIG_NANOCOAP_URI_MAX, and thus do not match anything
@@ -1650,6 +1683,38 @@ uint16_t gcoap_next_msg_id(void)
     return (uint16_t)atomic_fetch_add(&_coap_state.next_message_id, 1);
 }
 
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE)
+/*
+ * Builds the resource index of a listener from the shared node pool. Leaves
+ * the listener unindexed if the pool is exhausted, so the default request
+ * matcher falls back to the linear lookup for it.
+ */
+static void _index_listener(const gcoap_listener_t *listener)
+{
+    static coap_resource_trie_node_t nodes[CONFIG_GCOAP_RESOURCE_TRIE_NODES];
+    static unsigned nodes_used;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_listener_tries); i++) {
+        if (_listener_tries[i].listener) {
+            continue;
+        }
+        coap_resource_trie_t *trie = &_listener_tries[i].trie;
+        int res = coap_resource_trie_init(trie, &nodes[nodes_used],
+                                          ARRAY_SIZE(nodes) - nodes_used,
+                                          listener->resources,
+                                          listener->resources_len);
+        if (res < 0) {
+            DEBUG("gcoap: can't index listener resources (%d)\n", res);
+            return;
+        }
+        nodes_used += trie->nodes_used;
+        _listener_tries[i].listener = listener;
+        return;
+    }
+    DEBUG_PUTS("gcoap: no free resource index for listener");
+}
+#endif
+
 void gcoap_register_listener(gcoap_listener_t *listener)
 {
     /* That item will be overridden, ensure that the user expecting different
@@ -1666,6 +1731,12 @@ void gcoap_register_listener(gcoap_listener_t *listener)
     if (!listener->request_matcher) {
         listener->request_matcher = _request_matcher_default;
     }
+
+#if IS_USED(MODULE_NANOCOAP_RESOURCE_TRIE)
+    if (listener->request_matcher == _request_matcher_default) {
+        _index_listener(listener);
+    }
+#endif
 }
 
 const coap_resource_t *gcoap_get_resource_by_path_iterator(const gcoap_listener_t **last_listener,
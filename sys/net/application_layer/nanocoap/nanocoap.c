@@ -30,6 +30,11 @@
 #include "net/nanocoap.h"
 #include "net/nanocoap_sock.h"
 
+#ifdef MODULE_NANOCOAP_RESOURCE_TRIE
+#include "mutex.h"
+#include "net/nanocoap/resource_trie.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -202,16 +207,25 @@ int coap_match_path(const coap_resource_t *resource, const uint8_t *uri)
 
 uint8_t *coap_find_option(coap_pkt_t *pkt, unsigned opt_num)
 {
-    const coap_optpos_t *optpos = pkt->options;
-    unsigned opt_count = pkt->options_len;
+    /* Both coap_parse() and the option writers fill pkt->options in
+     * ascending order of the option number, so the first entry for opt_num
+     * (if any) is found by bisection instead of walking all options. */
+    unsigned lo = 0;
+    unsigned hi = pkt->options_len;
 
-    while (opt_count--) {
-        if (optpos->opt_num == opt_num) {
-            unsigned idx = index_of(pkt->options, optpos);
-            bf_unset(pkt->opt_crit, idx);
-            return (uint8_t*)pkt->hdr + optpos->offset;
+    while (lo < hi) {
+        unsigned mid = (lo + hi) / 2;
+        if (pkt->options[mid].opt_num < opt_num) {
+            lo = mid + 1;
         }
-        optpos++;
+        else {
+            hi = mid;
+        }
+    }
+
+    if ((lo < pkt->options_len) && (pkt->options[lo].opt_num == opt_num)) {
+        bf_unset(pkt->opt_crit, lo);
+        return (uint8_t *)pkt->hdr + pkt->options[lo].offset;
     }
     return NULL;
 }
@@ -540,6 +554,32 @@ bool coap_has_unprocessed_critical_options(const coap_pkt_t *pkt)
     return false;
 }
 
+#ifdef MODULE_NANOCOAP_RESOURCE_TRIE
+/* The server resources do not change at run time, so the index is built on
+ * the first request. Returns NULL if the resources do not fit the index, the
+ * caller then falls back to the linear lookup. */
+static const coap_resource_trie_t *_resource_trie(void)
+{
+    static coap_resource_trie_node_t nodes[CONFIG_NANOCOAP_RESOURCE_TRIE_NODES];
+    static coap_resource_trie_t trie;
+    static mutex_t lock = MUTEX_INIT;
+    static int state = 1;
+
+    mutex_lock(&lock);
+    if (state > 0) {
+        state = coap_resource_trie_init(&trie, nodes, ARRAY_SIZE(nodes),
+                                        coap_resources, coap_resources_numof);
+        if (state < 0) {
+            DEBUG("nanocoap: resource index failed (%d), using linear lookup\n",
+                  state);
+        }
+    }
+    mutex_unlock(&lock);
+
+    return (state == 0) ? &trie : NULL;
+}
+#endif
+
 ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_len,
                         coap_request_ctx_t *ctx)
 {
@@ -573,8 +613,18 @@ ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_le
         }
     }
 
-    ssize_t retval = coap_tree_handler(pkt, resp_buf, resp_buf_len, ctx,
-                                       coap_resources, coap_resources_numof);
+    ssize_t retval;
+#ifdef MODULE_NANOCOAP_RESOURCE_TRIE
+    const coap_resource_trie_t *trie = _resource_trie();
+    if (trie) {
+        retval = coap_resource_trie_handler(pkt, resp_buf, resp_buf_len, ctx, trie);
+    }
+    else
+#endif
+    {
+        retval = coap_tree_handler(pkt, resp_buf, resp_buf_len, ctx,
+                                   coap_resources, coap_resources_numof);
+    }
 
     if (retval < 0) {
         if (retval == -ECANCELED) {
@@ -0,0 +1,221 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_nanocoap_resource_trie
+ * @{
+ *
+ * @file
+ * @brief       nanoCoAP resource index implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "net/nanocoap/resource_trie.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static int _insert(coap_resource_trie_t *trie, uint16_t res_idx)
+{
+    const coap_resource_t *resource = &trie->resources[res_idx];
+    const char *seg = resource->path;
+    uint16_t *link = &trie->root;
+
+    if (!seg || (*seg != '/')) {
+        return -EINVAL;
+    }
+    seg++;
+
+    while (1) {
+        const char *end = strchr(seg, '/');
+        bool last = (end == NULL);
+        size_t len = last ? strlen(seg) : (size_t)(end - seg);
+        uint8_t flags = (last && (resource->methods & COAP_MATCH_SUBTREE))
+                      ? COAP_RESOURCE_TRIE_PREFIX : 0;
+        coap_resource_trie_node_t *node = NULL;
+
+        if (len > UINT8_MAX) {
+            return -EINVAL;
+        }
+
+        /* Intermediate segments share the first node with the same segment.
+         * The final segment needs a node that no resource ends at yet, a
+         * resource path registered twice gets a sibling with the same
+         * segment. Siblings are appended, so the first node with a given
+         * segment is always the one holding the children. */
+        while (*link != COAP_RESOURCE_TRIE_NONE) {
+            node = &trie->nodes[*link];
+            if ((node->flags == flags) && (node->seg_len == len) &&
+                    !memcmp(node->seg, seg, len) &&
+                    (!last || (node->res == COAP_RESOURCE_TRIE_NONE))) {
+                break;
+            }
+            link = &node->sibling;
+            node = NULL;
+        }
+
+        if (!node) {
+            if (trie->nodes_used >= trie->nodes_numof) {
+                return -ENOMEM;
+            }
+            *link = trie->nodes_used++;
+            node = &trie->nodes[*link];
+            node->seg = seg;
+            node->seg_len = len;
+            node->flags = flags;
+            node->child = COAP_RESOURCE_TRIE_NONE;
+            node->sibling = COAP_RESOURCE_TRIE_NONE;
+            node->res = COAP_RESOURCE_TRIE_NONE;
+        }
+
+        if (last) {
+            node->res = res_idx;
+            return 0;
+        }
+
+        link = &node->child;
+        seg = end + 1;
+    }
+}
+
+int coap_resource_trie_init(coap_resource_trie_t *trie,
+                            coap_resource_trie_node_t *nodes, size_t nodes_numof,
+                            const coap_resource_t *resources,
+                            size_t resources_numof)
+{
+    assert(trie && (nodes || !nodes_numof));
+
+    if ((nodes_numof >= COAP_RESOURCE_TRIE_NONE) ||
+            (resources_numof >= COAP_RESOURCE_TRIE_NONE)) {
+        return -ENOMEM;
+    }
+
+    trie->resources = resources;
+    trie->nodes = nodes;
+    trie->nodes_numof = nodes_numof;
+    trie->nodes_used = 0;
+    trie->root = COAP_RESOURCE_TRIE_NONE;
+
+    for (unsigned i = 0; i < resources_numof; i++) {
+        int res = _insert(trie, i);
+        if (res < 0) {
+            DEBUG("nanocoap: can't index resource \"%s\": %d\n",
+                  resources[i].path ? resources[i].path : "", res);
+            return res;
+        }
+    }
+
+    DEBUG("nanocoap: indexed %u resources in %u nodes\n",
+          (unsigned)resources_numof, trie->nodes_used);
+
+    return 0;
+}
+
+/* tells if the path fits into the buffer of coap_get_uri_path() */
+static bool _uri_fits(coap_pkt_t *pkt)
+{
+    uint8_t *opt_pos = NULL;
+    int seg_len;
+    size_t len = 1;     /* terminating '\0' */
+
+    while (coap_iterate_option(pkt, COAP_OPT_URI_PATH, &opt_pos, &seg_len)) {
+        len += seg_len + 1;
+    }
+
+    return len <= CONFIG_NANOCOAP_URI_MAX;
+}
+
+int coap_resource_trie_find(const coap_resource_trie_t *trie, coap_pkt_t *pkt,
+                            const coap_resource_t **resource)
+{
+    coap_method_flags_t method_flag = coap_method2flag(coap_get_code_detail(pkt));
+    uint16_t best = COAP_RESOURCE_TRIE_NONE;
+    bool path_found = false;
+
+    /* reject what the linear lookup can not match either */
+    if (!_uri_fits(pkt)) {
+        return -EBADMSG;
+    }
+
+    uint8_t *opt_pos = NULL;
+    int seg_len;
+    uint8_t *seg = coap_iterate_option(pkt, COAP_OPT_URI_PATH, &opt_pos, &seg_len);
+    if (!seg) {
+        /* a request without Uri-Path addresses "/" */
+        seg = (uint8_t *)"";
+        seg_len = 0;
+    }
+
+    uint16_t idx = trie->root;
+    while (seg && (idx != COAP_RESOURCE_TRIE_NONE)) {
+        int next_len;
+        uint8_t *next = coap_iterate_option(pkt, COAP_OPT_URI_PATH, &opt_pos, &next_len);
+        uint16_t child = COAP_RESOURCE_TRIE_NONE;
+
+        for (; idx != COAP_RESOURCE_TRIE_NONE; idx = trie->nodes[idx].sibling) {
+            const coap_resource_trie_node_t *node = &trie->nodes[idx];
+            uint16_t res;
+
+            if (node->flags & COAP_RESOURCE_TRIE_PREFIX) {
+                if ((node->seg_len > seg_len) || memcmp(node->seg, seg, node->seg_len)) {
+                    continue;
+                }
+                res = node->res;
+            }
+            else {
+                if ((node->seg_len != seg_len) || memcmp(node->seg, seg, seg_len)) {
+                    continue;
+                }
+                if (child == COAP_RESOURCE_TRIE_NONE) {
+                    child = node->child;
+                }
+                res = next ? COAP_RESOURCE_TRIE_NONE : node->res;
+            }
+
+            if (res == COAP_RESOURCE_TRIE_NONE) {
+                continue;
+            }
+            path_found = true;
+            /* preserve the array order of the linear lookup */
+            if ((res < best) && (trie->resources[res].methods & method_flag)) {
+                best = res;
+            }
+        }
+
+        idx = child;
+        seg = next;
+        seg_len = next_len;
+    }
+
+    if (best != COAP_RESOURCE_TRIE_NONE) {
+        *resource = &trie->resources[best];
+        return 0;
+    }
+
+    return path_found ? -ENOTSUP : -ENOENT;
+}
+
+ssize_t coap_resource_trie_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                                   unsigned resp_buf_len, coap_request_ctx_t *ctx,
+                                   const coap_resource_trie_t *trie)
+{
+    const coap_resource_t *resource;
+    int res = coap_resource_trie_find(trie, pkt, &resource);
+
+    if (res == -EBADMSG) {
+        return res;
+    }
+    if (res < 0) {
+        return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
+    }
+
+    ctx->resource = resource;
+    return resource->handler(pkt, resp_buf, resp_buf_len, ctx);
+}
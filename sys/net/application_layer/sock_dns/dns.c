@@ -17,11 +17,14 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include <arpa/inet.h>
-#include <string.h>
 
+#include "cond.h"
+#include "modules.h"
+#include "mutex.h"
 #include "net/dns.h"
 #include "net/dns/cache.h"
 #include "net/dns/msg.h"
@@ -70,24 +73,33 @@ void auto_init_sock_dns(void)
 }
 #endif /* MODULE_AUTO_INIT_SOCK_DNS */
 
-int sock_dns_query(const char *domain_name, void *addr_out, int family)
+typedef struct {
+    const char *domain_name;
+    void *addr_out;
+    int addr_len;
+} _reply_ctx_t;
+
+static bool _add_addr(void *arg, const void *addr, size_t addr_len,
+                      uint32_t ttl)
 {
-    ssize_t res;
-    sock_udp_t sock_dns;
-    static uint8_t dns_buf[CONFIG_DNS_MSG_LEN];
+    _reply_ctx_t *ctx = arg;
 
-    if (sock_dns_server.port == 0) {
-        return -ECONNREFUSED;
+    /* return the first address, but cache all of them */
+    if (!ctx->addr_len) {
+        memcpy(ctx->addr_out, addr, addr_len);
+        ctx->addr_len = addr_len;
     }
+    dns_cache_add(ctx->domain_name, addr, addr_len, ttl);
 
-    if (strlen(domain_name) > SOCK_DNS_MAX_NAME_LEN) {
-        return -ENOSPC;
-    }
+    /* without cache, the remaining addresses are of no use */
+    return !IS_USED(MODULE_DNS_CACHE);
+}
 
-    res = dns_cache_query(domain_name, addr_out, family);
-    if (res) {
-        return res;
-    }
+static int _query(const char *domain_name, void *addr_out, int family)
+{
+    ssize_t res;
+    sock_udp_t sock_dns;
+    static uint8_t dns_buf[CONFIG_DNS_MSG_LEN];
 
     res = sock_udp_create(&sock_dns, NULL, &sock_dns_server, 0);
     if (res) {
@@ -114,16 +126,111 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
             continue;
         }
 
+        _reply_ctx_t ctx = { .domain_name = domain_name, .addr_out = addr_out };
+        size_t len = res;
+        if ((res = dns_msg_parse_reply_addrs(dns_buf, len, family,
+                                             _add_addr, &ctx)) > 0) {
+            res = ctx.addr_len;
+            break;
+        }
+
         uint32_t ttl;
-        if ((res = dns_msg_parse_reply(dns_buf, res, family,
-                                       addr_out, &ttl)) > 0) {
-            dns_cache_add(domain_name, addr_out, res, ttl);
+        int neg_family = dns_msg_parse_negative(dns_buf, len, family, &ttl);
+        if (neg_family >= 0) {
+            DEBUG("sock_dns: %s does not exist\n", domain_name);
+            dns_cache_add_negative(domain_name, neg_family, ttl);
+            res = -ENOENT;
             break;
-        } else {
-            DEBUG("sock_dns: can't parse response\n");
         }
+
+        DEBUG("sock_dns: can't parse response\n");
     }
 
     sock_udp_close(&sock_dns);
     return res;
 }
+
+#if IS_USED(MODULE_SOCK_DNS_COALESCE)
+static mutex_t _inflight_lock = MUTEX_INIT;
+static cond_t _inflight_done = COND_INIT;
+
+/* the query currently in flight and the result of the last query */
+static struct {
+    const char *domain_name;    /**< name of the pending query or NULL */
+    int family;                 /**< family of the pending query */
+    unsigned seq;               /**< incremented whenever a query finishes */
+    int res;                    /**< result of the last query */
+    uint8_t addr[16];           /**< address of the last query */
+} _inflight;
+
+static int _query_coalesced(const char *domain_name, void *addr_out, int family)
+{
+    int res;
+
+    mutex_lock(&_inflight_lock);
+
+    /* the message buffer is shared, so only one query may be pending */
+    while (_inflight.domain_name) {
+        bool same = (_inflight.family == family) &&
+                    !strcmp(_inflight.domain_name, domain_name);
+        unsigned seq = _inflight.seq;
+
+        do {
+            cond_wait(&_inflight_done, &_inflight_lock);
+        } while (_inflight.seq == seq);
+
+        /* the result is only ours if no other query finished meanwhile */
+        if (same && (_inflight.seq == seq + 1)) {
+            DEBUG("sock_dns: shared result for %s\n", domain_name);
+            res = _inflight.res;
+            if (res > 0) {
+                memcpy(addr_out, _inflight.addr, res);
+            }
+            mutex_unlock(&_inflight_lock);
+            return res;
+        }
+    }
+
+    _inflight.domain_name = domain_name;
+    _inflight.family = family;
+    mutex_unlock(&_inflight_lock);
+
+    res = _query(domain_name, addr_out, family);
+
+    mutex_lock(&_inflight_lock);
+    if (res > 0) {
+        memcpy(_inflight.addr, addr_out, res);
+    }
+    _inflight.res = res;
+    _inflight.domain_name = NULL;
+    _inflight.seq++;
+    cond_broadcast(&_inflight_done);
+    mutex_unlock(&_inflight_lock);
+
+    return res;
+}
+#endif /* MODULE_SOCK_DNS_COALESCE */
+
+int sock_dns_query(const char *domain_name, void *addr_out, int family)
+{
+    int res;
+
+    if (sock_dns_server.port == 0) {
+        return -ECONNREFUSED;
+    }
+
+    if (strlen(domain_name) > SOCK_DNS_MAX_NAME_LEN) {
+        return -ENOSPC;
+    }
+
+    res = dns_cache_query(domain_name, addr_out, family);
+    if (res) {
+        return res;
+    }
+
+#if IS_USED(MODULE_SOCK_DNS_COALESCE)
+    return _query_coalesced(domain_name, addr_out, family);
+#else
+    return _query(domain_name, addr_out, family);
+#endif
+}
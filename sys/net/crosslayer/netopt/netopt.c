@@ -139,6 +139,7 @@ static const char *_netopt_strmap[] = {
     [NETOPT_PAN_COORD]             = "NETOPT_PAN_COORD",
     [NETOPT_GTS_ALLOC]             = "NETOPT_GTS_ALLOC",
     [NETOPT_GTS_TX]                = "NETOPT_GTS_TX",
+    [NETOPT_CSUM_OFFLOAD]          = "NETOPT_CSUM_OFFLOAD",
     [NETOPT_NUMOF]                 = "NETOPT_NUMOF",
 };
 
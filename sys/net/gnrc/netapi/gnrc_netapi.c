@@ -27,9 +27,45 @@
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
 
+#ifdef MODULE_GNRC_NETAPI_BURST
+#include "bitfield.h"
+#include "irq.h"
+#include "thread.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#ifdef MODULE_GNRC_NETAPI_BURST
+/* threads handling GNRC_NETAPI_MSG_TYPE_RCV_BURST */
+static BITFIELD(_burst_accept, MAXTHREADS);
+/* the burst each thread collects into, only touched by the thread itself */
+static gnrc_netapi_burst_t *_bursts[MAXTHREADS];
+
+static void _burst_flush(gnrc_netapi_burst_t *burst);
+
+static bool _burst_collect(kernel_pid_t pid, gnrc_pktsnip_t *pkt)
+{
+    gnrc_netapi_burst_t *burst;
+
+    if (irq_is_in() || !pid_is_valid(pid) ||
+        !bf_isset(_burst_accept, pid - KERNEL_PID_FIRST)) {
+        return false;
+    }
+    burst = _bursts[thread_getpid() - KERNEL_PID_FIRST];
+    if (burst == NULL) {
+        return false;
+    }
+    if (burst->numof == CONFIG_GNRC_NETAPI_BURST_SIZE) {
+        _burst_flush(burst);
+    }
+    burst->pending[burst->numof].pkt = pkt;
+    burst->pending[burst->numof].pid = pid;
+    burst->numof++;
+    return true;
+}
+#endif
+
 int _gnrc_netapi_get_set(kernel_pid_t pid, netopt_t opt, uint16_t context,
                          void *data, size_t data_len, uint16_t type)
 {
@@ -54,6 +90,12 @@ int _gnrc_netapi_get_set(kernel_pid_t pid, netopt_t opt, uint16_t context,
 int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
 {
     msg_t msg;
+
+#ifdef MODULE_GNRC_NETAPI_BURST
+    if ((type == GNRC_NETAPI_MSG_TYPE_RCV) && _burst_collect(pid, pkt)) {
+        return 1;
+    }
+#endif
     /* set the outgoing message's fields */
     msg.type = type;
     msg.content.ptr = (void *)pkt;
@@ -141,3 +183,114 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
 
     return numof;
 }
+
+#ifdef MODULE_GNRC_NETAPI_BURST
+void gnrc_netapi_burst_accept(void)
+{
+    bf_set_atomic(_burst_accept, thread_getpid() - KERNEL_PID_FIRST);
+}
+
+void gnrc_netapi_burst_begin(gnrc_netapi_burst_t *burst)
+{
+    unsigned idx = thread_getpid() - KERNEL_PID_FIRST;
+
+    assert(_bursts[idx] == NULL);
+    burst->numof = 0;
+    _bursts[idx] = burst;
+}
+
+static void _burst_send(kernel_pid_t pid, gnrc_pktsnip_t *pkts)
+{
+    gnrc_pktsnip_t **list = pkts->data;
+    unsigned numof = pkts->size / sizeof(*list);
+    msg_t msg;
+
+    msg.type = GNRC_NETAPI_MSG_TYPE_RCV_BURST;
+    msg.content.ptr = pkts;
+    if (msg_try_send(&msg, pid) < 1) {
+        DEBUG("gnrc_netapi: dropped burst of %u to %" PRIkernel_pid "\n",
+              numof, pid);
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_release_error(list[i], EIO);
+        }
+        gnrc_pktbuf_release(pkts);
+    }
+}
+
+static void _burst_flush(gnrc_netapi_burst_t *burst)
+{
+    for (unsigned i = 0; i < burst->numof; i++) {
+        kernel_pid_t pid = burst->pending[i].pid;
+        gnrc_pktsnip_t *pkts = NULL;
+        gnrc_pktsnip_t **list = NULL;
+        unsigned numof = 0;
+
+        if (burst->pending[i].pkt == NULL) {
+            /* already passed on with an earlier packet for the same thread */
+            continue;
+        }
+        for (unsigned j = i; j < burst->numof; j++) {
+            if ((burst->pending[j].pkt != NULL) &&
+                (burst->pending[j].pid == pid)) {
+                numof++;
+            }
+        }
+        if (numof > 1) {
+            pkts = gnrc_pktbuf_add(NULL, NULL, numof * sizeof(*list),
+                                   GNRC_NETTYPE_UNDEF);
+        }
+        if (pkts != NULL) {
+            list = pkts->data;
+        }
+        numof = 0;
+        for (unsigned j = i; j < burst->numof; j++) {
+            gnrc_pktsnip_t *pkt = burst->pending[j].pkt;
+            msg_t msg;
+
+            if ((pkt == NULL) || (burst->pending[j].pid != pid)) {
+                continue;
+            }
+            burst->pending[j].pkt = NULL;
+            if (list != NULL) {
+                list[numof++] = pkt;
+                continue;
+            }
+            /* single packet or no space for the list */
+            msg.type = GNRC_NETAPI_MSG_TYPE_RCV;
+            msg.content.ptr = pkt;
+            if (msg_try_send(&msg, pid) < 1) {
+                DEBUG("gnrc_netapi: dropped message to %" PRIkernel_pid "\n",
+                      pid);
+                gnrc_pktbuf_release_error(pkt, EIO);
+            }
+        }
+        if (pkts != NULL) {
+            _burst_send(pid, pkts);
+        }
+    }
+    burst->numof = 0;
+}
+
+void gnrc_netapi_burst_end(gnrc_netapi_burst_t *burst)
+{
+    unsigned idx = thread_getpid() - KERNEL_PID_FIRST;
+
+    assert(_bursts[idx] == burst);
+    _burst_flush(burst);
+    _bursts[idx] = NULL;
+}
+
+void gnrc_netapi_burst_receive(gnrc_pktsnip_t *pkts, gnrc_netapi_burst_cb_t cb)
+{
+    gnrc_pktsnip_t **list = pkts->data;
+    unsigned numof = pkts->size / sizeof(*list);
+    gnrc_netapi_burst_t burst;
+
+    gnrc_netapi_burst_begin(&burst);
+    for (unsigned i = 0; i < numof; i++) {
+        cb(list[i]);
+    }
+    gnrc_netapi_burst_end(&burst);
+    gnrc_pktbuf_release(pkts);
+}
+#endif
@@ -253,6 +253,10 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
         if (rx_info.flags & NETDEV_ETH_RX_INFO_FLAG_TIMESTAMP) {
             gnrc_netif_hdr_set_timestamp(netif_hdr->data, rx_info.timestamp);
         }
+        if (rx_info.flags & NETDEV_ETH_RX_INFO_FLAG_CSUM_VALID) {
+            ((gnrc_netif_hdr_t *)netif_hdr->data)->flags |=
+                GNRC_NETIF_HDR_FLAGS_CSUM_VALID;
+        }
 
         gnrc_pktbuf_remove_snip(pkt, eth_hdr);
         pkt = gnrc_pkt_append(pkt, netif_hdr);
@@ -209,6 +209,19 @@ int gnrc_netif_get_from_netdev(gnrc_netif_t *netif, gnrc_netapi_opt_t *opt)
                        sizeof(netif->stats));
                 res = sizeof(netif->stats);
                 break;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+            case NETSTATS_FQ:
+                assert(opt->data_len >= (sizeof(netstats_fq_t) *
+                                         CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS));
+                /* only the netif thread (us) updates these */
+                for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS; i++) {
+                    memcpy(&((netstats_fq_t *)opt->data)[i],
+                           &netif->send_queue.flows[i].stats,
+                           sizeof(netstats_fq_t));
+                }
+                res = sizeof(netstats_fq_t) * CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS;
+                break;
 #endif
             default:
                 /* take from device */
@@ -443,6 +456,15 @@ int gnrc_netif_set_from_netdev(gnrc_netif_t *netif,
                 memset(&netif->stats, 0, sizeof(netif->stats));
                 res = 0;
                 break;
+#endif
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+            case NETSTATS_FQ:
+                for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS; i++) {
+                    memset(&netif->send_queue.flows[i].stats, 0,
+                           sizeof(netstats_fq_t));
+                }
+                res = 0;
+                break;
 #endif
             default:
                 /* take from device */
@@ -1510,6 +1532,13 @@ static void _init_from_device(gnrc_netif_t *netif)
     netif->device_type = (uint8_t)tmp;
     gnrc_netif_ipv6_init_mtu(netif);
     _update_l2addr_from_dev(netif);
+
+    netopt_csum_offload_t offload;
+
+    res = dev->driver->get(dev, NETOPT_CSUM_OFFLOAD, &offload, sizeof(offload));
+    if ((res == sizeof(offload)) && (offload & NETOPT_CSUM_OFFLOAD_TX)) {
+        netif->flags |= GNRC_NETIF_FLAGS_CSUM_OFFLOAD;
+    }
 }
 
 static void _check_netdev_capabilities(netdev_t *dev, bool legacy)
@@ -1693,7 +1722,16 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back);
 static void _event_handler_isr(event_t *evp)
 {
     gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_isr);
+#ifdef MODULE_GNRC_NETAPI_BURST
+    gnrc_netapi_burst_t burst;
+
+    /* pass on all frames the device has pending at once */
+    gnrc_netapi_burst_begin(&burst);
     netif->dev->driver->isr(netif->dev);
+    gnrc_netapi_burst_end(&burst);
+#else
+    netif->dev->driver->isr(netif->dev);
+#endif
 }
 
 static void _process_receive_stats(gnrc_netif_t *netdev, gnrc_pktsnip_t *pkt)
@@ -1714,7 +1752,8 @@ static void _process_receive_stats(gnrc_netif_t *netdev, gnrc_pktsnip_t *pkt)
     hdr = netif->data;
     src = gnrc_netif_hdr_get_src_addr(hdr);
     src_len = hdr->src_l2addr_len;
-    netstats_nb_update_rx(&netdev->netif, src, src_len, hdr->rssi, hdr->lqi);
+    netstats_nb_update_rx(&netdev->netif, src, src_len, hdr->rssi, hdr->lqi,
+                          gnrc_pkt_len(pkt) - netif->size);
 }
 
 static event_t *_gnrc_netif_fetch_event(gnrc_netif_t *netif)
@@ -1935,12 +1974,13 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back)
         if (netif_hdr->flags &
             (GNRC_NETIF_HDR_FLAGS_BROADCAST | GNRC_NETIF_HDR_FLAGS_MULTICAST)) {
             DEBUG("l2 stats: Destination is multicast or unicast, NULL recorded\n");
-            netstats_nb_record(&netif->netif, NULL, 0);
+            netstats_nb_record(&netif->netif, NULL, 0, 0);
         } else {
             DEBUG("l2 stats: recording transmission\n");
             netstats_nb_record(&netif->netif,
                                gnrc_netif_hdr_get_dst_addr(netif_hdr),
-                               netif_hdr->dst_l2addr_len);
+                               netif_hdr->dst_l2addr_len,
+                               gnrc_pkt_len(pkt->next));
         }
     }
 
@@ -2137,6 +2177,10 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                 _send_queued_pkt(netif);
                 if (pkt) {
                     _process_receive_stats(netif, pkt);
+                    if (IS_USED(MODULE_GNRC_IPV6_FASTPATH) &&
+                        gnrc_ipv6_fastpath_forward(netif, pkt)) {
+                        break;
+                    }
                     _pass_on_packet(pkt);
                 }
                 break;
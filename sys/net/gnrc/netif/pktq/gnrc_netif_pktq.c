@@ -23,6 +23,8 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if !IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
+/* with flow queueing, pool and queue handling is in gnrc_netif_pktq_fq.c */
 static mutex_t _pool_lock = MUTEX_INIT;
 static gnrc_pktqueue_t _pool[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
 
@@ -68,6 +70,7 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     gnrc_pktqueue_add(&netif->send_queue.queue, entry);
     return 0;
 }
+#endif  /* !IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) */
 
 void gnrc_netif_pktq_sched_get(gnrc_netif_t *netif)
 {
@@ -96,6 +99,7 @@ void gnrc_netif_pktq_sched_get(gnrc_netif_t *netif)
 #endif  /* CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0 */
 }
 
+#if !IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ)
 int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     assert(netif != NULL);
@@ -109,5 +113,6 @@ int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     LL_PREPEND(netif->send_queue.queue, entry);
     return 0;
 }
+#endif  /* !IS_USED(MODULE_GNRC_NETIF_PKTQ_FQ) */
 
 /** @} */
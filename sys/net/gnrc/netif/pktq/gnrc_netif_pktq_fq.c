@@ -0,0 +1,419 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief   Flow queueing with deficit round robin and CoDel for
+ *          @ref net_gnrc_netif_pktq
+ * @see     <a href="https://tools.ietf.org/html/rfc8290">RFC 8290</a>
+ * @see     <a href="https://tools.ietf.org/html/rfc8289">RFC 8289</a>
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "container.h"
+#include "mutex.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/pktq.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "utlist.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* flows are referenced by their index + 1 */
+#define _NONE           (0U)
+/* lists of active flows */
+#define _NEW            (1U)
+#define _OLD            (2U)
+
+#define _FNV_OFFSET     (2166136261U)
+#define _FNV_PRIME      (16777619U)
+
+typedef struct {
+    gnrc_pktqueue_t entry;      /**< entry.pkt == NULL marks a free entry */
+    uint32_t enqueued;          /**< ZTIMER_USEC time the packet was queued */
+} _entry_t;
+
+static mutex_t _pool_lock = MUTEX_INIT;
+static _entry_t _pool[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
+
+static gnrc_pktqueue_t *_get_free_entry(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktqueue_t *entry = NULL;
+
+    mutex_lock(&_pool_lock);
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
+        if (_pool[i].entry.pkt == NULL) {
+            _pool[i].entry.pkt = pkt;
+            _pool[i].entry.next = NULL;
+            _pool[i].enqueued = ztimer_now(ZTIMER_USEC);
+            entry = &_pool[i].entry;
+            break;
+        }
+    }
+    mutex_unlock(&_pool_lock);
+
+    return entry;
+}
+
+static inline uint32_t _enqueued(const gnrc_pktqueue_t *entry)
+{
+    return container_of(entry, _entry_t, entry)->enqueued;
+}
+
+unsigned gnrc_netif_pktq_usage(void)
+{
+    unsigned res = 0;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
+        if (_pool[i].entry.pkt != NULL) {
+            res++;
+        }
+    }
+    return res;
+}
+
+static inline gnrc_netif_pktq_flow_t *_flow(gnrc_netif_t *netif, uint8_t ref)
+{
+    return &netif->send_queue.flows[ref - 1];
+}
+
+static uint32_t _fnv1a(uint32_t hash, const void *data, size_t len)
+{
+    const uint8_t *bytes = data;
+
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * _FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint8_t _classify(const gnrc_pktsnip_t *pkt)
+{
+    uint32_t hash = _FNV_OFFSET;
+
+    if ((pkt->type == GNRC_NETTYPE_NETIF) &&
+        (pkt->size >= sizeof(gnrc_netif_hdr_t))) {
+        const gnrc_netif_hdr_t *hdr = pkt->data;
+
+        hash = _fnv1a(hash, gnrc_netif_hdr_get_dst_addr(hdr),
+                      hdr->dst_l2addr_len);
+        pkt = pkt->next;
+    }
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+    if ((pkt != NULL) && (pkt->type == GNRC_NETTYPE_IPV6) &&
+        (pkt->size >= sizeof(ipv6_hdr_t))) {
+        const ipv6_hdr_t *ipv6 = pkt->data;
+
+        hash = _fnv1a(hash, &ipv6->src, 2 * sizeof(ipv6_addr_t));
+        hash = _fnv1a(hash, &ipv6->nh, sizeof(ipv6->nh));
+        pkt = pkt->next;
+        /* source and destination port lead both the UDP and the TCP header */
+        if (((ipv6->nh == PROTNUM_UDP) || (ipv6->nh == PROTNUM_TCP)) &&
+            (pkt != NULL) && (pkt->size >= 2 * sizeof(uint16_t))) {
+            hash = _fnv1a(hash, pkt->data, 2 * sizeof(uint16_t));
+        }
+    }
+#endif
+    /* the low bits of FNV-1a only depend on the low bits of the input */
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return (hash % CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS) + 1;
+}
+
+static void _list_append(gnrc_netif_t *netif, uint8_t ref, uint8_t list)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    uint8_t *head = (list == _NEW) ? &q->new_flows : &q->old_flows;
+    uint8_t *tail = (list == _NEW) ? &q->new_flows_tail : &q->old_flows_tail;
+
+    _flow(netif, ref)->next = _NONE;
+    _flow(netif, ref)->list = list;
+    if (*head == _NONE) {
+        *head = ref;
+    }
+    else {
+        _flow(netif, *tail)->next = ref;
+    }
+    *tail = ref;
+}
+
+/* removes the flow at the head of its list */
+static void _list_pop(gnrc_netif_t *netif, uint8_t ref)
+{
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    gnrc_netif_pktq_flow_t *flow = _flow(netif, ref);
+    uint8_t *head = (flow->list == _NEW) ? &q->new_flows : &q->old_flows;
+
+    assert(*head == ref);
+    *head = flow->next;
+    flow->next = _NONE;
+    flow->list = _NONE;
+}
+
+static void _flow_push(gnrc_netif_t *netif, gnrc_netif_pktq_flow_t *flow,
+                       gnrc_pktqueue_t *entry)
+{
+    if (flow->head == NULL) {
+        flow->head = entry;
+    }
+    else {
+        flow->tail->next = entry;
+    }
+    flow->tail = entry;
+    flow->numof++;
+    netif->send_queue.numof++;
+}
+
+static gnrc_pktqueue_t *_flow_pop(gnrc_netif_t *netif,
+                                  gnrc_netif_pktq_flow_t *flow)
+{
+    gnrc_pktqueue_t *entry = flow->head;
+
+    if (entry != NULL) {
+        flow->head = entry->next;
+        entry->next = NULL;
+        flow->numof--;
+        netif->send_queue.numof--;
+    }
+    return entry;
+}
+
+static void _drop(gnrc_netif_pktq_flow_t *flow, gnrc_pktqueue_t *entry,
+                  uint32_t err)
+{
+    gnrc_pktsnip_t *pkt = entry->pkt;
+
+    DEBUG("gnrc_netif_pktq_fq: dropping packet %p\n", (void *)pkt);
+    entry->pkt = NULL;
+    flow->stats.drop_count++;
+    gnrc_pktbuf_release_error(pkt, err);
+}
+
+/* drops the oldest packet of the longest flow to reuse its entry */
+static gnrc_pktqueue_t *_steal_entry(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_pktq_flow_t *longest = NULL;
+    gnrc_pktqueue_t *entry;
+    gnrc_pktsnip_t *old;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS; i++) {
+        gnrc_netif_pktq_flow_t *flow = &netif->send_queue.flows[i];
+
+        if ((flow->numof > 0) &&
+            ((longest == NULL) || (flow->numof > longest->numof))) {
+            longest = flow;
+        }
+    }
+    if (longest == NULL) {
+        return NULL;
+    }
+    entry = _flow_pop(netif, longest);
+    /* hand the entry over without it ever looking free to other interfaces,
+     * releasing the old packet may block */
+    mutex_lock(&_pool_lock);
+    old = entry->pkt;
+    entry->pkt = pkt;
+    container_of(entry, _entry_t, entry)->enqueued = ztimer_now(ZTIMER_USEC);
+    mutex_unlock(&_pool_lock);
+    DEBUG("gnrc_netif_pktq_fq: dropping packet %p\n", (void *)old);
+    longest->stats.drop_count++;
+    gnrc_pktbuf_release_error(old, ENOBUFS);
+    return entry;
+}
+
+int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    assert(netif != NULL);
+    assert(pkt != NULL);
+
+    gnrc_pktqueue_t *entry = _get_free_entry(pkt);
+    uint8_t ref = _classify(pkt);
+    gnrc_netif_pktq_flow_t *flow = _flow(netif, ref);
+
+    if ((entry == NULL) && ((entry = _steal_entry(netif, pkt)) == NULL)) {
+        return -1;
+    }
+    _flow_push(netif, flow, entry);
+    if (flow->list == _NONE) {
+        flow->deficit = CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM;
+        _list_append(netif, ref, _NEW);
+    }
+    return 0;
+}
+
+int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    assert(netif != NULL);
+    assert(pkt != NULL);
+
+    gnrc_pktqueue_t *entry = _get_free_entry(pkt);
+
+    if (entry == NULL) {
+        return -1;
+    }
+    LL_PREPEND(netif->send_queue.queue, entry);
+    return 0;
+}
+
+static uint16_t _isqrt(uint16_t n)
+{
+    uint16_t res = 0;
+
+    for (uint16_t bit = 1U << 14; bit > 0; bit >>= 2) {
+        if (n >= res + bit) {
+            n -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else {
+            res >>= 1;
+        }
+    }
+    return res;
+}
+
+static inline uint32_t _control_law(uint32_t t, uint16_t count)
+{
+    return t + (CONFIG_GNRC_NETIF_PKTQ_FQ_INTERVAL_US / _isqrt(count));
+}
+
+static inline bool _reached(uint32_t now, uint32_t t)
+{
+    return (int32_t)(now - t) >= 0;
+}
+
+/* dequeues the next packet of the flow and tells if it may be dropped */
+static gnrc_pktqueue_t *_codel_pop(gnrc_netif_t *netif,
+                                   gnrc_netif_pktq_flow_t *flow, uint32_t now,
+                                   bool *ok_to_drop)
+{
+    gnrc_pktqueue_t *entry = _flow_pop(netif, flow);
+    uint32_t delay;
+
+    *ok_to_drop = false;
+    if (entry == NULL) {
+        flow->first_above = 0;
+        return NULL;
+    }
+    delay = now - _enqueued(entry);
+    /* a single packet in the queue can not be a standing queue */
+    if ((delay < CONFIG_GNRC_NETIF_PKTQ_FQ_TARGET_US) || (flow->numof == 0)) {
+        flow->first_above = 0;
+    }
+    else if (flow->first_above == 0) {
+        flow->first_above = (now + CONFIG_GNRC_NETIF_PKTQ_FQ_INTERVAL_US) | 1;
+    }
+    else if (_reached(now, flow->first_above)) {
+        *ok_to_drop = true;
+    }
+    return entry;
+}
+
+static gnrc_pktqueue_t *_codel_dequeue(gnrc_netif_t *netif,
+                                        gnrc_netif_pktq_flow_t *flow)
+{
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    bool ok_to_drop;
+    gnrc_pktqueue_t *entry = _codel_pop(netif, flow, now, &ok_to_drop);
+
+    if (entry == NULL) {
+        flow->dropping = false;
+        return NULL;
+    }
+    if (flow->dropping) {
+        if (!ok_to_drop) {
+            flow->dropping = false;
+        }
+        while (flow->dropping && _reached(now, flow->drop_next)) {
+            _drop(flow, entry, ETIMEDOUT);
+            if (flow->drop_count < UINT16_MAX) {
+                flow->drop_count++;
+            }
+            entry = _codel_pop(netif, flow, now, &ok_to_drop);
+            if ((entry == NULL) || !ok_to_drop) {
+                flow->dropping = false;
+            }
+            else {
+                flow->drop_next = _control_law(flow->drop_next,
+                                               flow->drop_count);
+            }
+        }
+    }
+    else if (ok_to_drop) {
+        uint16_t delta = flow->drop_count - flow->last_drop_count;
+
+        _drop(flow, entry, ETIMEDOUT);
+        entry = _codel_pop(netif, flow, now, &ok_to_drop);
+        flow->dropping = true;
+        /* resume the drop rate of a recent dropping state */
+        flow->drop_count = ((delta > 1) &&
+                            !_reached(now, flow->drop_next +
+                                      16 * CONFIG_GNRC_NETIF_PKTQ_FQ_INTERVAL_US))
+                         ? delta : 1;
+        flow->drop_next = _control_law(now, flow->drop_count);
+        flow->last_drop_count = flow->drop_count;
+    }
+    if (entry != NULL) {
+        uint32_t delay = now - _enqueued(entry);
+        netstats_fq_t *stats = &flow->stats;
+
+        stats->tx_count++;
+        stats->delay_avg = (int32_t)stats->delay_avg +
+                           (((int32_t)delay - (int32_t)stats->delay_avg) / 8);
+        if (delay > stats->delay_max) {
+            stats->delay_max = delay;
+        }
+    }
+    return entry;
+}
+
+gnrc_pktsnip_t *gnrc_netif_pktq_fq_get(gnrc_netif_t *netif)
+{
+    assert(netif != NULL);
+
+    gnrc_netif_pktq_t *q = &netif->send_queue;
+    gnrc_pktqueue_t *entry = gnrc_pktqueue_remove_head(&q->queue);
+    gnrc_pktsnip_t *pkt = NULL;
+
+    while ((entry == NULL) && ((q->new_flows != _NONE) ||
+                               (q->old_flows != _NONE))) {
+        uint8_t ref = (q->new_flows != _NONE) ? q->new_flows : q->old_flows;
+        gnrc_netif_pktq_flow_t *flow = _flow(netif, ref);
+
+        if (flow->deficit <= 0) {
+            flow->deficit += CONFIG_GNRC_NETIF_PKTQ_FQ_QUANTUM;
+            _list_pop(netif, ref);
+            _list_append(netif, ref, _OLD);
+            continue;
+        }
+        entry = _codel_dequeue(netif, flow);
+        if (entry == NULL) {
+            /* an emptied new flow stays active for one more round so it can
+             * not gain priority by sending in bursts */
+            bool was_new = (flow->list == _NEW);
+
+            _list_pop(netif, ref);
+            if (was_new && (q->old_flows != _NONE)) {
+                _list_append(netif, ref, _OLD);
+            }
+            continue;
+        }
+        flow->deficit -= gnrc_pkt_len(entry->pkt);
+    }
+    if (entry != NULL) {
+        pkt = entry->pkt;
+        entry->pkt = NULL;
+    }
+    return pkt;
+}
+
+/** @} */
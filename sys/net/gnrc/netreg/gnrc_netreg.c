@@ -14,7 +14,6 @@
 
 #include <errno.h>
 #include <string.h>
-#include <limits.h>
 
 #include "assert.h"
 #include "log.h"
@@ -25,6 +24,7 @@
 #include "net/gnrc/icmpv6.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/udp.h"
+#include "rwlock.h"
 #ifdef MODULE_GNRC_TCP
 #include "net/gnrc/tcp.h"
 #endif
@@ -34,31 +34,8 @@
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
-/** Held while accessing _lock_counter, and also while the exclusive lock is held */
-static mutex_t _lock_for_counter = MUTEX_INIT;
-/** Number of shared locks on netreg. Saturating arithmetic is used; if this
- * reaches UINT_MAX, the lock will never be freed again. This is likely
- * accurate, given that it will only happen when the lock was leaked, so it
- * can't be freed any more anyway.
- *
- * This can be accessed only when _lock_for_counter is held; an alternative
- * implementation with atomics would likely be possible, but for the case of "I
- * can't do that right now" it would still need a mutex. But that's
- * optimization that could be done without changing the public API.
- * */
-static unsigned int _lock_counter = 0;
-/** Held while the netreg lists are being read. This is what the exclusive
- * users block on if they can't grab the exclusive lock right away.
- *
- * This is largely used as a boolean flag (is locked / is unlocked) that is
- * modified while the _lock_for_counter is held, and will not block because it
- * is synchronized to _lock_counter being 0. It is only ever accessed outside
- * _lock_for_counter when waiting for the counter to reach 0, and even then is
- * released immediately to avoid deadlocks. (Instead, the exclusive acquisition
- * tries to acquire the _lock_for_counter, and if that fails it queues up again
- * after the reader that just snatched it).
- * */
-static mutex_t _lock_wait_exclusive = MUTEX_INIT;
+/** Shared lock on the registry, see @ref gnrc_netreg_acquire_shared */
+static rwlock_t _lock = RWLOCK_INIT;
 
 void gnrc_netreg_init(void)
 {
@@ -67,66 +44,25 @@ void gnrc_netreg_init(void)
 }
 
 void gnrc_netreg_acquire_shared(void) {
-    mutex_lock(&_lock_for_counter);
-    if (_lock_counter == 0) {
-        /* At most, this blocks for the very short time until
-         * _gnrc_netreg_acquire_exclusive returns it immediately */
-        mutex_lock(&_lock_wait_exclusive);
-    }
-    if (_lock_counter != UINT_MAX) {
-        _lock_counter += 1;
-    }
-    mutex_unlock(&_lock_for_counter);
+    rwlock_read_lock(&_lock);
 }
 
 void gnrc_netreg_release_shared(void) {
-    mutex_lock(&_lock_for_counter);
-
-    assert(_lock_counter != 0); /* Release without acquire */
-
-    if (_lock_counter != UINT_MAX) {
-        _lock_counter -= 1;
-    }
-    if (_lock_counter == 0) {
-        mutex_unlock(&_lock_wait_exclusive);
-    }
-    mutex_unlock(&_lock_for_counter);
+    rwlock_read_unlock(&_lock);
 }
 
 /** Assert that there is a shared lock on gnrc_netreg -- this should help weed
  * out callers to @ref gnrc_netreg_lookup that don't properly lock. */
 static void _gnrc_netreg_assert_shared(void) {
-#if DEVELHELP
-    /* Even if we just peek: It's not an atomic, so it needs synchronization */
-    mutex_lock(&_lock_for_counter);
-    assert(_lock_counter != 0);
-    mutex_unlock(&_lock_for_counter);
-#endif
+    assert(_lock.readers != 0);
 }
 
 static void _gnrc_netreg_acquire_exclusive(void) {
-    while (true) {
-        mutex_lock(&_lock_for_counter);
-        if (_lock_counter == 0) {
-            /* At most, this blocks for the very short time until
-             * another caller of _gnrc_netreg_acquire_exclusive returns it
-             * immediately */
-            mutex_lock(&_lock_wait_exclusive);
-            /* Leaving both locked */
-            return;
-        }
-        mutex_unlock(&_lock_for_counter);
-
-        mutex_lock(&_lock_wait_exclusive);
-        /* ... but maybe someone just started grabbing _lock_for_counter, so we
-         * give them a chance to finish rather than deadlocking them */
-        mutex_unlock(&_lock_wait_exclusive);
-    }
+    rwlock_write_lock(&_lock);
 }
 
 static void _gnrc_netreg_release_exclusive(void) {
-     mutex_unlock(&_lock_wait_exclusive);
-     mutex_unlock(&_lock_for_counter);
+    rwlock_write_unlock(&_lock);
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
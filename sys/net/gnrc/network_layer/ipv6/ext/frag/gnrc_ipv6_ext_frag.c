@@ -16,8 +16,10 @@
 #include <assert.h>
 #include <errno.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "byteorder.h"
+#include "container.h"
 #include "net/ipv6/ext/frag.h"
 #include "net/ipv6/addr.h"
 #include "net/ipv6/hdr.h"
@@ -43,6 +45,24 @@ static xtimer_t _gc_xtimer;
 static msg_t _gc_msg = { .type = GNRC_IPV6_EXT_FRAG_RBUF_GC };
 static gnrc_ipv6_ext_frag_stats_t _stats;
 
+/* reassembly buffer entries are referenced by their index + 1 */
+#define _RBUF_NONE          (0U)
+#define _RBUF_BUCKETS_NUMOF (CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE)
+
+static_assert(CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE < UINT8_MAX,
+              "CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE must be smaller than 255");
+
+typedef struct {
+    uint32_t size;      /**< bytes counted against the budget */
+    uint8_t next;       /**< next entry in the bucket or the free list */
+    uint8_t bucket;     /**< bucket the entry is in */
+} _rbuf_link_t;
+
+static _rbuf_link_t _rbuf_links[CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE];
+static uint8_t _rbuf_buckets[_RBUF_BUCKETS_NUMOF];
+static uint8_t _rbuf_free;
+static uint32_t _rbuf_bytes;
+
 /**
  * @todo    Implement better mechanism as described in
  *          https://tools.ietf.org/html/rfc7739 (for minimal approach
@@ -61,8 +81,18 @@ void gnrc_ipv6_ext_frag_init(void)
 {
 #ifdef TEST_SUITES
     memset(_rbuf, 0, sizeof(_rbuf));
+    /* all limits are pushed back below */
+    _free_limits.next = NULL;
 #endif
     _last_id = random_uint32();
+    memset(_rbuf_links, 0, sizeof(_rbuf_links));
+    memset(_rbuf_buckets, 0, sizeof(_rbuf_buckets));
+    _rbuf_free = _RBUF_NONE;
+    _rbuf_bytes = 0;
+    for (unsigned i = CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i > 0; i--) {
+        _rbuf_links[i - 1].next = _rbuf_free;
+        _rbuf_free = i;
+    }
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_POOL_SIZE; i++) {
         clist_rpush(&_free_limits, (clist_node_t *)&_limits_pool[i]);
     }
@@ -373,6 +403,37 @@ static gnrc_pktsnip_t *_determine_last_per_frag(gnrc_pktsnip_t *ptr)
 static inline void _init_rbuf(gnrc_ipv6_ext_frag_rbuf_t *rbuf, ipv6_hdr_t *ipv6,
                               uint32_t id);
 
+/**
+ * @brief   Removes the reassembly buffer entry that received its last fragment
+ *          the longest time ago
+ *
+ * @param[in] except    A reassembly buffer entry not to remove.
+ *
+ * @return  true, if an entry was removed.
+ * @return  false, if there was no entry to remove.
+ */
+static bool _evict_oldest(const gnrc_ipv6_ext_frag_rbuf_t *except);
+
+/**
+ * @brief   Makes room within @ref CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_BUDGET for a
+ *          reassembly buffer entry to grow
+ *
+ * @param[in] rbuf  A reassembly buffer entry.
+ * @param[in] size  The size gnrc_ipv6_ext_frag_rbuf_t::pkt of @p rbuf is about
+ *                  to have.
+ *
+ * @return  true, if @p rbuf may grow to @p size.
+ * @return  false, if @p size exceeds the budget even without other entries.
+ */
+static bool _reserve(const gnrc_ipv6_ext_frag_rbuf_t *rbuf, size_t size);
+
+/**
+ * @brief   Updates the bytes a reassembly buffer entry holds against the budget
+ *
+ * @param[in] rbuf  A reassembly buffer entry.
+ */
+static void _account(const gnrc_ipv6_ext_frag_rbuf_t *rbuf);
+
 /**
  * @brief   Checks if given fragment limits overlap with fragment limits already
  *          in a given reassembly buffer entry
@@ -468,10 +529,16 @@ gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt)
             DEBUG("ipv6_ext_frag: fragment length not divisible by 8");
             goto error_exit;
         }
+        if (((rbuf->pkt == NULL) || (rbuf->pkt->size < size_until)) &&
+            !_reserve(rbuf, size_until)) {
+            DEBUG("ipv6_ext_frag: reassembled packet exceeds budget\n");
+            goto error_exit;
+        }
         if (rbuf->pkt == NULL) {
             /* entry did not exist yet */
-            rbuf->pkt = gnrc_pktbuf_add(fh_snip->next, NULL, size_until,
-                                        GNRC_NETTYPE_UNDEF);
+            while (((rbuf->pkt = gnrc_pktbuf_add(fh_snip->next, NULL, size_until,
+                                                 GNRC_NETTYPE_UNDEF)) == NULL) &&
+                   _evict_oldest(rbuf)) {}
             if (rbuf->pkt == NULL) {
                 DEBUG("ipv6_ext_frag: unable to create space for reassembled "
                       "packet\n");
@@ -480,12 +547,17 @@ gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt)
         }
         else if (rbuf->pkt->size < size_until) {
             /* entry exists already but doesn't fit full datagram yet */
-            if (gnrc_pktbuf_realloc_data(rbuf->pkt, size_until) != 0) {
+            int res;
+
+            while (((res = gnrc_pktbuf_realloc_data(rbuf->pkt, size_until)) != 0) &&
+                   _evict_oldest(rbuf)) {}
+            if (res != 0) {
                 DEBUG("ipv6_ext_frag: unable to allocate space for reassembled "
                       "packet\n");
                 goto error_exit;
             }
         }
+        _account(rbuf);
         /* copy payload of fragment into reassembled datagram */
         memcpy(((uint8_t *)rbuf->pkt->data) + offset, pkt->data, pkt->size);
         /* if entry was newly created above */
@@ -539,9 +611,14 @@ gnrc_pktsnip_t *gnrc_ipv6_ext_frag_reass(gnrc_pktsnip_t *pkt)
             rbuf->ipv6 = ipv6;
             return _completed(rbuf);
         }
-        else {
+        else if (_reserve(rbuf, pkt->size)) {
             /* first fragment but first arriving */
             rbuf->pkt = pkt;
+            _account(rbuf);
+        }
+        else {
+            DEBUG("ipv6_ext_frag: fragment exceeds budget\n");
+            goto error_exit;
         }
     }
     return NULL;
@@ -552,54 +629,97 @@ error_release:
     return NULL;
 }
 
-gnrc_ipv6_ext_frag_rbuf_t *gnrc_ipv6_ext_frag_rbuf_get(ipv6_hdr_t *ipv6,
-                                                       uint32_t id)
+static unsigned _rbuf_bucket(const ipv6_hdr_t *ipv6, uint32_t id)
 {
-    gnrc_ipv6_ext_frag_rbuf_t *res = NULL, *oldest = NULL;
+    uint32_t hash = id;
+
+    /* Fibonacci hashing of the identification and both addresses */
+    for (unsigned i = 0; i < ARRAY_SIZE(ipv6->src.u32); i++) {
+        hash = (hash ^ ipv6->src.u32[i].u32 ^ ipv6->dst.u32[i].u32) *
+               0x9e3779b1U;
+    }
+    return (hash >> 16) % _RBUF_BUCKETS_NUMOF;
+}
+
+static gnrc_ipv6_ext_frag_rbuf_t *_oldest(const gnrc_ipv6_ext_frag_rbuf_t *except)
+{
+    gnrc_ipv6_ext_frag_rbuf_t *oldest = NULL;
+
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i++) {
         gnrc_ipv6_ext_frag_rbuf_t *tmp = &_rbuf[i];
-        if (tmp->ipv6 != NULL) {
-            if ((tmp->id == id) &&
-                ipv6_addr_equal(&tmp->ipv6->src, &ipv6->src) &&
-                ipv6_addr_equal(&tmp->ipv6->dst, &ipv6->dst)) {
-                return tmp;
-            }
-        }
-        else if (res == NULL) {
-            res = tmp;
-            _init_rbuf(res, ipv6, id);
+
+        if ((tmp->ipv6 == NULL) || (tmp == except)) {
+            continue;
         }
         if ((oldest == NULL) ||
             /* xtimer_now_usec() overflows every ~1.2 hours */
-            ((tmp->arrival - oldest->arrival) < (UINT32_MAX / 2))) {
+            ((int32_t)(tmp->arrival - oldest->arrival) < 0)) {
             oldest = tmp;
         }
     }
-    if ((res == NULL) &&
-        !IS_ACTIVE(CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_DO_NOT_OVERRIDE)) {
-        assert(oldest != NULL); /* reassembly buffer is full, so there needs
-                                 * to be an oldest entry */
-        DEBUG("ipv6_ext_frag: dropping oldest entry\n");
+    return oldest;
+}
+
+gnrc_ipv6_ext_frag_rbuf_t *gnrc_ipv6_ext_frag_rbuf_get(ipv6_hdr_t *ipv6,
+                                                       uint32_t id)
+{
+    unsigned bucket = _rbuf_bucket(ipv6, id);
+    gnrc_ipv6_ext_frag_rbuf_t *res;
+    uint8_t ref;
+
+    for (ref = _rbuf_buckets[bucket]; ref != _RBUF_NONE;
+         ref = _rbuf_links[ref - 1].next) {
+        gnrc_ipv6_ext_frag_rbuf_t *tmp = &_rbuf[ref - 1];
+
+        if ((tmp->id == id) &&
+            ipv6_addr_equal(&tmp->ipv6->src, &ipv6->src) &&
+            ipv6_addr_equal(&tmp->ipv6->dst, &ipv6->dst)) {
+            return tmp;
+        }
+    }
+    if (_rbuf_free == _RBUF_NONE) {
         if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
             _stats.rbuf_full++;
         }
-        gnrc_ipv6_ext_frag_rbuf_del(oldest);
-        res = oldest;
-        _init_rbuf(res, ipv6, id);
-    }
-    else if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS) && (res == NULL)) {
-        _stats.rbuf_full++;
-    }
+        if (IS_ACTIVE(CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_DO_NOT_OVERRIDE)) {
+            return NULL;
+        }
+        DEBUG("ipv6_ext_frag: dropping oldest entry\n");
+        /* reassembly buffer is full, so there needs to be an oldest entry */
+        gnrc_ipv6_ext_frag_rbuf_del(_oldest(NULL));
+    }
+    ref = _rbuf_free;
+    _rbuf_free = _rbuf_links[ref - 1].next;
+    _rbuf_links[ref - 1].next = _rbuf_buckets[bucket];
+    _rbuf_links[ref - 1].bucket = bucket;
+    _rbuf_buckets[bucket] = ref;
+    res = &_rbuf[ref - 1];
+    _init_rbuf(res, ipv6, id);
     return res;
 }
 
 void gnrc_ipv6_ext_frag_rbuf_free(gnrc_ipv6_ext_frag_rbuf_t *rbuf)
 {
-    rbuf->ipv6 = NULL;
+    uint8_t ref = (rbuf - _rbuf) + 1;
+    _rbuf_link_t *link = &_rbuf_links[ref - 1];
+    uint8_t *prev;
+
     while (rbuf->limits.next != NULL) {
         clist_node_t *tmp = clist_lpop(&rbuf->limits);
         clist_rpush(&_free_limits, tmp);
     }
+    if (rbuf->ipv6 == NULL) {
+        /* entry is already free */
+        return;
+    }
+    rbuf->ipv6 = NULL;
+    for (prev = &_rbuf_buckets[link->bucket]; *prev != ref;
+         prev = &_rbuf_links[*prev - 1].next) {}
+    *prev = link->next;
+    link->next = _rbuf_free;
+    _rbuf_free = ref;
+    _rbuf_bytes -= link->size;
+    link->size = 0;
 }
 
 void gnrc_ipv6_ext_frag_rbuf_gc(void)
@@ -607,7 +727,8 @@ void gnrc_ipv6_ext_frag_rbuf_gc(void)
     uint32_t now = xtimer_now_usec();
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i++) {
         gnrc_ipv6_ext_frag_rbuf_t *rbuf = &_rbuf[i];
-        if ((now - rbuf->arrival) > CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_TIMEOUT_US) {
+        if ((rbuf->ipv6 != NULL) &&
+            ((now - rbuf->arrival) > CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_TIMEOUT_US)) {
             gnrc_ipv6_ext_frag_rbuf_del(rbuf);
         }
     }
@@ -632,6 +753,45 @@ static inline void _init_rbuf(gnrc_ipv6_ext_frag_rbuf_t *rbuf, ipv6_hdr_t *ipv6,
     rbuf->last = 0;
 }
 
+static bool _evict_oldest(const gnrc_ipv6_ext_frag_rbuf_t *except)
+{
+    gnrc_ipv6_ext_frag_rbuf_t *oldest = _oldest(except);
+
+    if (oldest == NULL) {
+        return false;
+    }
+    DEBUG("ipv6_ext_frag: evicting oldest entry\n");
+    if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
+        _stats.rbuf_evicted++;
+    }
+    gnrc_ipv6_ext_frag_rbuf_del(oldest);
+    return true;
+}
+
+static bool _reserve(const gnrc_ipv6_ext_frag_rbuf_t *rbuf, size_t size)
+{
+    uint32_t held = _rbuf_links[rbuf - _rbuf].size;
+
+    if (size > CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_BUDGET) {
+        return false;
+    }
+    while ((_rbuf_bytes - held + size) > CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_BUDGET) {
+        if (!_evict_oldest(rbuf)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _account(const gnrc_ipv6_ext_frag_rbuf_t *rbuf)
+{
+    _rbuf_link_t *link = &_rbuf_links[rbuf - _rbuf];
+
+    _rbuf_bytes -= link->size;
+    link->size = (rbuf->pkt != NULL) ? rbuf->pkt->size : 0;
+    _rbuf_bytes += link->size;
+}
+
 static int _check_overlap(clist_node_t *node, void *arg)
 {
     _check_limits_t *limits = arg;
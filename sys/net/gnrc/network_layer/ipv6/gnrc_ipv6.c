@@ -42,6 +42,11 @@
 #include "net/fib/table.h"
 #endif
 
+#ifdef MODULE_GNRC_RPL_SR_TABLE
+#include "net/gnrc/rpl/sr_table.h"
+#include "net/gnrc/rpl/srh.h"
+#endif
+
 #include "net/gnrc/ipv6.h"
 
 #define ENABLE_DEBUG        0
@@ -186,6 +191,9 @@ static void *_event_loop(void *args)
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
     /* register interest in all IPv6 packets */
     gnrc_netreg_register(GNRC_NETTYPE_IPV6, &me_reg);
+#ifdef MODULE_GNRC_NETAPI_BURST
+    gnrc_netapi_burst_accept();
+#endif
 
     /* preinitialize ACK */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
@@ -201,6 +209,13 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+#ifdef MODULE_GNRC_NETAPI_BURST
+            case GNRC_NETAPI_MSG_TYPE_RCV_BURST:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_BURST received\n");
+                gnrc_netapi_burst_receive(msg.content.ptr, _receive);
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr, true);
@@ -334,7 +349,28 @@ static bool _is_ipv6_hdr(gnrc_pktsnip_t *hdr)
 #endif
 }
 
-static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
+/* checks if the device of @p netif can calculate the upper layer checksum
+ * of @p ipv6 (see NETOPT_CSUM_OFFLOAD) */
+static bool _csum_offload(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
+{
+    ipv6_hdr_t *hdr = ipv6->data;
+
+    if ((netif == NULL) || !(netif->flags & GNRC_NETIF_FLAGS_CSUM_OFFLOAD) ||
+        ((sizeof(ipv6_hdr_t) + byteorder_ntohs(hdr->len)) > netif->ipv6.mtu)) {
+        return false;
+    }
+    switch (hdr->nh) {
+        case PROTNUM_ICMPV6:
+        case PROTNUM_TCP:
+        case PROTNUM_UDP:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6,
+                          bool csum_offload)
 {
     int res;
     ipv6_hdr_t *hdr = ipv6->data;
@@ -434,6 +470,10 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
         prev->next = payload;
         prev = payload;
     }
+    if (csum_offload && _csum_offload(netif, ipv6)) {
+        DEBUG("ipv6: leave checksum for upper header to the device.\n");
+        return 0;
+    }
     DEBUG("ipv6: calculate checksum for upper header.\n");
     if ((res = gnrc_netreg_calc_csum(payload, ipv6)) < 0) {
         if (res != -ENOENT) {   /* if there is no checksum we are okay */
@@ -447,9 +487,9 @@ static int _fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *ipv6)
 }
 
 static bool _safe_fill_ipv6_hdr(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
-                                bool prep_hdr)
+                                bool prep_hdr, bool csum_offload)
 {
-    if (prep_hdr && (_fill_ipv6_hdr(netif, pkt) < 0)) {
+    if (prep_hdr && (_fill_ipv6_hdr(netif, pkt, csum_offload) < 0)) {
         /* error on filling up header */
         gnrc_pktbuf_release(pkt);
         return false;
@@ -490,23 +530,72 @@ static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt)
 }
 #endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
 
+#ifdef MODULE_GNRC_RPL_SR_TABLE
+static void _insert_srh(gnrc_pktsnip_t *ipv6, gnrc_pktsnip_t *srh,
+                        const ipv6_addr_t *first_hop)
+{
+    ipv6_hdr_t *hdr = ipv6->data;
+    gnrc_rpl_srh_t *rh = srh->data;
+
+    /* the upper layer checksum was already calculated for the final
+     * destination */
+    rh->nh = hdr->nh;
+    hdr->nh = PROTNUM_IPV6_EXT_RH;
+    hdr->len = byteorder_htons(byteorder_ntohs(hdr->len) + srh->size);
+    hdr->dst = *first_hop;
+    srh->next = ipv6->next;
+    ipv6->next = srh;
+}
+#endif
+
 static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
                           uint8_t netif_hdr_flags)
 {
     gnrc_ipv6_nib_nc_t nce;
+    const ipv6_addr_t *next_hop = &ipv6_hdr->dst;
+    bool csum_offload = true;
+#ifdef MODULE_GNRC_RPL_SR_TABLE
+    gnrc_pktsnip_t *srh = NULL;
+    ipv6_addr_t first_hop;
+
+    /* source route packets from the root of a non-storing mode DODAG */
+    if (prep_hdr) {
+        switch (gnrc_rpl_sr_table_route(&ipv6_hdr->dst, &first_hop, &srh)) {
+        case 0:
+            next_hop = &first_hop;
+            /* a device would calculate the checksum for the first hop */
+            csum_offload = (srh == NULL);
+            break;
+        case -ENOMEM:
+            DEBUG("ipv6: unable to allocate source routing header\n");
+            gnrc_pktbuf_release_error(pkt, ENOMEM);
+            return;
+        default:
+            break;
+        }
+    }
+#endif
 
     DEBUG("ipv6: send unicast\n");
-    if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt,
+    if (gnrc_ipv6_nib_get_next_hop_l2addr(next_hop, netif, pkt,
                                           &nce) < 0) {
         /* packet is released by NIB */
         DEBUG("ipv6: no link-layer address or interface for next hop to %s\n",
-              ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
+              ipv6_addr_to_str(addr_str, next_hop, sizeof(addr_str)));
+#ifdef MODULE_GNRC_RPL_SR_TABLE
+        gnrc_pktbuf_release(srh);
+#endif
         return;
     }
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
-    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+    if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, csum_offload)) {
+#ifdef MODULE_GNRC_RPL_SR_TABLE
+        if (srh != NULL) {
+            _insert_srh(pkt, srh, &first_hop);
+        }
+#endif
         DEBUG("ipv6: add interface header to packet\n");
         if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt,
                                      netif_hdr_flags)) == NULL) {
@@ -529,6 +618,11 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
 #endif
         _send_to_iface(netif, pkt);
     }
+#ifdef MODULE_GNRC_RPL_SR_TABLE
+    else {
+        gnrc_pktbuf_release(srh);
+    }
+#endif
 }
 
 static inline void _send_multicast_over_iface(gnrc_pktsnip_t *pkt,
@@ -596,7 +690,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                         gnrc_pktbuf_release(pkt);
                         return;
                     }
-                    if (_fill_ipv6_hdr(netif, send_pkt) < 0) {
+                    if (_fill_ipv6_hdr(netif, send_pkt, true) < 0) {
                         /* error on filling up header */
                         if (send_pkt != pkt) {
                             gnrc_pktbuf_release(send_pkt);
@@ -610,7 +704,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
             }
         }
         else {
-            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+            if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, true)) {
                 _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
             }
         }
@@ -625,7 +719,7 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                 return;
             }
         }
-        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+        if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, true)) {
             _send_multicast_over_iface(pkt, prep_hdr, netif, netif_hdr_flags);
         }
     }
@@ -634,8 +728,9 @@ static void _send_multicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
 static void _send_to_self(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif)
 {
-    /* _safe_fill_ipv6_hdr releases pkt on error */
-    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
+    /* the packet never reaches a device that could calculate the checksum;
+     * _safe_fill_ipv6_hdr releases pkt on error */
+    if (!_safe_fill_ipv6_hdr(netif, pkt, prep_hdr, false)) {
         DEBUG("ipv6: error looping packet to sender.\n");
         return;
     }
@@ -930,4 +1025,92 @@ static void _receive(gnrc_pktsnip_t *pkt)
     _demux(netif, pkt, first_nh);
 }
 
+#if IS_USED(MODULE_GNRC_IPV6_FASTPATH)
+bool gnrc_ipv6_fastpath_forward(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif_hdr = pkt->next;
+    ipv6_hdr_t *hdr = pkt->data;
+    gnrc_ipv6_nib_nc_t nce;
+    gnrc_netif_t *out;
+    size_t len;
+
+    /* only the unmarked layout the interfaces pass on */
+    if ((pkt->type != GNRC_NETTYPE_IPV6) || (pkt->size < sizeof(ipv6_hdr_t)) ||
+        (netif_hdr == NULL) || (netif_hdr->type != GNRC_NETTYPE_NETIF) ||
+        (netif_hdr->next != NULL) || !ipv6_hdr_is(hdr)) {
+        return false;
+    }
+    /* everything that might end in an ICMPv6 error or in local delivery is
+     * left to the IPv6 thread */
+    if ((hdr->hl <= 1) || (hdr->nh == PROTNUM_IPV6_EXT_HOPOPT) ||
+        ipv6_addr_is_multicast(&hdr->dst) ||
+        ipv6_addr_is_link_local(&hdr->dst) ||
+        ipv6_addr_is_loopback(&hdr->dst) ||
+        ipv6_addr_is_unspecified(&hdr->dst) ||
+        ipv6_addr_is_link_local(&hdr->src)) {
+        return false;
+    }
+    len = byteorder_ntohs(hdr->len);
+    if (((len == 0) && (hdr->nh != PROTNUM_IPV6_NONXT)) ||
+        (len > (pkt->size - sizeof(ipv6_hdr_t)))) {
+        return false;
+    }
+#ifdef MODULE_GNRC_IPV6_WHITELIST
+    if (!gnrc_ipv6_whitelisted(&hdr->src)) {
+        return false;
+    }
+#endif
+#ifdef MODULE_GNRC_IPV6_BLACKLIST
+    if (gnrc_ipv6_blacklisted(&hdr->src)) {
+        return false;
+    }
+#endif
+    /* other subscribers (e.g. gnrc_pktdump) expect to see forwarded packets */
+    if (gnrc_netreg_num(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL) > 1) {
+        return false;
+    }
+    if (gnrc_netif_get_by_ipv6_addr(&hdr->dst) != NULL) {
+        return false;
+    }
+    /* without a packet the NIB neither queues nor releases anything, so an
+     * unresolved next hop can still go the regular way */
+    if (gnrc_ipv6_nib_get_next_hop_l2addr(&hdr->dst, NULL, NULL, &nce) < 0) {
+        return false;
+    }
+    out = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
+    if ((out == NULL) || ((len + sizeof(ipv6_hdr_t)) > out->ipv6.mtu)) {
+        return false;
+    }
+
+    DEBUG("ipv6: fast path forwarding to %s\n",
+          ipv6_addr_to_str(addr_str, &hdr->dst, sizeof(addr_str)));
+#ifdef MODULE_NETSTATS_IPV6
+    /* This is read from the netif thread. To prevent data corruptions, we
+     * have to guarantee mutually exclusive access */
+    unsigned irq_state = irq_disable();
+    netif->ipv6.stats.rx_count++;
+    netif->ipv6.stats.rx_bytes += pkt->size;
+    irq_restore(irq_state);
+#else
+    (void)netif;
+#endif
+    hdr->hl--;
+    /* remove any padding that was added by lower layers */
+    if ((len + sizeof(ipv6_hdr_t)) < pkt->size) {
+        gnrc_pktbuf_realloc_data(pkt, len + sizeof(ipv6_hdr_t));
+    }
+    pkt = gnrc_pktbuf_remove_snip(pkt, netif_hdr);
+    if ((pkt = _create_netif_hdr(nce.l2addr, nce.l2addr_len, pkt, 0)) == NULL) {
+        return true;
+    }
+#ifdef MODULE_NETSTATS_IPV6
+    irq_state = irq_disable();
+    out->ipv6.stats.tx_unicast_count++;
+    irq_restore(irq_state);
+#endif
+    _send_to_iface(out, pkt);
+    return true;
+}
+#endif /* IS_USED(MODULE_GNRC_IPV6_FASTPATH) */
+
 /** @} */
@@ -395,6 +395,9 @@ static void *_event_loop(void *args)
 
     /* register interest in all 6LoWPAN packets */
     gnrc_netreg_register(GNRC_NETTYPE_SIXLOWPAN, &me_reg);
+#ifdef MODULE_GNRC_NETAPI_BURST
+    gnrc_netapi_burst_accept();
+#endif
 
     /* preinitialize ACK */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
@@ -414,6 +417,13 @@ static void *_event_loop(void *args)
                 _receive(msg.content.ptr);
                 break;
 
+#ifdef MODULE_GNRC_NETAPI_BURST
+            case GNRC_NETAPI_MSG_TYPE_RCV_BURST:
+                DEBUG("6lo: GNRC_NETAPI_MSG_TYPE_RCV_BURST received\n");
+                gnrc_netapi_burst_receive(msg.content.ptr, _receive);
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
                 _send(msg.content.ptr);
@@ -31,6 +31,7 @@
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
 #include "string_utils.h"
+#include "trace_events.h"
 
 #include "pktbuf_internal.h"
 #include "pktbuf_static.h"
@@ -438,6 +439,7 @@ static void *_pktbuf_alloc(size_t size)
         memset(ptr, ~GNRC_PKTBUF_CANARY, size);
     }
 
+    TRACE_EVENT(TRACE_EVENT_PKTBUF_ALLOC, size, ptr);
     return (void *)ptr;
 }
 
@@ -472,6 +474,8 @@ void gnrc_pktbuf_free_internal(void *data, size_t size)
         return;
     }
 
+    TRACE_EVENT(TRACE_EVENT_PKTBUF_FREE, _align(size), data);
+
     if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
         /* check if the data has already been marked as free */
         size_t chk_len = _align(size) - sizeof(*new);
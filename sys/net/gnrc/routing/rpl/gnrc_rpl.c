@@ -40,6 +40,9 @@
 #include "net/gnrc/rpl/p2p.h"
 #include "net/gnrc/rpl/p2p_dodag.h"
 #endif
+#ifdef MODULE_GNRC_RPL_SR_TABLE
+#include "net/gnrc/rpl/sr_table.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -151,6 +154,12 @@ gnrc_rpl_instance_t *gnrc_rpl_root_init(uint8_t instance_id, const ipv6_addr_t *
 
     dodag = &inst->dodag;
 
+#ifdef MODULE_GNRC_RPL_SR_TABLE
+    if (inst->mop == GNRC_RPL_MOP_NON_STORING_MODE) {
+        gnrc_rpl_sr_table_reset(dodag_id);
+    }
+#endif
+
     dodag->dtsn = 1;
     dodag->prf = 0;
     dodag->dio_interval_doubl = CONFIG_GNRC_RPL_DEFAULT_DIO_INTERVAL_DOUBLINGS;
@@ -50,6 +50,8 @@
 #include "net/gnrc/rpl/p2p.h"
 #endif
 
+#include "net/gnrc/rpl/sr_table.h"
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -510,6 +512,50 @@ static inline char *_ip_addr_str(ipv6_addr_t *addr)
     return ipv6_addr_to_str(addr_str, addr, sizeof(addr_str));
 }
 
+/* in non-storing mode the root keeps the downward routes in its own table */
+static inline bool _sr_table_used(gnrc_rpl_instance_t *inst)
+{
+    return IS_USED(MODULE_GNRC_RPL_SR_TABLE) &&
+           (inst->mop == GNRC_RPL_MOP_NON_STORING_MODE) &&
+           (inst->dodag.node_status == GNRC_RPL_ROOT_NODE);
+}
+
+/* children report their parent by the IID of its link-local address */
+static bool _is_root_addr(gnrc_rpl_dodag_t *dodag, const ipv6_addr_t *addr)
+{
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(dodag->iface);
+    eui64_t iid;
+
+    return (gnrc_netif_get_by_ipv6_addr(addr) != NULL) ||
+           ((netif != NULL) && (gnrc_netif_ipv6_get_iid(netif, &iid) > 0) &&
+            (memcmp(&iid, &addr->u64[1], sizeof(iid)) == 0));
+}
+
+static void _sr_table_update(gnrc_rpl_dodag_t *dodag,
+                             gnrc_rpl_opt_target_t *target,
+                             gnrc_rpl_opt_transit_t *transit)
+{
+    uint32_t lifetime = GNRC_RPL_SR_TABLE_LIFETIME_INF;
+    ipv6_addr_t parent;
+
+    if (target->prefix_length != IPV6_ADDR_BIT_LEN) {
+        DEBUG("RPL: ignoring target prefix %s/%d\n", _ip_addr_str(&target->target),
+              target->prefix_length);
+        return;
+    }
+    memcpy(&parent, transit + 1, sizeof(parent));
+    /* all one bits represent infinity */
+    if (transit->path_lifetime != UINT8_MAX) {
+        lifetime = transit->path_lifetime * dodag->lifetime_unit;
+    }
+    if (gnrc_rpl_sr_table_update(&target->target,
+                                 _is_root_addr(dodag, &parent) ? NULL : &parent,
+                                 lifetime) < 0) {
+        DEBUG("RPL: unable to add source route to %s\n",
+              _ip_addr_str(&target->target));
+    }
+}
+
 /** @todo allow target prefixes in target options to be of variable length */
 static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt_t *opt,
                            uint16_t len,
@@ -635,6 +681,10 @@ static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt
             if (first_target == NULL) {
                 first_target = target;
             }
+            if (_sr_table_used(inst)) {
+                /* the route is added with the transit option */
+                break;
+            }
 
             DEBUG("RPL: adding FT entry %s/%d\n", _ip_addr_str(&(target->target)),
                   target->prefix_length);
@@ -657,15 +707,21 @@ static bool _parse_options(int msg_type, gnrc_rpl_instance_t *inst, gnrc_rpl_opt
             }
 
             do {
-                DEBUG("RPL: updating FT entry %s/%d\n", _ip_addr_str(&(first_target->target)),
-                      first_target->prefix_length);
-
-                gnrc_ipv6_nib_ft_del(&(first_target->target),
-                                     first_target->prefix_length);
-                gnrc_ipv6_nib_ft_add(&(first_target->target),
-                                     first_target->prefix_length, src,
-                                     dodag->iface,
-                                     transit->path_lifetime * dodag->lifetime_unit);
+                if (_sr_table_used(inst)) {
+                    _sr_table_update(dodag, first_target, transit);
+                }
+                else {
+                    DEBUG("RPL: updating FT entry %s/%d\n",
+                          _ip_addr_str(&(first_target->target)),
+                          first_target->prefix_length);
+
+                    gnrc_ipv6_nib_ft_del(&(first_target->target),
+                                         first_target->prefix_length);
+                    gnrc_ipv6_nib_ft_add(&(first_target->target),
+                                         first_target->prefix_length, src,
+                                         dodag->iface,
+                                         transit->path_lifetime * dodag->lifetime_unit);
+                }
 
                 first_target = (gnrc_rpl_opt_target_t *)(((uint8_t *)(first_target)) +
                                                          sizeof(gnrc_rpl_opt_t) +
@@ -1035,13 +1091,14 @@ static gnrc_pktsnip_t *_dao_target_build(gnrc_pktsnip_t *pkt, ipv6_addr_t *addr,
     return opt_snip;
 }
 
-static gnrc_pktsnip_t *_dao_transit_build(gnrc_pktsnip_t *pkt, uint8_t lifetime, bool external)
+static gnrc_pktsnip_t *_dao_transit_build(gnrc_pktsnip_t *pkt, uint8_t lifetime, bool external,
+                                          const ipv6_addr_t *parent)
 {
     gnrc_rpl_opt_transit_t *transit;
     gnrc_pktsnip_t *opt_snip;
+    size_t size = sizeof(gnrc_rpl_opt_transit_t) + ((parent) ? sizeof(*parent) : 0);
 
-    if ((opt_snip = gnrc_pktbuf_add(pkt, NULL, sizeof(gnrc_rpl_opt_transit_t),
-                                    GNRC_NETTYPE_UNDEF)) == NULL) {
+    if ((opt_snip = gnrc_pktbuf_add(pkt, NULL, size, GNRC_NETTYPE_UNDEF)) == NULL) {
         DEBUG("RPL: Send DAO - no space left in packet buffer\n");
         gnrc_pktbuf_release(pkt);
         return NULL;
@@ -1054,6 +1111,11 @@ static gnrc_pktsnip_t *_dao_transit_build(gnrc_pktsnip_t *pkt, uint8_t lifetime,
     transit->path_control = 0;
     transit->path_sequence = 0;
     transit->path_lifetime = lifetime;
+    if (parent) {
+        /* the parent address of non-storing mode */
+        transit->length += sizeof(*parent);
+        memcpy(transit + 1, parent, sizeof(*parent));
+    }
     return opt_snip;
 }
 
@@ -1078,12 +1140,18 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
     }
 #endif
 
-    if (destination == NULL) {
-        if (dodag->parents == NULL) {
-            DEBUG("RPL: dodag has no preferred parent\n");
-            return;
-        }
+    bool non_storing = (inst->mop == GNRC_RPL_MOP_NON_STORING_MODE);
+
+    if ((dodag->parents == NULL) && (non_storing || (destination == NULL))) {
+        DEBUG("RPL: dodag has no preferred parent\n");
+        return;
+    }
 
+    if (non_storing) {
+        /* in non-storing mode the DAO goes straight to the root */
+        destination = &dodag->dodag_id;
+    }
+    else if (destination == NULL) {
         destination = &(dodag->parents->addr);
     }
 
@@ -1106,14 +1174,29 @@ void gnrc_rpl_send_DAO(gnrc_rpl_instance_t *inst, ipv6_addr_t *destination, uint
     }
     me = &netif->ipv6.addrs[idx];
 
+    if (non_storing) {
+        /* the parent shares the prefix and IID of its link-local address with
+         * the address configured from the prefix information option */
+        ipv6_addr_t parent = {
+            .u64 = { dodag->dodag_id.u64[0], dodag->parents->addr.u64[1] }
+        };
+
+        DEBUG("RPL: Send DAO - building transit option for parent %s\n",
+              _ip_addr_str(&parent));
+        if ((pkt = _dao_transit_build(pkt, lifetime, false, &parent)) == NULL) {
+            DEBUG("RPL: Send DAO - no space left in packet buffer\n");
+            return;
+        }
+    }
+
     /* add external and RPL FT entries */
     /* TODO: nib: dropped support for external transit options for now */
     void *ft_state = NULL;
     gnrc_ipv6_nib_ft_t fte;
-    while (gnrc_ipv6_nib_ft_iter(NULL, dodag->iface, &ft_state, &fte)) {
+    while (!non_storing && gnrc_ipv6_nib_ft_iter(NULL, dodag->iface, &ft_state, &fte)) {
         DEBUG("RPL: Send DAO - building transit option\n");
 
-        if ((pkt = _dao_transit_build(pkt, lifetime, false)) == NULL) {
+        if ((pkt = _dao_transit_build(pkt, lifetime, false, NULL)) == NULL) {
             DEBUG("RPL: Send DAO - no space left in packet buffer\n");
             return;
         }
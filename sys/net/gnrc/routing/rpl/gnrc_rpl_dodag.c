@@ -349,6 +349,10 @@ static gnrc_rpl_parent_t *_gnrc_rpl_find_preferred_parent(gnrc_rpl_dodag_t *doda
             gnrc_rpl_send_DAO(dodag->instance, &old_best->addr, 0);
             gnrc_rpl_delay_dao(dodag);
         }
+        /* the root learns about the new parent with the next DAO */
+        else if (dodag->instance->mop == GNRC_RPL_MOP_NON_STORING_MODE) {
+            gnrc_rpl_delay_dao(dodag);
+        }
 
 #ifdef MODULE_GNRC_RPL_P2P
     if (dodag->instance->mop != GNRC_RPL_P2P_MOP) {
@@ -20,11 +20,11 @@
 
 #include "net/gnrc/rpl.h"
 #include "net/gnrc/rpl/of_manager.h"
+#include "net/gnrc/rpl/mrhof.h"
 #include "of0.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
-/* !!! TODO: port etx/mrhof to the new network stack */
 
 static gnrc_rpl_of_t *objective_functions[GNRC_RPL_IMPLEMENTED_OFS_NUMOF];
 
@@ -32,7 +32,9 @@ void gnrc_rpl_of_manager_init(void)
 {
     /* insert new objective functions here */
     objective_functions[0] = gnrc_rpl_get_of0();
-    /*objective_functions[1] = gnrc_rpl_get_of_mrhof(); */
+#if IS_USED(MODULE_GNRC_RPL_MRHOF)
+    objective_functions[1] = gnrc_rpl_get_of_mrhof();
+#endif
 }
 
 /* find implemented OF via objective code point */
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_gnrc_rpl_mrhof
+ * @{
+ * @file
+ * @brief       Minimum Rank with Hysteresis Objective Function
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/dodag.h"
+#include "net/gnrc/rpl/mrhof.h"
+#include "net/gnrc/rpl/of_manager.h"
+#include "net/netstats/neighbor.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static uint16_t calc_rank(gnrc_rpl_dodag_t *, uint16_t);
+static int parent_cmp(gnrc_rpl_parent_t *, gnrc_rpl_parent_t *);
+static int which_dodag(gnrc_rpl_dodag_t *, gnrc_rpl_dio_t *);
+static void reset(gnrc_rpl_dodag_t *);
+
+static gnrc_rpl_of_t gnrc_rpl_mrhof = {
+    .ocp = GNRC_RPL_OCP_MRHOF,
+    .calc_rank = calc_rank,
+    .parent_cmp = parent_cmp,
+    .which_dodag = which_dodag,
+    .reset = reset,
+    .parent_state_callback = NULL,
+    .init = NULL,
+    .process_dio = NULL
+};
+
+/* preferred parent of each instance as of the last rank calculation */
+static gnrc_rpl_parent_t *_preferred[GNRC_RPL_INSTANCES_NUMOF];
+
+gnrc_rpl_of_t *gnrc_rpl_get_of_mrhof(void)
+{
+    return &gnrc_rpl_mrhof;
+}
+
+static gnrc_rpl_parent_t **_preferred_of(gnrc_rpl_dodag_t *dodag)
+{
+    return &_preferred[dodag->instance - gnrc_rpl_instances];
+}
+
+static int _l2addr(gnrc_netif_t *netif, const ipv6_addr_t *addr, uint8_t *l2addr)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    void *state = NULL;
+
+    while (gnrc_ipv6_nib_nc_iter(netif->pid, &state, &nce)) {
+        if (ipv6_addr_equal(&nce.ipv6, addr) && (nce.l2addr_len > 0)) {
+            memcpy(l2addr, nce.l2addr, nce.l2addr_len);
+            return nce.l2addr_len;
+        }
+    }
+    /* e.g. 6LoWPAN does not keep link-local neighbors in the cache */
+    if (ipv6_addr_is_link_local(addr) &&
+        (netif->flags & GNRC_NETIF_FLAGS_HAS_L2ADDR)) {
+        return gnrc_netif_ipv6_iid_to_addr(netif, (eui64_t *)&addr->u64[1],
+                                           l2addr);
+    }
+    return -ENOENT;
+}
+
+/* ETX of the link to @p parent in units of 1/NETSTATS_NB_ETX_DIVISOR */
+static uint16_t _link_etx(gnrc_rpl_parent_t *parent)
+{
+    gnrc_netif_t *netif = gnrc_netif_get_by_pid(parent->dodag->iface);
+    uint8_t l2addr[GNRC_NETIF_L2ADDR_MAXLEN];
+    netstats_nb_t stats;
+    int l2addr_len;
+
+    if ((netif == NULL) ||
+        ((l2addr_len = _l2addr(netif, &parent->addr, l2addr)) <= 0) ||
+        !netstats_nb_get(&netif->netif, l2addr, l2addr_len, &stats) ||
+        !netstats_nb_isfresh(&netif->netif, &stats)) {
+        return NETSTATS_NB_ETX_INIT * NETSTATS_NB_ETX_DIVISOR;
+    }
+    return stats.etx;
+}
+
+/* converts an ETX to the rank increase it corresponds to */
+static uint32_t _etx_to_rank(gnrc_rpl_dodag_t *dodag, uint32_t etx)
+{
+    return (etx * dodag->instance->min_hop_rank_inc) / NETSTATS_NB_ETX_DIVISOR;
+}
+
+/* RFC 6719, section 3.1: the rank of the parent plus the link metric */
+static uint16_t _path_cost(gnrc_rpl_parent_t *parent)
+{
+    uint16_t etx = _link_etx(parent);
+    uint32_t cost;
+
+    if ((parent->rank == GNRC_RPL_INFINITE_RANK) ||
+        (etx > CONFIG_GNRC_RPL_MRHOF_MAX_LINK_METRIC)) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    if (etx < NETSTATS_NB_ETX_DIVISOR) {
+        etx = NETSTATS_NB_ETX_DIVISOR;
+    }
+    cost = parent->rank + _etx_to_rank(parent->dodag, etx);
+    return (cost < GNRC_RPL_INFINITE_RANK) ? cost : GNRC_RPL_INFINITE_RANK;
+}
+
+void reset(gnrc_rpl_dodag_t *dodag)
+{
+    *_preferred_of(dodag) = NULL;
+}
+
+uint16_t calc_rank(gnrc_rpl_dodag_t *dodag, uint16_t base_rank)
+{
+    /* only called with base_rank == 0 after the parents were sorted */
+    (void)base_rank;
+
+    *_preferred_of(dodag) = dodag->parents;
+    if (dodag->parents == NULL) {
+        return GNRC_RPL_INFINITE_RANK;
+    }
+    return _path_cost(dodag->parents);
+}
+
+int parent_cmp(gnrc_rpl_parent_t *parent1, gnrc_rpl_parent_t *parent2)
+{
+    gnrc_rpl_parent_t *preferred = *_preferred_of(parent1->dodag);
+    uint32_t cost1 = _path_cost(parent1);
+    uint32_t cost2 = _path_cost(parent2);
+    uint32_t threshold = _etx_to_rank(parent1->dodag,
+                                      CONFIG_GNRC_RPL_MRHOF_PARENT_SWITCH_THRESHOLD);
+
+    /* RFC 6719, section 3.2.2: only switch for a significantly better path */
+    if ((parent1 == preferred) && (cost1 < GNRC_RPL_INFINITE_RANK)) {
+        cost1 = (cost1 > threshold) ? cost1 - threshold : 0;
+    }
+    else if ((parent2 == preferred) && (cost2 < GNRC_RPL_INFINITE_RANK)) {
+        cost2 = (cost2 > threshold) ? cost2 - threshold : 0;
+    }
+
+    if (cost1 < cost2) {
+        return -1;
+    }
+    else if (cost1 > cost2) {
+        return 1;
+    }
+    return 0;
+}
+
+int which_dodag(gnrc_rpl_dodag_t *d1, gnrc_rpl_dio_t *dio)
+{
+    /* DODAG selection is not specific to the objective function */
+    return gnrc_rpl_get_of_for_ocp(0)->which_dodag(d1, dio);
+}
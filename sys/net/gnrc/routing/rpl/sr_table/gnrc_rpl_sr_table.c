@@ -0,0 +1,294 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_gnrc_rpl_sr_table
+ * @{
+ * @file
+ * @brief       RPL non-storing mode source route table
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "bitfield.h"
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/rpl/sr_table.h"
+#include "net/gnrc/rpl/srh.h"
+#include "net/ipv6/ext/rh.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* entries are referenced by their index + 1 */
+#define _NONE           (0U)            /**< no entry, unknown parent */
+#define _ROOT           (UINT16_MAX)    /**< the parent is the root */
+#define _BUCKETS_NUMOF  ((CONFIG_GNRC_RPL_SR_TABLE_SIZE + 3) / 4)
+
+typedef struct {
+    network_uint64_t iid;   /**< interface identifier of the node */
+    uint32_t expires;       /**< ZTIMER_SEC time the entry expires at */
+    uint16_t parent;        /**< reference to the parent */
+    uint16_t next;          /**< next entry in the bucket or the free list */
+} _entry_t;
+
+static _entry_t _entries[CONFIG_GNRC_RPL_SR_TABLE_SIZE];
+static uint16_t _buckets[_BUCKETS_NUMOF];
+static uint16_t _free;          /**< released entries */
+static uint16_t _numof;         /**< entries ever taken from _entries */
+static network_uint64_t _prefix;
+static mutex_t _lock = MUTEX_INIT;
+
+static inline _entry_t *_get(uint16_t ref)
+{
+    return &_entries[ref - 1];
+}
+
+static inline bool _expired(const _entry_t *e, uint32_t now)
+{
+    return (e->expires != GNRC_RPL_SR_TABLE_LIFETIME_INF) &&
+           ((int32_t)(e->expires - now) <= 0);
+}
+
+static uint16_t *_bucket(network_uint64_t iid)
+{
+    /* Fibonacci hashing of both halves of the IID */
+    uint32_t hash = (iid.u32[0] ^ iid.u32[1]) * 0x9e3779b1U;
+
+    return &_buckets[(hash >> 16) % _BUCKETS_NUMOF];
+}
+
+static uint16_t _find(network_uint64_t iid)
+{
+    uint16_t ref = *_bucket(iid);
+
+    while ((ref != _NONE) && (_get(ref)->iid.u64 != iid.u64)) {
+        ref = _get(ref)->next;
+    }
+    return ref;
+}
+
+static void _release(uint16_t ref)
+{
+    uint16_t *prev = _bucket(_get(ref)->iid);
+
+    while (*prev != ref) {
+        prev = &_get(*prev)->next;
+    }
+    *prev = _get(ref)->next;
+    _get(ref)->parent = _NONE;
+    _get(ref)->next = _free;
+    _free = ref;
+}
+
+/* releases expired entries no other entry refers to as their parent */
+static void _evict(uint32_t now)
+{
+    BITFIELD(referenced, CONFIG_GNRC_RPL_SR_TABLE_SIZE + 1) = { 0 };
+
+    for (unsigned i = 0; i < _BUCKETS_NUMOF; i++) {
+        for (uint16_t ref = _buckets[i]; ref != _NONE; ref = _get(ref)->next) {
+            if (_get(ref)->parent != _ROOT) {
+                bf_set(referenced, _get(ref)->parent);
+            }
+        }
+    }
+    for (unsigned i = 0; i < _BUCKETS_NUMOF; i++) {
+        uint16_t ref = _buckets[i];
+
+        while (ref != _NONE) {
+            uint16_t next = _get(ref)->next;
+
+            if (!bf_isset(referenced, ref) && _expired(_get(ref), now)) {
+                DEBUG("rpl_sr_table: evicting entry %u\n", ref);
+                _release(ref);
+            }
+            ref = next;
+        }
+    }
+}
+
+static uint16_t _find_or_add(network_uint64_t iid, uint32_t expires,
+                             uint32_t now)
+{
+    uint16_t ref = _find(iid);
+    uint16_t *bucket;
+
+    if (ref != _NONE) {
+        return ref;
+    }
+    if ((_free == _NONE) && (_numof == CONFIG_GNRC_RPL_SR_TABLE_SIZE)) {
+        _evict(now);
+    }
+    if (_free != _NONE) {
+        ref = _free;
+        _free = _get(ref)->next;
+    }
+    else if (_numof < CONFIG_GNRC_RPL_SR_TABLE_SIZE) {
+        ref = ++_numof;
+    }
+    else {
+        DEBUG("rpl_sr_table: table full\n");
+        return _NONE;
+    }
+    bucket = _bucket(iid);
+    _get(ref)->iid = iid;
+    _get(ref)->expires = expires;
+    _get(ref)->parent = _NONE;
+    _get(ref)->next = *bucket;
+    *bucket = ref;
+    return ref;
+}
+
+static void _remove(uint16_t ref)
+{
+    for (unsigned i = 0; i < _numof; i++) {
+        if (_entries[i].parent == ref) {
+            /* keep the entry to route to the children once it reappears */
+            _get(ref)->parent = _NONE;
+            return;
+        }
+    }
+    _release(ref);
+}
+
+static inline bool _in_prefix(const ipv6_addr_t *addr)
+{
+    return addr->u64[0].u64 == _prefix.u64;
+}
+
+void gnrc_rpl_sr_table_reset(const ipv6_addr_t *dodag_id)
+{
+    mutex_lock(&_lock);
+    memset(_entries, 0, sizeof(_entries));
+    memset(_buckets, 0, sizeof(_buckets));
+    _free = _NONE;
+    _numof = 0;
+    _prefix = dodag_id->u64[0];
+    mutex_unlock(&_lock);
+}
+
+int gnrc_rpl_sr_table_update(const ipv6_addr_t *target,
+                             const ipv6_addr_t *parent, uint32_t lifetime)
+{
+    uint32_t now = ztimer_now(ZTIMER_SEC);
+    uint32_t expires = GNRC_RPL_SR_TABLE_LIFETIME_INF;
+    uint16_t ref, parent_ref = _ROOT;
+    int res = 0;
+
+    if (!_in_prefix(target) || ((parent != NULL) && !_in_prefix(parent)) ||
+        ((parent != NULL) && (parent->u64[1].u64 == target->u64[1].u64))) {
+        return -EINVAL;
+    }
+    if (lifetime < GNRC_RPL_SR_TABLE_LIFETIME_INF) {
+        expires = ((now + lifetime) == GNRC_RPL_SR_TABLE_LIFETIME_INF)
+                ? now + lifetime - 1 : now + lifetime;
+    }
+    mutex_lock(&_lock);
+    if (lifetime == 0) {
+        if ((ref = _find(target->u64[1])) != _NONE) {
+            _remove(ref);
+        }
+    }
+    else if (((parent != NULL) &&
+              ((parent_ref = _find_or_add(parent->u64[1], expires, now)) == _NONE)) ||
+             ((ref = _find_or_add(target->u64[1], expires, now)) == _NONE)) {
+        res = -ENOMEM;
+    }
+    else {
+        _get(ref)->parent = parent_ref;
+        _get(ref)->expires = expires;
+    }
+    mutex_unlock(&_lock);
+    return res;
+}
+
+/* number of leading bytes @p a and @p b have in common */
+static unsigned _common(const network_uint64_t *a, const network_uint64_t *b)
+{
+    unsigned i = 0;
+
+    while ((i < sizeof(*a)) && (a->u8[i] == b->u8[i])) {
+        i++;
+    }
+    return i;
+}
+
+static void _write_addr(uint8_t *buf, const network_uint64_t *iid,
+                        unsigned cmpr)
+{
+    ipv6_addr_t addr = { .u64 = { _prefix, *iid } };
+
+    memcpy(buf, &addr.u8[cmpr], sizeof(addr) - cmpr);
+}
+
+int gnrc_rpl_sr_table_route(const ipv6_addr_t *dst, ipv6_addr_t *first_hop,
+                            gnrc_pktsnip_t **srh)
+{
+    uint32_t now = ztimer_now(ZTIMER_SEC);
+    uint16_t path[CONFIG_GNRC_RPL_SR_TABLE_MAX_HOPS];
+    unsigned hops = 0, cmpr = 15, size;
+    const network_uint64_t *next;
+    gnrc_rpl_srh_t *rh;
+    uint8_t *addrs;
+    uint16_t ref;
+
+    *srh = NULL;
+    mutex_lock(&_lock);
+    if (!_in_prefix(dst)) {
+        mutex_unlock(&_lock);
+        return -ENOENT;
+    }
+    /* collect the route from the destination up to the root */
+    for (ref = _find(dst->u64[1]); ref != _ROOT; ref = _get(ref)->parent) {
+        if ((ref == _NONE) || (hops == ARRAY_SIZE(path)) ||
+            _expired(_get(ref), now)) {
+            DEBUG("rpl_sr_table: no route after %u hops\n", hops);
+            mutex_unlock(&_lock);
+            return -ENOENT;
+        }
+        path[hops++] = ref;
+    }
+    next = &_get(path[hops - 1])->iid;
+    first_hop->u64[0] = _prefix;
+    first_hop->u64[1] = *next;
+    if (hops == 1) {
+        mutex_unlock(&_lock);
+        return 0;
+    }
+
+    /* each hop takes the elided octets from the current destination, so only
+     * elide what all addresses on the route have in common */
+    for (unsigned i = 0; i < hops - 1; i++) {
+        unsigned common = sizeof(_prefix) + _common(next, &_get(path[i])->iid);
+
+        cmpr = (common < cmpr) ? common : cmpr;
+    }
+    size = sizeof(gnrc_rpl_srh_t) + ((hops - 1) * (sizeof(ipv6_addr_t) - cmpr));
+
+    *srh = gnrc_pktbuf_add(NULL, NULL, (size + 7) & ~7U, GNRC_NETTYPE_IPV6_EXT);
+    if (*srh == NULL) {
+        DEBUG("rpl_sr_table: no space left in packet buffer\n");
+        mutex_unlock(&_lock);
+        return -ENOMEM;
+    }
+    rh = (*srh)->data;
+    memset(rh, 0, (*srh)->size);
+    rh->len = ((*srh)->size / 8) - 1;
+    rh->type = IPV6_EXT_RH_TYPE_RPL_SRH;
+    rh->seg_left = hops - 1;
+    rh->compr = (cmpr << 4) | cmpr;
+    rh->pad_resv = ((*srh)->size - size) << 4;
+    addrs = (uint8_t *)(rh + 1);
+    for (unsigned i = hops - 1; i > 0; i--) {
+        _write_addr(addrs, &_get(path[i - 1])->iid, cmpr);
+        addrs += sizeof(ipv6_addr_t) - cmpr;
+    }
+    mutex_unlock(&_lock);
+    return 0;
+}
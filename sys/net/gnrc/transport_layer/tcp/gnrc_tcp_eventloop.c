@@ -198,7 +198,8 @@ static int _receive(gnrc_pktsnip_t *pkt)
     }
 
     /* Validate checksum */
-    if (byteorder_ntohs(hdr->checksum) != _gnrc_tcp_pkt_calc_csum(tcp, ip, pkt)) {
+    if (!(gnrc_netif_hdr_get_flag(pkt) & GNRC_NETIF_HDR_FLAGS_CSUM_VALID) &&
+        (byteorder_ntohs(hdr->checksum) != _gnrc_tcp_pkt_calc_csum(tcp, ip, pkt))) {
 #ifndef MODULE_FUZZING
         gnrc_pktbuf_release(pkt);
         TCP_DEBUG_ERROR("-EINVAL: Invalid checksum.");
@@ -273,6 +274,13 @@ static int _receive(gnrc_pktsnip_t *pkt)
     return 0;
 }
 
+#ifdef MODULE_GNRC_NETAPI_BURST
+static void _receive_burst_pkt(gnrc_pktsnip_t *pkt)
+{
+    _receive(pkt);
+}
+#endif
+
 static void *_eventloop(__attribute__((unused)) void *arg)
 {
     TCP_DEBUG_ENTER;
@@ -293,6 +301,9 @@ static void *_eventloop(__attribute__((unused)) void *arg)
     gnrc_netreg_entry_t entry;
     gnrc_netreg_entry_init_pid(&entry, GNRC_NETREG_DEMUX_CTX_ALL, _tcp_eventloop_pid);
     gnrc_netreg_register(GNRC_NETTYPE_TCP, &entry);
+#ifdef MODULE_GNRC_NETAPI_BURST
+    gnrc_netapi_burst_accept();
+#endif
 
     /* dispatch NETAPI messages */
     while (1) {
@@ -304,6 +315,13 @@ static void *_eventloop(__attribute__((unused)) void *arg)
                 _receive((gnrc_pktsnip_t *)msg.content.ptr);
                 break;
 
+#ifdef MODULE_GNRC_NETAPI_BURST
+            case GNRC_NETAPI_MSG_TYPE_RCV_BURST:
+                TCP_DEBUG_INFO("Received GNRC_NETAPI_MSG_TYPE_RCV_BURST.");
+                gnrc_netapi_burst_receive(msg.content.ptr, _receive_burst_pkt);
+                break;
+#endif
+
             /* Pass message down the network stack */
             case GNRC_NETAPI_MSG_TYPE_SND:
                 TCP_DEBUG_INFO("Received GNRC_NETAPI_MSG_TYPE_SND.");
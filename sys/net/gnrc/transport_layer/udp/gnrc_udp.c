@@ -143,7 +143,8 @@ static void _receive(gnrc_pktsnip_t *pkt)
         gnrc_pktbuf_release(pkt);
         return;
     }
-    if (_calc_csum(udp, ipv6, pkt) != 0xFFFF) {
+    if (!(gnrc_netif_hdr_get_flag(pkt) & GNRC_NETIF_HDR_FLAGS_CSUM_VALID) &&
+        (_calc_csum(udp, ipv6, pkt) != 0xFFFF)) {
         DEBUG("udp: received packet with invalid checksum, dropping it\n");
         gnrc_pktbuf_release(pkt);
         return;
@@ -230,6 +231,9 @@ static void *_event_loop(void *arg)
     msg_init_queue(_msg_queue, GNRC_UDP_MSG_QUEUE_SIZE);
     /* register UPD at netreg */
     gnrc_netreg_register(GNRC_NETTYPE_UDP, &netreg);
+#ifdef MODULE_GNRC_NETAPI_BURST
+    gnrc_netapi_burst_accept();
+#endif
 
     /* dispatch NETAPI messages */
     while (1) {
@@ -239,6 +243,12 @@ static void *_event_loop(void *arg)
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
                 _receive(msg.content.ptr);
                 break;
+#ifdef MODULE_GNRC_NETAPI_BURST
+            case GNRC_NETAPI_MSG_TYPE_RCV_BURST:
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV_BURST\n");
+                gnrc_netapi_burst_receive(msg.content.ptr, _receive);
+                break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
                 _send(msg.content.ptr);
@@ -33,6 +33,12 @@
 /* 12 symbols -> 12 * 16us = 192us */
 #define SIFS_PERIOD_US                      (192U)
 
+#if IS_USED(MODULE_IEEE802154_SUBMAC_STATS)
+#define _STATS_ADD(submac, field, val)      ((submac)->stats.field += (val))
+#else
+#define _STATS_ADD(submac, field, val)      ((void)(submac))
+#endif
+
 /* internal type for IEEE 802.15.4 frame control field */
 enum ieee802154_fcf {
     _FCF_BEACON     = IEEE802154_FCF_TYPE_BEACON,
@@ -91,6 +97,17 @@ static ieee802154_fsm_state_t _tx_end(ieee802154_submac_t *submac, int status,
     res = ieee802154_radio_set_idle(&submac->dev, true);
 
     assert(res >= 0);
+    if (status == TX_STATUS_NO_ACK) {
+        _STATS_ADD(submac, tx_noack, 1);
+    }
+    else if (status == TX_STATUS_MEDIUM_BUSY) {
+        _STATS_ADD(submac, tx_busy, 1);
+    }
+    /* software retransmissions are counted as they happen */
+    if ((info != NULL) && (info->retrans > 0) &&
+        ieee802154_radio_has_frame_retrans(&submac->dev)) {
+        _STATS_ADD(submac, retrans, info->retrans);
+    }
     submac->cb->tx_done(submac, status, info);
     return IEEE802154_FSM_STATE_IDLE;
 }
@@ -112,6 +129,7 @@ static ieee802154_fsm_state_t _handle_tx_no_ack(ieee802154_submac_t *submac)
      * the TX procedure */
     if (_has_retrans_left(submac)) {
         submac->retrans++;
+        _STATS_ADD(submac, retrans, 1);
         res = ieee802154_radio_set_idle(&submac->dev, true);
         assert(res >= 0);
         ieee802154_submac_bh_request(submac);
@@ -280,6 +298,7 @@ static ieee802154_fsm_state_t _fsm_state_prepare(ieee802154_submac_t *submac,
                           submac->csma_backoff_us;
 
             ztimer_sleep(ZTIMER_USEC, bp);
+            _STATS_ADD(submac, backoff_us, bp);
             /* Prepare for next iteration */
             uint8_t curr_be = (submac->backoff_mask + 1) >> 1;
             if (curr_be < submac->be.max) {
@@ -358,6 +377,7 @@ static ieee802154_fsm_state_t _fsm_state_tx_process_tx_done(ieee802154_submac_t
             /* The HAL should guarantee that's still possible to transmit
              * in the current state, since the radio is still in TX_ON.
              * Therefore, this is valid */
+            _STATS_ADD(submac, cca_retries, 1);
             ieee802154_submac_bh_request(submac);
             return IEEE802154_FSM_STATE_PREPARE;
         }
@@ -460,6 +480,15 @@ ieee802154_fsm_state_t ieee802154_submac_process_ev(ieee802154_submac_t *submac,
         _print_debug(submac->fsm_state, new_state, ev);
         new_state = submac->fsm_state;
     }
+#if IS_USED(MODULE_IEEE802154_SUBMAC_STATS)
+    if (new_state != submac->fsm_state) {
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+
+        submac->stats.state_us[submac->fsm_state] += now - submac->stats.since;
+        submac->stats.state_enter[new_state]++;
+        submac->stats.since = now;
+    }
+#endif
     submac->fsm_state = new_state;
     return submac->fsm_state;
 }
@@ -488,6 +517,9 @@ int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
     submac->csma_retries_nb = 0;
     submac->backoff_mask = (1 << submac->be.min) - 1;
 
+    if (!is_ack) {
+        _STATS_ADD(submac, tx_frames, 1);
+    }
     if (!is_ack && ieee802154_submac_process_ev(submac, IEEE802154_FSM_EV_REQUEST_TX)
         != IEEE802154_FSM_STATE_PREPARE) {
         DEBUG("IEEE802154 submac: ieee802154_send(): Tx frame failed %s\n", str_states[current_state]);
@@ -501,6 +533,23 @@ int ieee802154_send(ieee802154_submac_t *submac, const iolist_t *iolist)
     return 0;
 }
 
+#if IS_USED(MODULE_IEEE802154_SUBMAC_STATS)
+void ieee802154_submac_get_stats(ieee802154_submac_t *submac,
+                                 ieee802154_submac_stats_t *stats)
+{
+    *stats = submac->stats;
+    /* account the current state up to now */
+    stats->since = ztimer_now(ZTIMER_USEC);
+    stats->state_us[submac->fsm_state] += stats->since - submac->stats.since;
+}
+
+void ieee802154_submac_reset_stats(ieee802154_submac_t *submac)
+{
+    memset(&submac->stats, 0, sizeof(submac->stats));
+    submac->stats.since = ztimer_now(ZTIMER_USEC);
+}
+#endif
+
 /*
  * MR-OQPSK timing calculations
  *
@@ -710,6 +759,9 @@ int ieee802154_submac_init(ieee802154_submac_t *submac, const network_uint16_t *
     ieee802154_dev_t *dev = &submac->dev;
 
     submac->fsm_state = IEEE802154_FSM_STATE_RX;
+#if IS_USED(MODULE_IEEE802154_SUBMAC_STATS)
+    ieee802154_submac_reset_stats(submac);
+#endif
 
     int res;
 
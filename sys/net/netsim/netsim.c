@@ -0,0 +1,450 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     net_netsim
+ * @{
+ *
+ * @file
+ * @brief       In-process radio medium simulator implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "iolist.h"
+#include "net/netdev/ieee802154.h"
+#include "net/netsim.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Thread flag to wake the simulator thread
+ */
+#define NETSIM_FLAG_WAKE    (1U << 0)
+
+static inline netsim_node_t *_node(netdev_t *netdev)
+{
+    netdev_test_t *dev = container_of(container_of(netdev, netdev_ieee802154_t,
+                                                   netdev),
+                                      netdev_test_t, netdev);
+
+    return dev->state;
+}
+
+static uint32_t _prng(netsim_t *sim)
+{
+    /* xorshift32 */
+    uint32_t x = sim->prng;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    sim->prng = x;
+    return x;
+}
+
+static netsim_frame_t *_frame_alloc(netsim_t *sim)
+{
+    for (unsigned i = 0; i < CONFIG_NETSIM_FRAME_NUMOF; i++) {
+        if (sim->frames[i].refs == 0) {
+            /* the sender holds a reference while adding deliveries */
+            sim->frames[i].refs = 1;
+            return &sim->frames[i];
+        }
+    }
+    return NULL;
+}
+
+static void _frame_release(netsim_frame_t *frame)
+{
+    frame->refs--;
+}
+
+static void _delivery_free(netsim_t *sim, netsim_delivery_t *d)
+{
+    _frame_release(d->frame);
+    d->next = sim->free;
+    sim->free = d;
+}
+
+/* returns true if d became the first pending delivery */
+static bool _pending_insert(netsim_t *sim, netsim_delivery_t *d)
+{
+    netsim_delivery_t **pos = &sim->pending;
+
+    /* keep insertion order for equal due times, so the result is
+     * reproducible */
+    while (*pos && ((int32_t)(d->due_us - (*pos)->due_us) >= 0)) {
+        pos = &(*pos)->next;
+    }
+    d->next = *pos;
+    *pos = d;
+
+    return pos == &sim->pending;
+}
+
+static int _send_frame(netsim_node_t *node, const iolist_t *iolist,
+                       const uint32_t *origin)
+{
+    netsim_t *sim = node->sim;
+    size_t len = iolist_size(iolist);
+    bool wake = false;
+
+    if (len > CONFIG_NETSIM_FRAME_SIZE) {
+        return -EMSGSIZE;
+    }
+
+    mutex_lock(&sim->lock);
+    netsim_frame_t *frame = _frame_alloc(sim);
+    if (frame == NULL) {
+        node->stats.tx_failed++;
+        mutex_unlock(&sim->lock);
+        return -ENOBUFS;
+    }
+
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    uint8_t *pos = frame->data;
+    for (const iolist_t *iol = iolist; iol; iol = iol->iol_next) {
+        memcpy(pos, iol->iol_base, iol->iol_len);
+        pos += iol->iol_len;
+    }
+    frame->len = len;
+    frame->src = node->id;
+    frame->origin_us = origin ? *origin : now;
+
+    for (unsigned dst = 0; dst < sim->numof; dst++) {
+        netsim_link_t link;
+
+        if ((dst == node->id) || !sim->link_cb(sim, node->id, dst, &link)) {
+            continue;
+        }
+        if (link.loss && ((_prng(sim) % 1000) < link.loss)) {
+            sim->nodes[dst].stats.lost++;
+            continue;
+        }
+
+        netsim_delivery_t *d = sim->free;
+        if (d == NULL) {
+            sim->nodes[dst].stats.dropped++;
+            continue;
+        }
+        sim->free = d->next;
+        d->frame = frame;
+        d->due_us = now + link.delay_us;
+        d->dst = dst;
+        frame->refs++;
+        wake |= _pending_insert(sim, d);
+    }
+
+    node->stats.tx++;
+    _frame_release(frame);
+    mutex_unlock(&sim->lock);
+
+    if (wake) {
+        thread_flags_set(thread_get(sim->pid), NETSIM_FLAG_WAKE);
+    }
+
+    return len;
+}
+
+/* called with the simulation locked, returns with it unlocked */
+static void _deliver(netsim_t *sim, netsim_delivery_t *d, uint32_t now)
+{
+    netsim_node_t *node = &sim->nodes[d->dst];
+    uint32_t latency = now - d->frame->origin_us;
+
+    node->stats.rx++;
+    node->stats.latency_sum_us += latency;
+    if (latency > node->stats.latency_max_us) {
+        node->stats.latency_max_us = latency;
+    }
+
+    if (node->rx_cb) {
+        mutex_unlock(&sim->lock);
+        node->rx_cb(node, d->frame);
+        mutex_lock(&sim->lock);
+        _delivery_free(sim, d);
+        mutex_unlock(&sim->lock);
+        return;
+    }
+
+    if (netsim_node_netdev(node)->event_callback == NULL) {
+        /* neither in raw mode nor attached to a stack */
+        node->stats.dropped++;
+        _delivery_free(sim, d);
+        mutex_unlock(&sim->lock);
+        return;
+    }
+
+    /* netdev mode: queue until the stack reads the frame */
+    netsim_delivery_t **tail = &node->rx_queue;
+    while (*tail) {
+        tail = &(*tail)->next;
+    }
+    d->next = NULL;
+    *tail = d;
+    if (++node->stats.queued > node->stats.queued_max) {
+        node->stats.queued_max = node->stats.queued;
+    }
+    mutex_unlock(&sim->lock);
+
+    netdev_trigger_event_isr(netsim_node_netdev(node));
+}
+
+static void _wake(void *arg)
+{
+    thread_flags_set(arg, NETSIM_FLAG_WAKE);
+}
+
+static void *_netsim_thread(void *arg)
+{
+    netsim_t *sim = arg;
+    ztimer_t timer = { .callback = _wake, .arg = thread_get_active() };
+
+    while (1) {
+        mutex_lock(&sim->lock);
+        netsim_delivery_t *d = sim->pending;
+        uint32_t now = ztimer_now(ZTIMER_USEC);
+
+        if (d && ((int32_t)(d->due_us - now) <= 0)) {
+            sim->pending = d->next;
+            _deliver(sim, d, now);
+            continue;
+        }
+        if (d) {
+            ztimer_set(ZTIMER_USEC, &timer, d->due_us - now);
+        }
+        mutex_unlock(&sim->lock);
+
+        thread_flags_wait_any(NETSIM_FLAG_WAKE);
+        ztimer_remove(ZTIMER_USEC, &timer);
+    }
+
+    return NULL;
+}
+
+static int _netdev_send(netdev_t *netdev, const iolist_t *iolist)
+{
+    return _send_frame(_node(netdev), iolist, NULL);
+}
+
+static netsim_delivery_t *_rx_pop(netsim_node_t *node)
+{
+    netsim_delivery_t *d = node->rx_queue;
+
+    node->rx_queue = d->next;
+    node->stats.queued--;
+    return d;
+}
+
+static int _netdev_recv(netdev_t *netdev, char *buf, int len, void *info)
+{
+    netsim_node_t *node = _node(netdev);
+    netsim_t *sim = node->sim;
+
+    mutex_lock(&sim->lock);
+    if (node->rx_queue == NULL) {
+        mutex_unlock(&sim->lock);
+        return 0;
+    }
+
+    netsim_frame_t *frame = node->rx_queue->frame;
+    int res = frame->len;
+
+    if (buf == NULL) {
+        if (len > 0) {
+            /* drop the frame */
+            _delivery_free(sim, _rx_pop(node));
+        }
+        mutex_unlock(&sim->lock);
+        return res;
+    }
+
+    if (res > len) {
+        res = -ENOBUFS;
+    }
+    else {
+        memcpy(buf, frame->data, res);
+        if (info) {
+            netdev_ieee802154_rx_info_t *rx_info = info;
+            rx_info->rssi = 0;
+            rx_info->lqi = UINT8_MAX;
+            rx_info->flags = 0;
+        }
+    }
+    _delivery_free(sim, _rx_pop(node));
+    mutex_unlock(&sim->lock);
+
+    return res;
+}
+
+static void _netdev_isr(netdev_t *netdev)
+{
+    netsim_node_t *node = _node(netdev);
+    netsim_t *sim = node->sim;
+
+    while (1) {
+        mutex_lock(&sim->lock);
+        netsim_delivery_t *head = node->rx_queue;
+        mutex_unlock(&sim->lock);
+
+        if (head == NULL) {
+            return;
+        }
+
+        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+
+        mutex_lock(&sim->lock);
+        if (node->rx_queue == head) {
+            /* the stack did not read the frame */
+            _delivery_free(sim, _rx_pop(node));
+        }
+        mutex_unlock(&sim->lock);
+    }
+}
+
+bool netsim_link_full(const netsim_t *sim, unsigned src, unsigned dst,
+                      netsim_link_t *link)
+{
+    (void)src;
+    (void)dst;
+
+    *link = *(const netsim_link_t *)sim->link_arg;
+    return true;
+}
+
+bool netsim_link_grid(const netsim_t *sim, unsigned src, unsigned dst,
+                      netsim_link_t *link)
+{
+    const netsim_grid_t *grid = sim->link_arg;
+    unsigned src_row = src / grid->width;
+    unsigned dst_row = dst / grid->width;
+    unsigned src_col = src % grid->width;
+    unsigned dst_col = dst % grid->width;
+
+    if (((src_row == dst_row) && ((src_col + 1 == dst_col) ||
+                                  (dst_col + 1 == src_col))) ||
+        ((src_col == dst_col) && ((src_row + 1 == dst_row) ||
+                                  (dst_row + 1 == src_row)))) {
+        *link = grid->link;
+        return true;
+    }
+    return false;
+}
+
+int netsim_init(netsim_t *sim, netsim_node_t *nodes, unsigned numof,
+                netsim_link_cb_t link_cb, const void *link_arg,
+                uint32_t seed)
+{
+    if ((numof == 0) || (numof > UINT16_MAX)) {
+        return -EINVAL;
+    }
+
+    sim->nodes = nodes;
+    sim->numof = numof;
+    sim->link_cb = link_cb;
+    sim->link_arg = link_arg;
+    sim->pending = NULL;
+    /* xorshift must not start at 0 */
+    sim->prng = seed ? seed : 1;
+    mutex_init(&sim->lock);
+
+    memset(sim->frames, 0, sizeof(sim->frames));
+    sim->free = NULL;
+    for (unsigned i = 0; i < CONFIG_NETSIM_DELIVERY_NUMOF; i++) {
+        sim->deliveries[i].next = sim->free;
+        sim->free = &sim->deliveries[i];
+    }
+
+    for (unsigned i = 0; i < numof; i++) {
+        netsim_node_t *node = &nodes[i];
+
+        memset(node, 0, sizeof(*node));
+        node->sim = sim;
+        node->id = i;
+        netdev_test_setup(&node->dev, node);
+        netdev_test_set_send_cb(&node->dev, _netdev_send);
+        netdev_test_set_recv_cb(&node->dev, _netdev_recv);
+        netdev_test_set_isr_cb(&node->dev, _netdev_isr);
+    }
+
+    int res = thread_create(sim->stack, sizeof(sim->stack), CONFIG_NETSIM_PRIO,
+                            0, _netsim_thread, sim, "netsim");
+    if (res < 0) {
+        return res;
+    }
+    sim->pid = res;
+
+    return 0;
+}
+
+void netsim_node_set_rx_cb(netsim_node_t *node, netsim_rx_cb_t cb, void *arg)
+{
+    mutex_lock(&node->sim->lock);
+    node->rx_cb = cb;
+    node->arg = arg;
+    mutex_unlock(&node->sim->lock);
+}
+
+int netsim_send(netsim_node_t *node, const void *data, size_t len)
+{
+    iolist_t iol = { .iol_base = (void *)data, .iol_len = len };
+
+    return _send_frame(node, &iol, NULL);
+}
+
+int netsim_forward(netsim_node_t *node, const netsim_frame_t *frame)
+{
+    iolist_t iol = { .iol_base = (void *)frame->data, .iol_len = frame->len };
+
+    return _send_frame(node, &iol, &frame->origin_us);
+}
+
+void netsim_get_stats(netsim_node_t *node, netsim_stats_t *stats)
+{
+    mutex_lock(&node->sim->lock);
+    *stats = node->stats;
+    mutex_unlock(&node->sim->lock);
+}
+
+void netsim_reset_stats(netsim_t *sim)
+{
+    mutex_lock(&sim->lock);
+    for (unsigned i = 0; i < sim->numof; i++) {
+        uint16_t queued = sim->nodes[i].stats.queued;
+
+        memset(&sim->nodes[i].stats, 0, sizeof(sim->nodes[i].stats));
+        sim->nodes[i].stats.queued = queued;
+        sim->nodes[i].stats.queued_max = queued;
+    }
+    mutex_unlock(&sim->lock);
+}
+
+void netsim_print_stats(netsim_t *sim)
+{
+    puts(" node |       tx | tx fail |       rx |     lost | dropped "
+         "| queue max | lat avg us | lat max us");
+
+    for (unsigned i = 0; i < sim->numof; i++) {
+        netsim_stats_t stats;
+
+        netsim_get_stats(&sim->nodes[i], &stats);
+        unsigned long avg = stats.rx
+                          ? (unsigned long)(stats.latency_sum_us / stats.rx)
+                          : 0;
+        printf("%5u | %8" PRIu32 " | %7" PRIu32 " | %8" PRIu32 " | %8" PRIu32
+               " | %7" PRIu32 " | %9u | %10lu | %10" PRIu32 "\n",
+               i, stats.tx, stats.tx_failed, stats.rx, stats.lost,
+               stats.dropped, stats.queued_max, avg, stats.latency_max_us);
+    }
+}
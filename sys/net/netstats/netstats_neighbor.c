@@ -23,6 +23,7 @@
 #include "net/netdev.h"
 #include "net/netstats/neighbor.h"
 #include "xtimer.h"
+#include "ztimer.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -184,7 +185,8 @@ static netstats_nb_t *netstats_nb_get_or_create(netif_t *dev, const uint8_t *l2_
     return old_entry;
 }
 
-void netstats_nb_record(netif_t *dev, const uint8_t *l2_addr, uint8_t len)
+void netstats_nb_record(netif_t *dev, const uint8_t *l2_addr, uint8_t len,
+                        size_t frame_len)
 {
     _lock(dev);
 
@@ -203,6 +205,11 @@ void netstats_nb_record(netif_t *dev, const uint8_t *l2_addr, uint8_t len)
     } else {
         dev->neighbors.stats_queue[idx] = netstats_nb_get_or_create(dev, l2_addr, len);
         dev->neighbors.stats_queue_time_tx[idx] = xtimer_now_usec();
+#ifdef MODULE_NETSTATS_NEIGHBOR_TRAFFIC
+        dev->neighbors.stats_queue_bytes[idx] = frame_len;
+#else
+        (void)frame_len;
+#endif
     }
 
 out:
@@ -211,7 +218,8 @@ out:
 
 /* Get the first available neighbor in the transmission queue
  * and increment pointer. */
-static netstats_nb_t *netstats_nb_get_recorded(netif_t *dev, uint32_t *time_tx)
+static netstats_nb_t *netstats_nb_get_recorded(netif_t *dev, uint32_t *time_tx,
+                                               size_t *frame_len)
 {
     netstats_nb_t *res;
     int idx = cib_get(&dev->neighbors.stats_idx);
@@ -227,6 +235,11 @@ static netstats_nb_t *netstats_nb_get_recorded(netif_t *dev, uint32_t *time_tx)
     dev->neighbors.stats_queue[idx] = NULL;
 
     *time_tx = dev->neighbors.stats_queue_time_tx[idx];
+#ifdef MODULE_NETSTATS_NEIGHBOR_TRAFFIC
+    *frame_len = dev->neighbors.stats_queue_bytes[idx];
+#else
+    *frame_len = 0;
+#endif
 
     return res;
 }
@@ -314,24 +327,36 @@ static void netstats_nb_update_lqi(netstats_nb_t *stats, uint8_t lqi, bool fresh
 #endif
 }
 
-static void netstats_nb_incr_count_tx(netstats_nb_t *stats, netstats_nb_result_t result)
+static void netstats_nb_incr_count_tx(netstats_nb_t *stats, netstats_nb_result_t result,
+                                      uint8_t transmissions)
 {
 #ifdef MODULE_NETSTATS_NEIGHBOR_COUNT
-    stats->tx_count++;
+    uint8_t retries = (transmissions > 1) ? transmissions - 1 : 0;
+
+    /* gracefully handle overflow, keeping the ratio of the counters */
+    if ((stats->tx_count == UINT16_MAX) || (stats->tx_busy == UINT16_MAX) ||
+        (stats->tx_retries > UINT16_MAX - retries)) {
+        stats->tx_count   >>= 4;
+        stats->tx_fail    >>= 4;
+        stats->tx_retries >>= 4;
+        stats->tx_busy    >>= 4;
+    }
 
-    /* gracefully handle overflow */
-    if (stats->tx_count == 0) {
-        stats->tx_count = ~stats->tx_count;
-        stats->tx_count = stats->tx_count >> 4;
-        stats->tx_fail  = stats->tx_fail  >> 4;
+    if (result == NETSTATS_NB_BUSY) {
+        stats->tx_busy++;
+        return;
     }
 
+    stats->tx_count++;
+    stats->tx_retries += retries;
+
     if (result != NETSTATS_NB_SUCCESS) {
         stats->tx_fail++;
     }
 #else
     (void)stats;
     (void)result;
+    (void)transmissions;
 #endif
 }
 
@@ -344,12 +369,50 @@ static void netstats_nb_incr_count_rx(netstats_nb_t *stats)
 #endif
 }
 
+#ifdef MODULE_NETSTATS_NEIGHBOR_TRAFFIC
+/* moves the throughput history on to the current time window */
+static void netstats_nb_age_history(netstats_nb_t *stats)
+{
+    uint16_t window = ztimer_now(ZTIMER_SEC) / NETSTATS_NB_HISTORY_WINDOW;
+    uint16_t diff = window - stats->history_window;
+
+    if (diff >= NETSTATS_NB_HISTORY_SIZE) {
+        memset(stats->history, 0, sizeof(stats->history));
+    }
+    else if (diff > 0) {
+        memmove(&stats->history[diff], stats->history,
+                (NETSTATS_NB_HISTORY_SIZE - diff) * sizeof(stats->history[0]));
+        memset(stats->history, 0, diff * sizeof(stats->history[0]));
+    }
+    stats->history_window = window;
+}
+#endif
+
+static void netstats_nb_incr_bytes(netstats_nb_t *stats, bool tx, size_t frame_len)
+{
+#ifdef MODULE_NETSTATS_NEIGHBOR_TRAFFIC
+    if (tx) {
+        stats->tx_bytes += frame_len;
+    }
+    else {
+        stats->rx_bytes += frame_len;
+    }
+    netstats_nb_age_history(stats);
+    stats->history[0] += frame_len;
+#else
+    (void)stats;
+    (void)tx;
+    (void)frame_len;
+#endif
+}
+
 netstats_nb_t *netstats_nb_update_tx(netif_t *dev, netstats_nb_result_t result,
                                      uint8_t transmissions)
 {
     uint32_t now = xtimer_now_usec();
     netstats_nb_t *stats;
     uint32_t time_tx = 0;
+    size_t frame_len = 0;
 
     _lock(dev);
 
@@ -357,12 +420,19 @@ netstats_nb_t *netstats_nb_update_tx(netif_t *dev, netstats_nb_result_t result,
      * Discard old events to prevent the tx start <-> tx done correlation
      * from getting out of sync. */
     do {
-        stats = netstats_nb_get_recorded(dev, &time_tx);
+        stats = netstats_nb_get_recorded(dev, &time_tx, &frame_len);
     } while (cib_avail(&dev->neighbors.stats_idx)
              && ((now - time_tx) > NETSTATS_NB_TX_TIMEOUT_MS * US_PER_MS));
 
-    /* Nothing to do for multicast or if packet was not sent */
-    if (result == NETSTATS_NB_BUSY || stats == NULL) {
+    /* Nothing to do for multicast */
+    if (stats == NULL) {
+        goto out;
+    }
+
+    netstats_nb_incr_count_tx(stats, result, transmissions);
+
+    /* Nothing else to do if packet was not sent */
+    if (result == NETSTATS_NB_BUSY) {
         goto out;
     }
 
@@ -370,7 +440,7 @@ netstats_nb_t *netstats_nb_update_tx(netif_t *dev, netstats_nb_result_t result,
 
     netstats_nb_update_time(stats, result, now - time_tx, fresh);
     netstats_nb_update_etx(stats, result, transmissions, fresh);
-    netstats_nb_incr_count_tx(stats, result);
+    netstats_nb_incr_bytes(stats, true, frame_len);
 
     incr_freshness(stats);
 
@@ -380,7 +450,8 @@ out:
 }
 
 netstats_nb_t *netstats_nb_update_rx(netif_t *dev, const uint8_t *l2_addr,
-                                     uint8_t l2_addr_len, uint8_t rssi, uint8_t lqi)
+                                     uint8_t l2_addr_len, uint8_t rssi, uint8_t lqi,
+                                     size_t frame_len)
 {
     _lock(dev);
 
@@ -392,6 +463,7 @@ netstats_nb_t *netstats_nb_update_rx(netif_t *dev, const uint8_t *l2_addr,
         netstats_nb_update_rssi(stats, rssi, fresh);
         netstats_nb_update_lqi(stats, lqi, fresh);
         netstats_nb_incr_count_rx(stats);
+        netstats_nb_incr_bytes(stats, false, frame_len);
 
         incr_freshness(stats);
     }
@@ -399,3 +471,25 @@ netstats_nb_t *netstats_nb_update_rx(netif_t *dev, const uint8_t *l2_addr,
     _unlock(dev);
     return stats;
 }
+
+bool netstats_nb_iter(netif_t *dev, unsigned *state, netstats_nb_t *out)
+{
+    bool found = false;
+
+    while (!found && (*state < NETSTATS_NB_SIZE)) {
+        netstats_nb_t *stats = &dev->neighbors.pstats[(*state)++];
+
+        _lock(dev);
+        if (stats->l2_addr_len > 0) {
+#ifdef MODULE_NETSTATS_NEIGHBOR_TRAFFIC
+            /* don't report old traffic as current */
+            netstats_nb_age_history(stats);
+#endif
+            *out = *stats;
+            found = true;
+        }
+        _unlock(dev);
+    }
+
+    return found;
+}
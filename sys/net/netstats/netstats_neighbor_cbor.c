@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @{
+ * @ingroup     net_netstats
+ * @file
+ * @brief       CBOR encoding of the neighbor level stats
+ * @}
+ */
+
+#include <errno.h>
+
+#include "nanocbor/nanocbor.h"
+#include "net/netstats/neighbor.h"
+
+static void _encode_uint(nanocbor_encoder_t *enc, netstats_nb_cbor_key_t key,
+                         uint32_t val)
+{
+    nanocbor_fmt_uint(enc, key);
+    nanocbor_fmt_uint(enc, val);
+}
+
+static void _encode(nanocbor_encoder_t *enc, netif_t *netif,
+                    netstats_nb_t *stats)
+{
+    nanocbor_fmt_map(enc, 2
+                     + (IS_USED(MODULE_NETSTATS_NEIGHBOR_ETX) ? 1 : 0)
+                     + (IS_USED(MODULE_NETSTATS_NEIGHBOR_COUNT) ? 5 : 0)
+                     + (IS_USED(MODULE_NETSTATS_NEIGHBOR_RSSI) ? 1 : 0)
+                     + (IS_USED(MODULE_NETSTATS_NEIGHBOR_LQI) ? 1 : 0)
+                     + (IS_USED(MODULE_NETSTATS_NEIGHBOR_TX_TIME) ? 1 : 0)
+                     + (IS_USED(MODULE_NETSTATS_NEIGHBOR_TRAFFIC) ? 3 : 0));
+
+    nanocbor_fmt_uint(enc, NETSTATS_NB_CBOR_L2_ADDR);
+    nanocbor_put_bstr(enc, stats->l2_addr, stats->l2_addr_len);
+    _encode_uint(enc, NETSTATS_NB_CBOR_FRESHNESS,
+                 netstats_nb_isfresh(netif, stats) ? stats->freshness : 0);
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_ETX)
+    _encode_uint(enc, NETSTATS_NB_CBOR_ETX, stats->etx);
+#endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_COUNT)
+    _encode_uint(enc, NETSTATS_NB_CBOR_TX_COUNT, stats->tx_count);
+    _encode_uint(enc, NETSTATS_NB_CBOR_TX_FAIL, stats->tx_fail);
+    _encode_uint(enc, NETSTATS_NB_CBOR_TX_RETRIES, stats->tx_retries);
+    _encode_uint(enc, NETSTATS_NB_CBOR_TX_BUSY, stats->tx_busy);
+    _encode_uint(enc, NETSTATS_NB_CBOR_RX_COUNT, stats->rx_count);
+#endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_RSSI)
+    nanocbor_fmt_uint(enc, NETSTATS_NB_CBOR_RSSI);
+    nanocbor_fmt_int(enc, (int8_t)stats->rssi);
+#endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_LQI)
+    _encode_uint(enc, NETSTATS_NB_CBOR_LQI, stats->lqi);
+#endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_TX_TIME)
+    _encode_uint(enc, NETSTATS_NB_CBOR_TX_TIME, stats->time_tx_avg);
+#endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_TRAFFIC)
+    _encode_uint(enc, NETSTATS_NB_CBOR_TX_BYTES, stats->tx_bytes);
+    _encode_uint(enc, NETSTATS_NB_CBOR_RX_BYTES, stats->rx_bytes);
+    nanocbor_fmt_uint(enc, NETSTATS_NB_CBOR_HISTORY);
+    nanocbor_fmt_array(enc, NETSTATS_NB_HISTORY_SIZE);
+    for (unsigned i = 0; i < NETSTATS_NB_HISTORY_SIZE; i++) {
+        nanocbor_fmt_uint(enc, stats->history[i]);
+    }
+#endif
+}
+
+int netstats_nb_to_cbor(netif_t *netif, uint8_t *buf, size_t len)
+{
+    nanocbor_encoder_t enc;
+    netstats_nb_t stats;
+    unsigned state = 0;
+
+    nanocbor_encoder_init(&enc, buf, len);
+    nanocbor_fmt_array_indefinite(&enc);
+    while (netstats_nb_iter(netif, &state, &stats)) {
+        _encode(&enc, netif, &stats);
+    }
+    nanocbor_fmt_end_indefinite(&enc);
+
+    /* the encoder keeps counting past the end of the buffer */
+    if (nanocbor_encoded_len(&enc) > len) {
+        return -ENOBUFS;
+    }
+    return nanocbor_encoded_len(&enc);
+}
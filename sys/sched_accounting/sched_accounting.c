@@ -0,0 +1,220 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_sched_accounting
+ * @{
+ *
+ * @file
+ * @brief       Scheduler latency accounting implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "container.h"
+#include "irq.h"
+#include "sched_accounting.h"
+#include "thread.h"
+#include "ztimer.h"
+
+/**
+ * @brief   Pseudo reason of a thread that is runnable or not started yet
+ */
+#define BLOCK_NONE  (SCHED_ACCOUNTING_BLOCK_NUMOF)
+
+/**
+ * @brief   State of a thread needed to account the next event
+ */
+typedef struct {
+    uint32_t since;     /**< start of the block or time of the wakeup */
+    uint8_t reason;     /**< reason of the block or BLOCK_NONE */
+    bool waking;        /**< runnable, but did not run since the wakeup */
+} _state_t;
+
+static sched_accounting_t _stats[KERNEL_PID_LAST + 1];
+static _state_t _state[KERNEL_PID_LAST + 1];
+static sched_accounting_isr_t _isr_stats;
+static uint32_t _isr_start;
+static unsigned _isr_nesting;
+static bool _enabled;
+
+static uint8_t _reason(thread_status_t status)
+{
+    switch (status) {
+    case STATUS_MUTEX_BLOCKED:
+        return SCHED_ACCOUNTING_BLOCK_MUTEX;
+    case STATUS_RECEIVE_BLOCKED:
+    case STATUS_SEND_BLOCKED:
+    case STATUS_REPLY_BLOCKED:
+    case STATUS_MBOX_BLOCKED:
+        return SCHED_ACCOUNTING_BLOCK_MSG;
+    case STATUS_FLAG_BLOCKED_ANY:
+    case STATUS_FLAG_BLOCKED_ALL:
+        return SCHED_ACCOUNTING_BLOCK_FLAGS;
+    case STATUS_SLEEPING:
+        return SCHED_ACCOUNTING_BLOCK_SLEEP;
+    case STATUS_STOPPED:
+    case STATUS_ZOMBIE:
+    case STATUS_RUNNING:
+    case STATUS_PENDING:
+        return BLOCK_NONE;
+    default:
+        return SCHED_ACCOUNTING_BLOCK_OTHER;
+    }
+}
+
+static unsigned _bucket(uint32_t latency)
+{
+    if (latency == 0) {
+        return 0;
+    }
+
+    unsigned bucket = bitarithm_msb(latency) + 1;
+    return (bucket < CONFIG_SCHED_ACCOUNTING_HIST_NUMOF)
+           ? bucket : CONFIG_SCHED_ACCOUNTING_HIST_NUMOF - 1;
+}
+
+void sched_status_callback(thread_t *thread, thread_status_t old_status,
+                           thread_status_t new_status)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    sched_accounting_t *stats = &_stats[thread->pid];
+    _state_t *state = &_state[thread->pid];
+
+    if (old_status == STATUS_STOPPED) {
+        /* a new thread was created with this PID */
+        memset(stats, 0, sizeof(*stats));
+        state->reason = BLOCK_NONE;
+    }
+
+    bool was_runnable = old_status >= STATUS_ON_RUNQUEUE;
+    bool is_runnable = new_status >= STATUS_ON_RUNQUEUE;
+
+    if (was_runnable == is_runnable) {
+        return;
+    }
+
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    if (is_runnable) {
+        if (state->reason != BLOCK_NONE) {
+            stats->blocked_us[state->reason] += now - state->since;
+        }
+        state->reason = BLOCK_NONE;
+        state->waking = true;
+        stats->wakeups++;
+    }
+    else {
+        state->reason = _reason(new_status);
+        state->waking = false;
+    }
+    state->since = now;
+}
+
+void sched_accounting_switch(kernel_pid_t active, kernel_pid_t next,
+                             uint32_t now)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    if (active != KERNEL_PID_UNDEF) {
+        thread_t *thread = thread_get_unchecked(active);
+        if (thread && (thread->status >= STATUS_ON_RUNQUEUE)) {
+            _stats[active].preemptions++;
+        }
+    }
+
+    if ((next != KERNEL_PID_UNDEF) && _state[next].waking) {
+        sched_accounting_t *stats = &_stats[next];
+        uint32_t latency = now - _state[next].since;
+
+        _state[next].waking = false;
+        stats->latency_sum_us += latency;
+        if (latency > stats->latency_max_us) {
+            stats->latency_max_us = latency;
+        }
+        stats->latency_hist[_bucket(latency)]++;
+    }
+}
+
+void sched_accounting_isr_enter(void)
+{
+    if (_enabled && (_isr_nesting++ == 0)) {
+        _isr_start = ztimer_now(ZTIMER_USEC);
+    }
+}
+
+void sched_accounting_isr_exit(void)
+{
+    if (!_enabled || (_isr_nesting == 0) || (--_isr_nesting != 0)) {
+        return;
+    }
+
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - _isr_start;
+
+    _isr_stats.count++;
+    _isr_stats.time_us += duration;
+    if (duration > _isr_stats.max_us) {
+        _isr_stats.max_us = duration;
+    }
+}
+
+int sched_accounting_get(kernel_pid_t pid, sched_accounting_t *stats)
+{
+    if (!pid_is_valid(pid)) {
+        return -EINVAL;
+    }
+
+    unsigned state = irq_disable();
+    *stats = _stats[pid];
+    irq_restore(state);
+
+    return 0;
+}
+
+void sched_accounting_get_isr(sched_accounting_isr_t *stats)
+{
+    unsigned state = irq_disable();
+    *stats = _isr_stats;
+    irq_restore(state);
+}
+
+void sched_accounting_reset(void)
+{
+    unsigned state = irq_disable();
+    memset(_stats, 0, sizeof(_stats));
+    memset(&_isr_stats, 0, sizeof(_isr_stats));
+    /* blocks and wakeups in progress are accounted from now on */
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ARRAY_SIZE(_state); i++) {
+        _state[i].since = now;
+    }
+    irq_restore(state);
+}
+
+void auto_init_sched_accounting(void)
+{
+    /* status changes happen from anywhere, keep the clock running */
+    ztimer_acquire(ZTIMER_USEC);
+
+    unsigned state = irq_disable();
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = thread_get_unchecked(pid);
+        _state[pid].since = now;
+        _state[pid].reason = thread ? _reason(thread->status) : BLOCK_NONE;
+    }
+    _enabled = true;
+    irq_restore(state);
+}
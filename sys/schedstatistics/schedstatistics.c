@@ -22,6 +22,7 @@
  */
 
 #include "sched.h"
+#include "sched_accounting.h"
 #include "schedstatistics.h"
 #include "thread.h"
 #include "ztimer.h"
@@ -48,6 +49,10 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         next_stat->laststart = now;
         next_stat->schedules++;
     }
+
+    if (IS_USED(MODULE_SCHED_ACCOUNTING)) {
+        sched_accounting_switch(active_thread, next_thread, now);
+    }
 }
 
 void init_schedstatistics(void)
@@ -28,7 +28,8 @@
 
 static void _print_neighbors(netif_t *dev)
 {
-    netstats_nb_t *stats = &dev->neighbors.pstats[0];
+    netstats_nb_t entry;
+    unsigned state = 0;
     unsigned header_len = 0;
     char l2addr_str[3 * L2UTIL_ADDR_MAX_LEN];
     puts("Neighbor link layer stats:");
@@ -37,7 +38,7 @@ static void _print_neighbors(netif_t *dev)
         header_len += printf("  etx");
     }
     if (IS_USED(MODULE_NETSTATS_NEIGHBOR_COUNT)) {
-        header_len += printf(" sent received");
+        header_len += printf(" sent retries busy received");
     }
     if (IS_USED(MODULE_NETSTATS_NEIGHBOR_RSSI)) {
      header_len += printf("   rssi ");
@@ -48,6 +49,9 @@ static void _print_neighbors(netif_t *dev)
     if (IS_USED(MODULE_NETSTATS_NEIGHBOR_TX_TIME)) {
         header_len += printf(" avg tx time");
     }
+    if (IS_USED(MODULE_NETSTATS_NEIGHBOR_TRAFFIC)) {
+        header_len += printf("   tx bytes   rx bytes  B/s");
+    }
     printf("\n");
 
     while (header_len--) {
@@ -55,35 +59,36 @@ static void _print_neighbors(netif_t *dev)
     }
     printf("\n");
 
-    for (unsigned i = 0; i < NETSTATS_NB_SIZE; ++i) {
-        netstats_nb_t *entry = &stats[i];
-
-        if (entry->l2_addr_len == 0) {
-            continue;
-        }
-
+    while (netstats_nb_iter(dev, &state, &entry)) {
         printf("%-24s ",
-               gnrc_netif_addr_to_str(entry->l2_addr, entry->l2_addr_len, l2addr_str));
-        if (netstats_nb_isfresh(dev, entry)) {
-            printf("%5u", (unsigned)entry->freshness);
+               gnrc_netif_addr_to_str(entry.l2_addr, entry.l2_addr_len, l2addr_str));
+        if (netstats_nb_isfresh(dev, &entry)) {
+            printf("%5u", (unsigned)entry.freshness);
         } else {
             printf("STALE");
         }
 
 #if IS_USED(MODULE_NETSTATS_NEIGHBOR_ETX)
-        printf(" %3u%%", (100 * entry->etx) / NETSTATS_NB_ETX_DIVISOR);
+        printf(" %3u%%", (100 * entry.etx) / NETSTATS_NB_ETX_DIVISOR);
 #endif
 #if IS_USED(MODULE_NETSTATS_NEIGHBOR_COUNT)
-        printf(" %4"PRIu16" %8"PRIu16, entry->tx_count, entry->rx_count);
+        printf(" %4"PRIu16" %7"PRIu16" %4"PRIu16" %8"PRIu16,
+               entry.tx_count, entry.tx_retries, entry.tx_busy, entry.rx_count);
 #endif
 #if IS_USED(MODULE_NETSTATS_NEIGHBOR_RSSI)
-        printf(" %4i dBm", (int8_t) entry->rssi);
+        printf(" %4i dBm", (int8_t) entry.rssi);
 #endif
 #if IS_USED(MODULE_NETSTATS_NEIGHBOR_LQI)
-        printf(" %u", entry->lqi);
+        printf(" %u", entry.lqi);
 #endif
 #if IS_USED(MODULE_NETSTATS_NEIGHBOR_TX_TIME)
-        printf(" %7"PRIu32" µs", entry->time_tx_avg);
+        printf(" %7"PRIu32" µs", entry.time_tx_avg);
+#endif
+#if IS_USED(MODULE_NETSTATS_NEIGHBOR_TRAFFIC)
+        /* throughput of the last complete window */
+        printf(" %10"PRIu32" %10"PRIu32" %4"PRIu32, entry.tx_bytes, entry.rx_bytes,
+               entry.history[(NETSTATS_NB_HISTORY_SIZE > 1) ? 1 : 0]
+               / NETSTATS_NB_HISTORY_WINDOW);
 #endif
         printf("\n");
     }
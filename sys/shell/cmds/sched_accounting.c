@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell commands for the scheduler latency accounting
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sched_accounting.h"
+#include "shell.h"
+#include "thread.h"
+#include "timex.h"
+
+static unsigned long _ms(uint64_t us)
+{
+    return (unsigned long)(us / US_PER_MS);
+}
+
+static void _print_threads(void)
+{
+    puts("pid | name                 | wakeups | preempt | lat avg | lat max "
+         "| mutex ms |   msg ms | flags ms | sleep ms | other ms");
+
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        thread_t *thread = thread_get(pid);
+        sched_accounting_t stats;
+
+        if (!thread || (sched_accounting_get(pid, &stats) < 0)) {
+            continue;
+        }
+
+        unsigned long avg = stats.wakeups
+                          ? (unsigned long)(stats.latency_sum_us / stats.wakeups)
+                          : 0;
+
+        printf("%3" PRIkernel_pid " | %-20s | %7" PRIu32 " | %7" PRIu32
+               " | %7lu | %7" PRIu32,
+               pid, thread_get_name(thread) ? thread_get_name(thread) : "-",
+               stats.wakeups, stats.preemptions, avg, stats.latency_max_us);
+        for (unsigned i = 0; i < SCHED_ACCOUNTING_BLOCK_NUMOF; i++) {
+            printf(" | %8lu", _ms(stats.blocked_us[i]));
+        }
+        puts("");
+    }
+
+    sched_accounting_isr_t isr;
+    sched_accounting_get_isr(&isr);
+    printf("ISR: %" PRIu32 " handled, %lu ms total, %" PRIu32 " us max\n",
+           isr.count, _ms(isr.time_us), isr.max_us);
+}
+
+static int _print_hist(kernel_pid_t pid)
+{
+    sched_accounting_t stats;
+
+    if (sched_accounting_get(pid, &stats) < 0) {
+        printf("invalid PID %" PRIkernel_pid "\n", pid);
+        return 1;
+    }
+
+    puts("latency [us]         | count");
+    for (unsigned i = 0; i < CONFIG_SCHED_ACCOUNTING_HIST_NUMOF; i++) {
+        uint32_t lower = i ? sched_accounting_hist_limit(i - 1) : 0;
+        uint32_t upper = sched_accounting_hist_limit(i);
+
+        if (upper == UINT32_MAX) {
+            printf(">= %-17" PRIu32, lower);
+        }
+        else {
+            printf("%8" PRIu32 " - %8" PRIu32, lower, upper - 1);
+        }
+        printf(" | %" PRIu32 "\n", stats.latency_hist[i]);
+    }
+
+    return 0;
+}
+
+static int _schedacct_handler(int argc, char **argv)
+{
+    if (argc < 2) {
+        _print_threads();
+        return 0;
+    }
+    if (!strcmp(argv[1], "reset")) {
+        sched_accounting_reset();
+        return 0;
+    }
+    if (!strcmp(argv[1], "hist") && (argc > 2)) {
+        return _print_hist(atoi(argv[2]));
+    }
+
+    printf("usage: %s [reset|hist <pid>]\n", argv[0]);
+    return 1;
+}
+
+SHELL_COMMAND(schedacct, "Prints scheduler latency accounting", _schedacct_handler);
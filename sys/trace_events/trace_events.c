@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     sys_trace_events
+ * @{
+ *
+ * @file
+ * @brief       Binary event tracer implementation
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "atomic_utils.h"
+#include "bitarithm.h"
+#include "log.h"
+#include "trace_events.h"
+#include "ztimer.h"
+
+static_assert((CONFIG_TRACE_EVENTS_NUMOF & (CONFIG_TRACE_EVENTS_NUMOF - 1)) == 0,
+              "CONFIG_TRACE_EVENTS_NUMOF must be a power of two");
+static_assert(sizeof(trace_events_ring_t) % sizeof(trace_event_t) == 0,
+              "records in the ring must be aligned");
+
+static trace_events_ring_t *_ring;
+static bool _enabled;
+
+int trace_events_init(void *mem, size_t size)
+{
+    trace_events_ring_t *ring = mem;
+
+    if (size < sizeof(*ring) + sizeof(trace_event_t)) {
+        return -EINVAL;
+    }
+
+    _enabled = false;
+
+    size = (size - sizeof(*ring)) / sizeof(trace_event_t);
+    memset(ring, 0, sizeof(*ring) + size * sizeof(trace_event_t));
+    ring->magic = TRACE_EVENTS_MAGIC;
+    ring->version = TRACE_EVENTS_VERSION;
+    ring->record_size = sizeof(trace_event_t);
+    ring->numof = 1UL << bitarithm_msb(size);
+    ring->ticks_per_sec = 1000000LU;
+    _ring = ring;
+
+    return 0;
+}
+
+void trace_events_start(void)
+{
+    if (_ring) {
+        _enabled = true;
+    }
+}
+
+void trace_events_stop(void)
+{
+    _enabled = false;
+}
+
+const trace_events_ring_t *trace_events_ring(void)
+{
+    return _ring;
+}
+
+void trace_event(uint16_t id, uint16_t arg0, uint32_t arg1)
+{
+    trace_events_ring_t *ring = _ring;
+
+    if (!_enabled) {
+        return;
+    }
+
+    /* Reserve a slot. A writer interrupting us gets the next one, so there
+     * is no need to disable interrupts while the record is filled. */
+    uint32_t pos = atomic_fetch_add_u32(&ring->head, 1);
+    trace_event_t *event = &ring->records[pos & (ring->numof - 1)];
+
+    atomic_store_u32(&event->seq, 0);
+    event->time = ztimer_now(ZTIMER_USEC);
+    event->id = id;
+    event->arg0 = arg0;
+    event->arg1 = arg1;
+    atomic_store_u32(&event->seq, pos + 1);
+}
+
+static uint32_t _oldest(const trace_events_ring_t *ring)
+{
+    uint32_t head = atomic_load_u32(&ring->head);
+
+    return (head > ring->numof) ? head - ring->numof : 0;
+}
+
+void trace_events_reader_init(trace_events_reader_t *reader)
+{
+    reader->pos = _ring ? _oldest(_ring) : 0;
+}
+
+int trace_events_read(trace_events_reader_t *reader, trace_event_t *event)
+{
+    const trace_events_ring_t *ring = _ring;
+
+    if (!ring) {
+        return 0;
+    }
+
+    uint32_t head = atomic_load_u32(&ring->head);
+    if (head == reader->pos) {
+        return 0;
+    }
+    if ((head - reader->pos) > ring->numof) {
+        goto lost;
+    }
+
+    const trace_event_t *slot = &ring->records[reader->pos & (ring->numof - 1)];
+    uint32_t seq = atomic_load_u32(&slot->seq);
+    if (seq == 0) {
+        /* reserved, but not yet written */
+        return 0;
+    }
+    if (seq != reader->pos + 1) {
+        goto lost;
+    }
+
+    event->time = slot->time;
+    event->id = slot->id;
+    event->arg0 = slot->arg0;
+    event->arg1 = slot->arg1;
+
+    /* the slot may have been reused while it was copied */
+    if (atomic_load_u32(&slot->seq) != seq) {
+        goto lost;
+    }
+
+    event->seq = seq;
+    reader->pos++;
+    return 1;
+
+lost:
+    reader->pos = _oldest(ring);
+    return -EOVERFLOW;
+}
+
+__attribute__((weak))
+void *trace_events_backend_mem(size_t *size)
+{
+    static uint32_t _buf[(sizeof(trace_events_ring_t) +
+                          CONFIG_TRACE_EVENTS_NUMOF * sizeof(trace_event_t)) /
+                         sizeof(uint32_t)];
+
+    *size = sizeof(_buf);
+    return _buf;
+}
+
+void auto_init_trace_events(void)
+{
+    size_t size;
+    void *mem = trace_events_backend_mem(&size);
+
+    if (!mem || (trace_events_init(mem, size) < 0)) {
+        LOG_WARNING("trace_events: no memory for the ring\n");
+        return;
+    }
+
+    /* the timestamps are taken from anywhere, keep the clock running */
+    ztimer_acquire(ZTIMER_USEC);
+    trace_events_start();
+}
@@ -17,6 +17,10 @@
  * @}
  */
 
+#include <stdatomic.h>
+#include <string.h>
+
+#include "atomic_utils.h"
 #include "irq.h"
 #include "tsrb.h"
 #include "turb.h"
@@ -76,3 +80,101 @@ int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
     irq_restore(irq_state);
     return cnt;
 }
+
+/* In the lock-free functions, each side owns one index and only reads the
+ * other one. The fences order the accesses to the buffer with respect to the
+ * update of the owned index. */
+
+static inline unsigned _load_index(const unsigned *idx)
+{
+    return atomic_load_unsigned((const volatile unsigned *)idx);
+}
+
+static inline void _store_index(unsigned *idx, unsigned val)
+{
+    atomic_store_unsigned((volatile unsigned *)idx, val);
+}
+
+size_t tsrb_write_reserve(tsrb_t *rb, uint8_t **buf)
+{
+    unsigned writes = rb->writes;
+    unsigned free = rb->size - (writes - _load_index(&rb->reads));
+    unsigned idx = writes & (rb->size - 1);
+
+    /* the consumer must be done reading before the space is reused */
+    atomic_thread_fence(memory_order_acquire);
+
+    *buf = &rb->buf[idx];
+    return (free < rb->size - idx) ? free : rb->size - idx;
+}
+
+void tsrb_write_commit(tsrb_t *rb, size_t n)
+{
+    assert(n <= rb->size - (rb->writes - _load_index(&rb->reads)));
+
+    atomic_thread_fence(memory_order_release);
+    _store_index(&rb->writes, rb->writes + n);
+}
+
+size_t tsrb_read_reserve(tsrb_t *rb, const uint8_t **buf)
+{
+    unsigned reads = rb->reads;
+    unsigned avail = _load_index(&rb->writes) - reads;
+    unsigned idx = reads & (rb->size - 1);
+
+    atomic_thread_fence(memory_order_acquire);
+
+    *buf = &rb->buf[idx];
+    return (avail < rb->size - idx) ? avail : rb->size - idx;
+}
+
+void tsrb_read_commit(tsrb_t *rb, size_t n)
+{
+    assert(n <= _load_index(&rb->writes) - rb->reads);
+
+    atomic_thread_fence(memory_order_release);
+    _store_index(&rb->reads, rb->reads + n);
+}
+
+int tsrb_spsc_add(tsrb_t *rb, const uint8_t *src, size_t n)
+{
+    size_t cnt = 0;
+
+    /* at most two chunks: up to the end of the buffer and from its start */
+    for (unsigned i = 0; (i < 2) && (cnt < n); i++) {
+        uint8_t *buf;
+        size_t len = tsrb_write_reserve(rb, &buf);
+
+        if (len == 0) {
+            break;
+        }
+        if (len > n - cnt) {
+            len = n - cnt;
+        }
+        memcpy(buf, src + cnt, len);
+        tsrb_write_commit(rb, len);
+        cnt += len;
+    }
+    return (int) cnt;
+}
+
+int tsrb_spsc_get(tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    size_t cnt = 0;
+
+    for (unsigned i = 0; (i < 2) && (cnt < n); i++) {
+        const uint8_t *buf;
+        size_t len = tsrb_read_reserve(rb, &buf);
+
+        if (len == 0) {
+            break;
+        }
+        if (len > n - cnt) {
+            len = n - cnt;
+        }
+        memcpy(dst + cnt, buf, len);
+        tsrb_read_commit(rb, len);
+        cnt += len;
+    }
+    return (int) cnt;
+}
@@ -29,6 +29,7 @@
 #include "container.h"
 #include "modules.h"
 #include "mutex.h"
+#include "rwlock.h"
 #include "sched.h"
 #include "test_utils/expect.h"
 #include "thread.h"
@@ -145,7 +146,7 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
  */
 static inline int _fd_is_valid(int fd);
 
-static mutex_t _mount_mutex = MUTEX_INIT;
+static rwlock_t _mount_lock = RWLOCK_INIT;
 static mutex_t _open_mutex = MUTEX_INIT;
 
 int vfs_close(int fd)
@@ -528,7 +529,7 @@ int vfs_closedir(vfs_DIR *dirp)
 /**
  * @brief Check if the given mount point is mounted
  *
- * If the mount point is not mounted, _mount_mutex will be locked by this function
+ * If the mount point is not mounted, _mount_lock will be write-locked by this function
  *
  * @param mountp    mount point to check
  * @return 0 on success (mount point is valid and not mounted)
@@ -547,12 +548,12 @@ static int check_mount(vfs_mount_t *mountp)
         return -EINVAL;
     }
     mountp->mount_point_len = strlen(mountp->mount_point);
-    mutex_lock(&_mount_mutex);
+    rwlock_write_lock(&_mount_lock);
     /* Check for the same mount in the list of mounts to avoid loops */
     clist_node_t *found = clist_find(&_vfs_mounts_list, &mountp->list_entry);
     if (found != NULL) {
         /* Same mount is already mounted */
-        mutex_unlock(&_mount_mutex);
+        rwlock_write_unlock(&_mount_lock);
         DEBUG("vfs: check_mount: Already mounted\n");
         return -EBUSY;
     }
@@ -567,7 +568,7 @@ int vfs_format(vfs_mount_t *mountp)
     if (ret < 0) {
         return ret;
     }
-    mutex_unlock(&_mount_mutex);
+    rwlock_write_unlock(&_mount_lock);
 
     if (mountp->fs->fs_op != NULL) {
         if (mountp->fs->fs_op->format != NULL) {
@@ -593,14 +594,14 @@ int vfs_mount(vfs_mount_t *mountp)
             int res = mountp->fs->fs_op->mount(mountp);
             if (res < 0) {
                 DEBUG("vfs_mount: error %d\n", res);
-                mutex_unlock(&_mount_mutex);
+                rwlock_write_unlock(&_mount_lock);
                 return res;
             }
         }
     }
     /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
-    mutex_unlock(&_mount_mutex);
+    rwlock_write_unlock(&_mount_lock);
     DEBUG("vfs_mount: mount done\n");
     return 0;
 }
@@ -612,10 +613,12 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
     switch (ret) {
     case 0:
         DEBUG("vfs_umount: not mounted\n");
-        mutex_unlock(&_mount_mutex);
+        rwlock_write_unlock(&_mount_lock);
         return -EINVAL;
     case -EBUSY:
-        /* -EBUSY returned when fs is mounted, just continue */
+        /* -EBUSY returned when fs is mounted, just continue. check_mount()
+         * released the lock in that case, so take it again. */
+        rwlock_write_lock(&_mount_lock);
         break;
     default:
         DEBUG("vfs_umount: invalid fs\n");
@@ -624,7 +627,7 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
     DEBUG("vfs_umount: -> \"%s\" open=%u\n", mountp->mount_point,
           (unsigned)atomic_load_u16(&mountp->open_files));
     if (atomic_load_u16(&mountp->open_files) > 0 && !force) {
-        mutex_unlock(&_mount_mutex);
+        rwlock_write_unlock(&_mount_lock);
         return -EBUSY;
     }
     if (mountp->fs->fs_op != NULL) {
@@ -633,7 +636,7 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
             if (res < 0) {
                 /* umount failed */
                 DEBUG("vfs_umount: ERR %d!\n", res);
-                mutex_unlock(&_mount_mutex);
+                rwlock_write_unlock(&_mount_lock);
                 return res;
             }
         }
@@ -643,10 +646,10 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
     if (node == NULL) {
         /* not found */
         DEBUG("vfs_umount: ERR not mounted!\n");
-        mutex_unlock(&_mount_mutex);
+        rwlock_write_unlock(&_mount_lock);
         return -EINVAL;
     }
-    mutex_unlock(&_mount_mutex);
+    rwlock_write_unlock(&_mount_lock);
     return 0;
 }
 
@@ -1026,7 +1029,7 @@ bool vfs_iterate_mount_dirs(vfs_DIR *dir)
      * mounts or unmounts on the chain while iterating. However, as we know
      * that the current dir's mount point is still on, the equivalent procedure
      * of starting a new round of `vfs_iterate_mounts` from NULL and calling it
-     * until it produces `last_mp` (all while holding _mount_mutex) would leave
+     * until it produces `last_mp` (all while holding _mount_lock) would leave
      * us with the very same situation as if we started iteration with last_mp.
      *
      * On the cast discarding const: vfs_iterate_mounts's type is more for
@@ -1138,12 +1141,12 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
 {
     size_t longest_match = 0;
     size_t name_len = strlen(name);
-    mutex_lock(&_mount_mutex);
+    rwlock_read_lock(&_mount_lock);
 
     clist_node_t *node = _vfs_mounts_list.next;
     if (node == NULL) {
         /* list empty */
-        mutex_unlock(&_mount_mutex);
+        rwlock_read_unlock(&_mount_lock);
         return -ENOENT;
     }
     vfs_mount_t *mountp = NULL;
@@ -1174,7 +1177,7 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
     } while (node != _vfs_mounts_list.next);
     if (mountp == NULL) {
         /* not found */
-        mutex_unlock(&_mount_mutex);
+        rwlock_read_unlock(&_mount_lock);
         return -ENOENT;
     }
     /* Increment open files counter for this mount */
@@ -1184,7 +1187,7 @@ static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const cha
      * expect() here, which was actually written for unit tests but works
      * here as well */
     expect(before < UINT16_MAX);
-    mutex_unlock(&_mount_mutex);
+    rwlock_read_unlock(&_mount_lock);
     *mountpp = mountp;
 
     if (rel_path != NULL) {
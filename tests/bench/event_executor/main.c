@@ -0,0 +1,132 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tail latency of short tasks mixed with long ones on the
+ *              work-stealing task executor
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "container.h"
+#include "event/executor.h"
+#include "irq.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TASKS_NUMOF
+#define TASKS_NUMOF         (500U)
+#endif
+#define LONG_EVERY          (10U)
+#define SHORT_NUMOF         (TASKS_NUMOF - TASKS_NUMOF / LONG_EVERY)
+#define PERIOD_US           (1000U)
+#define SHORT_US            (50U)
+#define LONG_US             (5000U)
+#define SLOTS_NUMOF         (32U)
+#define WORKERS_MAX         (4U)
+
+typedef struct {
+    event_task_t task;
+    uint32_t busy_us;
+    uint32_t posted_us;
+    bool is_short;
+} bench_task_t;
+
+static event_executor_t _single;
+static event_executor_worker_t _single_worker[1];
+static event_executor_t _multi;
+static event_executor_worker_t _multi_workers[WORKERS_MAX];
+
+static bench_task_t _tasks[SLOTS_NUMOF];
+static uint32_t _latencies[SHORT_NUMOF];
+static unsigned _latencies_numof;
+
+static void _busy(event_t *event)
+{
+    bench_task_t *t = container_of(event, bench_task_t, task.super);
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    while (ztimer_now(ZTIMER_USEC) - start < t->busy_us) {}
+
+    if (t->is_short) {
+        /* workers preempt each other */
+        unsigned state = irq_disable();
+        _latencies[_latencies_numof++] = ztimer_now(ZTIMER_USEC) - t->posted_us;
+        irq_restore(state);
+    }
+}
+
+static int _cmp(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static uint32_t _percentile(unsigned p)
+{
+    return _latencies[(_latencies_numof - 1) * p / 100];
+}
+
+static void _run(event_executor_t *ex, event_executor_worker_t *workers,
+                 unsigned numof)
+{
+    _latencies_numof = 0;
+    for (unsigned i = 0; i < SLOTS_NUMOF; i++) {
+        event_task_init(&_tasks[i].task, _busy);
+    }
+
+    uint32_t last = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < TASKS_NUMOF; i++) {
+        bench_task_t *t = &_tasks[i % SLOTS_NUMOF];
+        event_task_wait(&t->task);
+
+        t->is_short = (i % LONG_EVERY) != (LONG_EVERY - 1);
+        t->busy_us = t->is_short ? SHORT_US : LONG_US;
+        ztimer_periodic_wakeup(ZTIMER_USEC, &last, PERIOD_US);
+        t->posted_us = ztimer_now(ZTIMER_USEC);
+        while (event_executor_post(ex, &t->task) == -ENOBUFS) {
+            ztimer_sleep(ZTIMER_USEC, PERIOD_US);
+        }
+    }
+    for (unsigned i = 0; i < SLOTS_NUMOF; i++) {
+        event_task_wait(&_tasks[i].task);
+    }
+
+    uint32_t stolen = 0;
+    for (unsigned i = 0; i < numof; i++) {
+        stolen += workers[i].stolen;
+    }
+    qsort(_latencies, _latencies_numof, sizeof(_latencies[0]), _cmp);
+    printf("{ \"workers\" : %u, \"p50\" : %" PRIu32 ", \"p90\" : %" PRIu32
+           ", \"p99\" : %" PRIu32 ", \"max\" : %" PRIu32
+           ", \"stolen\" : %" PRIu32 " }\n",
+           numof, _percentile(50), _percentile(90), _percentile(99),
+           _latencies[_latencies_numof - 1], stolen);
+}
+
+int main(void)
+{
+    event_executor_init(&_single, _single_worker, ARRAY_SIZE(_single_worker),
+                        THREAD_PRIORITY_MAIN + 1);
+    event_executor_init(&_multi, _multi_workers, ARRAY_SIZE(_multi_workers),
+                        THREAD_PRIORITY_MAIN + 1);
+
+    _run(&_single, _single_worker, ARRAY_SIZE(_single_worker));
+    _run(&_multi, _multi_workers, ARRAY_SIZE(_multi_workers));
+
+    return 0;
+}
@@ -0,0 +1,18 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for workers in (1, 4):
+        child.expect(r"{ \"workers\" : %d, \"p50\" : \d+, \"p90\" : \d+, "
+                     r"\"p99\" : \d+, \"max\" : \d+, \"stolen\" : \d+ }"
+                     % workers)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=30))
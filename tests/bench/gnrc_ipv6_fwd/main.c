@@ -0,0 +1,222 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the IPv6 forwarding rate between two interfaces
+ *
+ * Two Ethernet interfaces are emulated with netdev_test. Each round, a burst
+ * of UDP packets is received on the first one and the time until all of them
+ * went out on the second one is measured.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#ifndef BURST_NUMOF
+#define BURST_NUMOF         (4U)    /**< must fit into the IPv6 thread's queue */
+#endif
+
+#define PAYLOAD_LEN         (64U)
+#define HOP_LIMIT           (64U)
+#define IN_MAC              { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 }
+#define OUT_MAC             { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 }
+#define SRC_MAC             { 0x02, 0x00, 0x00, 0x00, 0x01, 0x01 }
+#define NBR_MAC             { 0x02, 0x00, 0x00, 0x00, 0x02, 0x01 }
+#define NBR_LINK_LOCAL      { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x02, 0x01 }
+#define SRC                 { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 }
+#define DST                 { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x02, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 }
+#define DST_PFX_LEN         (64U)
+
+#if IS_USED(MODULE_GNRC_IPV6_FASTPATH)
+#define PATH                "fast path"
+#else
+#define PATH                "IPv6 thread"
+#endif
+
+typedef struct {
+    ethernet_hdr_t eth;
+    ipv6_hdr_t ipv6;
+    uint8_t payload[PAYLOAD_LEN];
+} frame_t;
+
+typedef struct {
+    netdev_test_t dev;
+    gnrc_netif_t netif;
+    uint8_t addr[ETHERNET_ADDR_LEN];
+    char stack[THREAD_STACKSIZE_DEFAULT];
+} iface_t;
+
+static const uint8_t _nbr_mac[] = NBR_MAC;
+static const ipv6_addr_t _nbr_link_local = { .u8 = NBR_LINK_LOCAL };
+static const ipv6_addr_t _dst = { .u8 = DST };
+
+static iface_t _in = { .addr = IN_MAC };
+static iface_t _out = { .addr = OUT_MAC };
+static frame_t _frame;
+static frame_t _forwarded;
+static unsigned _forwarded_numof;
+static mutex_t _burst_done = MUTEX_INIT_LOCKED;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    iface_t *iface = container_of(dev, iface_t, dev.netdev.netdev);
+
+    expect(max_len >= sizeof(iface->addr));
+    memcpy(value, iface->addr, sizeof(iface->addr));
+    return sizeof(iface->addr);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(_frame);
+    }
+    expect(len >= (int)sizeof(_frame));
+    memcpy(buf, &_frame, sizeof(_frame));
+    return sizeof(_frame);
+}
+
+static void _isr(netdev_t *dev)
+{
+    for (unsigned i = 0; i < BURST_NUMOF; i++) {
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+/* router advertisements and the like go nowhere */
+static int _drop(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    return iolist_size(iolist);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    size_t len = iolist_size(iolist);
+
+    (void)dev;
+    if ((len != sizeof(_forwarded)) ||
+        (memcmp(iolist->iol_base, _nbr_mac, sizeof(_nbr_mac)) != 0)) {
+        return len;
+    }
+    if (_forwarded_numof == 0) {
+        iolist_to_buffer(iolist, &_forwarded, sizeof(_forwarded));
+    }
+    if (++_forwarded_numof == BURST_NUMOF) {
+        mutex_unlock(&_burst_done);
+    }
+    return len;
+}
+
+static void _iface_init(iface_t *iface, char *name,
+                        netdev_test_send_cb_t send_cb)
+{
+    netdev_test_setup(&iface->dev, NULL);
+    netdev_test_set_get_cb(&iface->dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&iface->dev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&iface->dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&iface->dev, send_cb);
+    expect(gnrc_netif_ethernet_create(&iface->netif, iface->stack,
+                                      sizeof(iface->stack), GNRC_NETIF_PRIO,
+                                      name, &iface->dev.netdev.netdev) == 0);
+}
+
+static void _frame_init(void)
+{
+    static const uint8_t src_mac[] = SRC_MAC;
+    static const ipv6_addr_t src = { .u8 = SRC };
+
+    memcpy(_frame.eth.dst, _in.addr, sizeof(_frame.eth.dst));
+    memcpy(_frame.eth.src, src_mac, sizeof(_frame.eth.src));
+    _frame.eth.type = byteorder_htons(ETHERTYPE_IPV6);
+    ipv6_hdr_set_version(&_frame.ipv6);
+    _frame.ipv6.len = byteorder_htons(sizeof(_frame.payload));
+    _frame.ipv6.nh = PROTNUM_UDP;
+    _frame.ipv6.hl = HOP_LIMIT;
+    _frame.ipv6.src = src;
+    _frame.ipv6.dst = _dst;
+    for (unsigned i = 0; i < sizeof(_frame.payload); i++) {
+        _frame.payload[i] = i;
+    }
+}
+
+static void _forward_burst(void)
+{
+    netdev_t *dev = &_in.dev.netdev.netdev;
+
+    _forwarded_numof = 0;
+    /* the interface fetches the whole burst in its thread */
+    dev->event_callback(dev, NETDEV_EVENT_ISR);
+    mutex_lock(&_burst_done);
+}
+
+int main(void)
+{
+    _iface_init(&_in, "in", _drop);
+    _iface_init(&_out, "out", _send);
+    netdev_test_set_recv_cb(&_in.dev, _recv);
+    netdev_test_set_isr_cb(&_in.dev, _isr);
+    _frame_init();
+
+    expect(gnrc_ipv6_nib_nc_set(&_nbr_link_local, _out.netif.pid,
+                                _nbr_mac, sizeof(_nbr_mac)) == 0);
+    expect(gnrc_ipv6_nib_ft_add(&_dst, DST_PFX_LEN, &_nbr_link_local,
+                                _out.netif.pid, 0) == 0);
+
+    _forward_burst();
+    expect(memcmp(_forwarded.eth.src, _out.addr, sizeof(_out.addr)) == 0);
+    expect(_forwarded.ipv6.hl == HOP_LIMIT - 1);
+    _forwarded.ipv6.hl = HOP_LIMIT;
+    expect(memcmp(&_forwarded.ipv6, &_frame.ipv6,
+                  sizeof(_frame) - sizeof(_frame.eth)) == 0);
+    puts("forwarded frame OK");
+
+    BENCHMARK_RUN("forward burst (" PATH ")", _forward_burst());
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the rate at which UDP packets make it up the stack
+ *
+ * An Ethernet interface is emulated with netdev_test. Each round, a burst of
+ * UDP packets is received within one ISR event and the time until all of
+ * them arrived at the application thread is measured.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "benchmark.h"
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef BURST_NUMOF
+#define BURST_NUMOF         (8U)    /**< must fit into the queues of all layers */
+#endif
+
+#define PAYLOAD_LEN         (64U)
+#define PORT                (5683U)
+#define TIMEOUT_MS          (100U)
+#define MAC                 { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 }
+#define SRC_MAC             { 0x02, 0x00, 0x00, 0x00, 0x01, 0x01 }
+#define SRC                 { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02 }
+#define DST                 { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x00, \
+                              0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 }
+#define DST_PFX_LEN         (64U)
+
+#if IS_USED(MODULE_GNRC_NETAPI_BURST)
+#define DISPATCH            "bursts"
+#else
+#define DISPATCH            "one by one"
+#endif
+
+typedef struct {
+    ethernet_hdr_t eth;
+    ipv6_hdr_t ipv6;
+    udp_hdr_t udp;
+    uint8_t payload[PAYLOAD_LEN];
+} frame_t;
+
+static const uint8_t _mac[] = MAC;
+static const ipv6_addr_t _dst = { .u8 = DST };
+
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _msg_queue[2 * BURST_NUMOF];
+static frame_t _frame;
+static unsigned _lost;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_mac));
+    memcpy(value, _mac, sizeof(_mac));
+    return sizeof(_mac);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(_frame);
+    }
+    expect(len >= (int)sizeof(_frame));
+    memcpy(buf, &_frame, sizeof(_frame));
+    return sizeof(_frame);
+}
+
+static void _isr(netdev_t *dev)
+{
+    for (unsigned i = 0; i < BURST_NUMOF; i++) {
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+/* neighbor and router solicitations go nowhere */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    return iolist_size(iolist);
+}
+
+static void _frame_init(void)
+{
+    static const uint8_t src_mac[] = SRC_MAC;
+    static const ipv6_addr_t src = { .u8 = SRC };
+    uint16_t len = sizeof(_frame.udp) + sizeof(_frame.payload);
+    uint16_t csum;
+
+    memcpy(_frame.eth.dst, _mac, sizeof(_frame.eth.dst));
+    memcpy(_frame.eth.src, src_mac, sizeof(_frame.eth.src));
+    _frame.eth.type = byteorder_htons(ETHERTYPE_IPV6);
+    ipv6_hdr_set_version(&_frame.ipv6);
+    _frame.ipv6.len = byteorder_htons(len);
+    _frame.ipv6.nh = PROTNUM_UDP;
+    _frame.ipv6.hl = 64;
+    _frame.ipv6.src = src;
+    _frame.ipv6.dst = _dst;
+    _frame.udp.src_port = byteorder_htons(PORT);
+    _frame.udp.dst_port = byteorder_htons(PORT);
+    _frame.udp.length = byteorder_htons(len);
+    for (unsigned i = 0; i < sizeof(_frame.payload); i++) {
+        _frame.payload[i] = i;
+    }
+    csum = ipv6_hdr_inet_csum(0, &_frame.ipv6, PROTNUM_UDP, len);
+    csum = ~inet_csum(csum, (uint8_t *)&_frame.udp, len);
+    _frame.udp.checksum = byteorder_htons((csum == 0) ? 0xffff : csum);
+}
+
+static gnrc_pktsnip_t *_receive_pkt(void)
+{
+    msg_t msg;
+
+    if (ztimer_msg_receive_timeout(ZTIMER_MSEC, &msg, TIMEOUT_MS) < 0) {
+        return NULL;
+    }
+    expect(msg.type == GNRC_NETAPI_MSG_TYPE_RCV);
+    return msg.content.ptr;
+}
+
+static void _receive_burst(void)
+{
+    netdev_t *dev = &_dev.netdev.netdev;
+
+    /* the interface fetches the whole burst in its thread */
+    dev->event_callback(dev, NETDEV_EVENT_ISR);
+    for (unsigned i = 0; i < BURST_NUMOF; i++) {
+        gnrc_pktsnip_t *pkt = _receive_pkt();
+
+        if (pkt == NULL) {
+            _lost += BURST_NUMOF - i;
+            break;
+        }
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+static void _test_datagram(void)
+{
+    netdev_t *dev = &_dev.netdev.netdev;
+    gnrc_pktsnip_t *pkt;
+
+    dev->event_callback(dev, NETDEV_EVENT_ISR);
+    for (unsigned i = 0; i < BURST_NUMOF; i++) {
+        expect((pkt = _receive_pkt()) != NULL);
+        expect(pkt->type == GNRC_NETTYPE_UNDEF);
+        expect(pkt->size == sizeof(_frame.payload));
+        expect(memcmp(pkt->data, _frame.payload, pkt->size) == 0);
+        expect(gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP) != NULL);
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(PORT,
+                                                           thread_getpid());
+
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_dev, _send);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    expect(gnrc_netif_ethernet_create(&_netif, _stack, sizeof(_stack),
+                                      GNRC_NETIF_PRIO, "eth",
+                                      &_dev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_dst, DST_PFX_LEN,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID)
+           == sizeof(_dst));
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &entry);
+    _frame_init();
+
+    _test_datagram();
+    puts("received datagram OK");
+
+    BENCHMARK_RUN("receive burst (" DISPATCH ")", _receive_burst());
+    printf("%u packets lost\n", _lost);
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+from benchmark_output import BENCHMARK_REGEXP
+
+
+def testfunc(child):
+    child.expect_exact("received datagram OK")
+    child.expect(BENCHMARK_REGEXP.format(func=r"receive burst \([\w ]+\)"))
+    child.expect_exact("0 packets lost")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -11,35 +11,21 @@
  * @{
  *
  * @file
- * @brief       Measure messages send per second
+ * @brief       Measure the time it takes to send a message
  *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  *
  * @}
  */
 
-#include <stdint.h>
-#include <stdatomic.h>
 #include <stdio.h>
-#include "macros/units.h"
-#include "thread.h"
-#include "clk.h"
 
+#include "benchmark.h"
 #include "msg.h"
-#include "xtimer.h"
-
-#ifndef TEST_DURATION_US
-#define TEST_DURATION_US    (1000000U)
-#endif
+#include "thread.h"
 
 static char _stack[THREAD_STACKSIZE_MAIN];
 
-static void _timer_callback(void *_flag)
-{
-    atomic_flag *flag = _flag;
-    atomic_flag_clear(flag);
-}
-
 static void *_second_thread(void *arg)
 {
     (void)arg;
@@ -64,27 +50,8 @@ int main(void)
                                        NULL,
                                        "second_thread");
 
-    atomic_flag flag = ATOMIC_FLAG_INIT;
-    uint32_t n = 0;
-
-    xtimer_t timer = {
-        .callback = _timer_callback,
-        .arg = &flag,
-    };
-
-    atomic_flag_test_and_set(&flag);
-    xtimer_set(&timer, TEST_DURATION_US);
-
-    while (atomic_flag_test_and_set(&flag)) {
-        msg_t test;
-        msg_send(&test, other);
-        n++;
-    }
-
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    msg_t test;
+    BENCHMARK_RUN("msg_send()", msg_send(&test, other));
 
     return 0;
 }
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure the runtime of nanoCoAP option parsing and lookups
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "net/nanocoap.h"
+#include "test_utils/expect.h"
+
+static uint8_t _buf[128];
+static size_t _len;
+
+/* a request with the options a typical resource handler looks at */
+static void _build_request(void)
+{
+    coap_pkt_t pkt;
+    coap_block1_t block = { .blknum = 3, .szx = 2 };
+
+    size_t len = coap_build_hdr((coap_hdr_t *)_buf, COAP_TYPE_CON, NULL, 0,
+                                COAP_METHOD_GET, 0x1234);
+    coap_pkt_init(&pkt, _buf, sizeof(_buf), len);
+
+    coap_opt_add_uint(&pkt, COAP_OPT_OBSERVE, 0);
+    coap_opt_add_uri_path(&pkt, "/sensors/temperature/current");
+    coap_opt_add_format(&pkt, COAP_FORMAT_CBOR);
+    coap_opt_add_uri_query(&pkt, "unit", "celsius");
+    coap_opt_add_uri_query(&pkt, "avg", "60");
+    coap_opt_add_uri_query(&pkt, "fmt", "short");
+    coap_opt_add_accept(&pkt, COAP_FORMAT_CBOR);
+    coap_opt_add_block2_control(&pkt, &block);
+    coap_opt_add_uint(&pkt, COAP_OPT_SIZE2, 0);
+    _len = coap_opt_finish(&pkt, COAP_OPT_FINISH_NONE);
+}
+
+static void _parse(void)
+{
+    coap_pkt_t pkt;
+
+    coap_parse(&pkt, _buf, _len);
+}
+
+static void _parse_and_lookup(void)
+{
+    coap_pkt_t pkt;
+    uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
+    const char *value;
+    size_t value_len;
+    coap_block1_t block;
+    uint32_t observe;
+
+    coap_parse(&pkt, _buf, _len);
+    coap_get_uri_path(&pkt, uri);
+    coap_find_uri_query(&pkt, "avg", &value, &value_len);
+    coap_get_content_type(&pkt);
+    coap_get_accept(&pkt);
+    coap_get_block2(&pkt, &block);
+    coap_opt_get_uint(&pkt, COAP_OPT_OBSERVE, &observe);
+}
+
+static void _lookup_absent(void)
+{
+    coap_pkt_t pkt;
+    uint32_t value;
+
+    coap_parse(&pkt, _buf, _len);
+    coap_opt_get_uint(&pkt, COAP_OPT_NO_RESPONSE, &value);
+    coap_opt_get_uint(&pkt, COAP_OPT_SIZE1, &value);
+    coap_opt_get_uint(&pkt, COAP_OPT_BLOCK1, &value);
+}
+
+int main(void)
+{
+    coap_pkt_t pkt;
+
+    _build_request();
+    expect(coap_parse(&pkt, _buf, _len) == 0);
+    expect(pkt.options_len == 7);
+
+    puts("nanoCoAP option parsing and lookup");
+    BENCHMARK_RUN("coap_parse()", _parse());
+    BENCHMARK_RUN("parse + handler lookups", _parse_and_lookup());
+    BENCHMARK_RUN("parse + absent lookups", _lookup_absent());
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+from benchmark_output import BENCHMARK_REGEXP
+
+
+def testfunc(child):
+    child.expect_exact('nanoCoAP option parsing and lookup')
+    child.expect(BENCHMARK_REGEXP.format(func=r"coap_parse\(\)"))
+    child.expect(BENCHMARK_REGEXP.format(func=r"parse \+ handler lookups"))
+    child.expect(BENCHMARK_REGEXP.format(func=r"parse \+ absent lookups"))
+    child.expect_exact('[SUCCESS]')
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
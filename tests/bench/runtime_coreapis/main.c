@@ -27,17 +27,6 @@
 #include "thread.h"
 #include "thread_flags.h"
 
-#ifndef BENCH_RUNS
-#  define BENCH_RUNS          (1000UL * 1000UL)
-#endif
-#ifndef BENCH_CLIST_RUNS
-#  if defined(BOARD_NATIVE64) || defined(BOARD_NATIVE32)
-#    define BENCH_CLIST_RUNS BENCH_RUNS
-#  else
-#    define BENCH_CLIST_RUNS (BENCH_RUNS / 1000UL)
-#  endif
-#endif
-
 #ifndef BENCH_CLIST_SORT_TEST_NODES
 #  define BENCH_CLIST_SORT_TEST_NODES 256
 #endif
@@ -242,19 +231,19 @@ static void _bench_clist_sort(unsigned size)
     char name[48] = {};
     snprintf(name, sizeof(name) - 1, "clist_sort, #%u, rev", size);
     _build_test_clist(size);
-    BENCHMARK_FUNC(name, BENCH_CLIST_RUNS, _clist_sort_test_reversed());
+    BENCHMARK_RUN(name, _clist_sort_test_reversed());
 
     snprintf(name, sizeof(name) - 1, "clist_sort, #%u, prng", size);
     _build_test_clist(size);
-    BENCHMARK_FUNC(name, BENCH_CLIST_RUNS, _clist_sort_test_prng());
+    BENCHMARK_RUN(name, _clist_sort_test_prng());
 
     snprintf(name, sizeof(name) - 1, "clist_sort, #%u, sort", size);
     _build_test_clist(size);
-    BENCHMARK_FUNC(name, BENCH_CLIST_RUNS, _clist_sort_test_fully_sorted());
+    BENCHMARK_RUN(name, _clist_sort_test_fully_sorted());
 
     snprintf(name, sizeof(name) - 1, "clist_sort, #%u, alm.srt", size);
     _build_test_clist(size);
-    BENCHMARK_FUNC(name, BENCH_CLIST_RUNS, _clist_sort_test_almost_sorted());
+    BENCHMARK_RUN(name, _clist_sort_test_almost_sorted());
 }
 
 int main(void)
@@ -263,19 +252,19 @@ int main(void)
 
     t = thread_get_active();
 
-    BENCHMARK_FUNC("nop loop", BENCH_RUNS, __asm__ volatile ("nop"));
+    BENCHMARK_RUN("nop loop", __asm__ volatile ("nop"));
     puts("");
-    BENCHMARK_FUNC("mutex_init()", BENCH_RUNS, mutex_init(&_lock));
-    BENCHMARK_FUNC("mutex lock/unlock", BENCH_RUNS, _mutex_lockunlock());
+    BENCHMARK_RUN("mutex_init()", mutex_init(&_lock));
+    BENCHMARK_RUN("mutex lock/unlock", _mutex_lockunlock());
     puts("");
-    BENCHMARK_FUNC("thread_flags_set()", BENCH_RUNS, thread_flags_set(t, _flag));
-    BENCHMARK_FUNC("thread_flags_clear()", BENCH_RUNS, thread_flags_clear(_flag));
-    BENCHMARK_FUNC("thread flags set/wait any", BENCH_RUNS, _flag_waitany());
-    BENCHMARK_FUNC("thread flags set/wait all", BENCH_RUNS, _flag_waitall());
-    BENCHMARK_FUNC("thread flags set/wait one", BENCH_RUNS, _flag_waitone());
+    BENCHMARK_RUN("thread_flags_set()", thread_flags_set(t, _flag));
+    BENCHMARK_RUN("thread_flags_clear()", thread_flags_clear(_flag));
+    BENCHMARK_RUN("thread flags set/wait any", _flag_waitany());
+    BENCHMARK_RUN("thread flags set/wait all", _flag_waitall());
+    BENCHMARK_RUN("thread flags set/wait one", _flag_waitone());
     puts("");
-    BENCHMARK_FUNC("msg_try_receive()", BENCH_RUNS, msg_try_receive(&_msg));
-    BENCHMARK_FUNC("msg_avail()", BENCH_RUNS, msg_avail());
+    BENCHMARK_RUN("msg_try_receive()", msg_try_receive(&_msg));
+    BENCHMARK_RUN("msg_avail()", msg_avail());
     puts("");
 
     printf("{'BENCH_CLIST_SORT_TEST_NODES': %u}\n",
@@ -8,11 +8,10 @@
 
 import sys
 from testrunner import run
-
+from benchmark_output import BENCHMARK_REGEXP
 
 # The default timeout is not enough for this test on some of the slower boards
 TIMEOUT = 30
-BENCHMARK_REGEXP = r"\s+{func}:\s+\d+us\s+---\s+\d*\.*\d+us per call\s+---\s+\d+ calls per sec"
 
 
 def testfunc(child):
@@ -31,10 +30,10 @@ def testfunc(child):
     clist_nodes = int(child.match.group(1))
     len = 4
     while len <= clist_nodes:
-        child.expect(BENCHMARK_REGEXP.format(func=f"clist_sort, #{len}, rev", timeout=TIMEOUT))
-        child.expect(BENCHMARK_REGEXP.format(func=f"clist_sort, #{len}, prng", timeout=TIMEOUT))
-        child.expect(BENCHMARK_REGEXP.format(func=f"clist_sort, #{len}, sort", timeout=TIMEOUT))
-        child.expect(BENCHMARK_REGEXP.format(func=f"clist_sort, #{len}, alm.srt", timeout=TIMEOUT))
+        child.expect(BENCHMARK_REGEXP.format(func=f"clist_sort, #{len}, rev"), timeout=TIMEOUT)
+        child.expect(BENCHMARK_REGEXP.format(func=f"clist_sort, #{len}, prng"), timeout=TIMEOUT)
+        child.expect(BENCHMARK_REGEXP.format(func=f"clist_sort, #{len}, sort"), timeout=TIMEOUT)
+        child.expect(BENCHMARK_REGEXP.format(func=f"clist_sort, #{len}, alm.srt"), timeout=TIMEOUT)
         len = len << 1
     child.expect_exact('[SUCCESS]')
 
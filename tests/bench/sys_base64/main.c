@@ -22,10 +22,10 @@
 #include <string.h>
 
 #include "base64.h"
+#include "benchmark.h"
 #include "compiler_hints.h"
 #include "fmt.h"
 #include "macros/utils.h"
-#include "xtimer.h"
 
 static char buf[128];
 
@@ -41,7 +41,6 @@ static const char base64[128] =
 "bWVuZG91c2x5LCByZW1hcmthYmx5IGxlbmd0aHkgc2VudGVuY2Uh";
 
 int main(void) {
-    uint32_t start, stop;
     size_t size;
 
     /* We don't want check return value in the benchmark loop, so we just do
@@ -78,26 +77,12 @@ int main(void) {
         print_str("OK\n");
     }
 
-    start = xtimer_now_usec();
-    for (unsigned i = 0; i < 1000; i++) {
-        size = sizeof(buf);
-        base64_encode(input, sizeof(input), buf, &size);
-    }
-    stop = xtimer_now_usec();
-
-    print_str("Encoding 1.000 x 96 bytes (128 bytes in base64): ");
-    print_u32_dec(stop - start);
-    print_str(" µs\n");
-
-    start = xtimer_now_usec();
-    for (unsigned i = 0; i < 1000; i++) {
-        size = sizeof(buf);
-        base64_decode(base64, sizeof(base64), buf, &size);
-    }
-    stop = xtimer_now_usec();
+    BENCHMARK_RUN("base64_encode(), 96 bytes",
+                  (size = sizeof(buf), base64_encode(input, sizeof(input),
+                                                     buf, &size)));
+    BENCHMARK_RUN("base64_decode(), 128 bytes",
+                  (size = sizeof(buf), base64_decode(base64, sizeof(base64),
+                                                     buf, &size)));
 
-    print_str("Decoding 1.000 x 96 bytes (128 bytes in base64): ");
-    print_u32_dec(stop - start);
-    print_str(" µs\n");
     return 0;
 }
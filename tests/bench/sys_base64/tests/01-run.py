@@ -8,13 +8,14 @@
 
 import sys
 from testrunner import run
+from benchmark_output import BENCHMARK_REGEXP
 
 
 def testfunc(child):
     child.expect_exact("Verifying that base64 encoding works for benchmark input: OK\r\n")
     child.expect_exact("Verifying that base64 decoding works for benchmark input: OK\r\n")
-    child.expect(r"Encoding 1\.000 x 96 bytes \(128 bytes in base64\): [0-9]+ µs\r\n")
-    child.expect(r"Decoding 1\.000 x 96 bytes \(128 bytes in base64\): [0-9]+ µs\r\n")
+    child.expect(BENCHMARK_REGEXP.format(func=r"base64_encode\(\), 96 bytes"))
+    child.expect(BENCHMARK_REGEXP.format(func=r"base64_decode\(\), 128 bytes"))
 
 
 if __name__ == "__main__":
@@ -19,27 +19,13 @@
  */
 
 #include <stdio.h>
-#include "macros/units.h"
-#include "clk.h"
-#include "thread.h"
 
+#include "benchmark.h"
+#include "thread.h"
 #include "thread_flags.h"
-#include "xtimer.h"
-
-#ifndef TEST_DURATION
-#define TEST_DURATION       (1000000U)
-#endif
 
-volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
 
-static void _timer_callback(void*arg)
-{
-    (void)arg;
-
-    _flag = 1;
-}
-
 static void *_second_thread(void *arg)
 {
     (void)arg;
@@ -65,21 +51,7 @@ int main(void)
 
     thread_t *tcb = thread_get(other);
 
-    xtimer_t timer;
-    timer.callback = _timer_callback;
-
-    uint32_t n = 0;
-
-    xtimer_set(&timer, TEST_DURATION);
-    while(!_flag) {
-        thread_flags_set(tcb, 0x1);
-        n++;
-    }
-
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    BENCHMARK_RUN("thread_flags_set()", thread_flags_set(tcb, 0x1));
 
     return 0;
 }
@@ -9,10 +9,11 @@
 
 import sys
 from testrunner import run
+from benchmark_output import BENCHMARK_REGEXP
 
 
 def testfunc(child):
-    child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    child.expect(BENCHMARK_REGEXP.format(func=r"thread_yield\(\)"))
 
 
 if __name__ == "__main__":
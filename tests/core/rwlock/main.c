@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the reader-writer lock
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "rwlock.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define WORKERS_NUMOF   (4U)
+
+typedef struct {
+    bool write;         /**< acquire the write lock */
+    bool holding;       /**< the worker holds the lock */
+    mutex_t release;    /**< unlocked by main to make the worker release */
+    char stack[THREAD_STACKSIZE_DEFAULT];
+} worker_t;
+
+static rwlock_t _lock = RWLOCK_INIT;
+static worker_t _workers[WORKERS_NUMOF];
+
+static void *_worker(void *arg)
+{
+    worker_t *w = arg;
+
+    if (w->write) {
+        rwlock_write_lock(&_lock);
+    }
+    else {
+        rwlock_read_lock(&_lock);
+    }
+    w->holding = true;
+
+    mutex_lock(&w->release);
+
+    w->holding = false;
+    if (w->write) {
+        rwlock_write_unlock(&_lock);
+    }
+    else {
+        rwlock_read_unlock(&_lock);
+    }
+
+    return NULL;
+}
+
+/* workers have a higher priority than main, so they run right away and
+ * either hold the lock or wait for it once this returns */
+static worker_t *_start(unsigned idx, bool write, uint8_t prio_boost)
+{
+    worker_t *w = &_workers[idx];
+
+    w->write = write;
+    w->holding = false;
+    mutex_init(&w->release);
+    mutex_lock(&w->release);
+    thread_create(w->stack, sizeof(w->stack),
+                  THREAD_PRIORITY_MAIN - prio_boost, 0, _worker, w, "worker");
+    return w;
+}
+
+static void _release(worker_t *w)
+{
+    mutex_unlock(&w->release);
+}
+
+static void _test_shared_readers(void)
+{
+    rwlock_read_lock(&_lock);
+
+    worker_t *r1 = _start(0, false, 1);
+    worker_t *r2 = _start(1, false, 1);
+    expect(r1->holding && r2->holding);
+
+    worker_t *w = _start(2, true, 1);
+    expect(!w->holding);
+
+    /* readers are preferred, a waiting writer doesn't block them */
+    rwlock_read_lock(&_lock);
+    rwlock_read_unlock(&_lock);
+
+    _release(r1);
+    _release(r2);
+    expect(!r1->holding && !r2->holding);
+    expect(!w->holding);
+
+    rwlock_read_unlock(&_lock);
+    expect(w->holding);
+
+    _release(w);
+    expect(!w->holding);
+    puts("shared readers OK");
+}
+
+static void _test_handover(void)
+{
+    worker_t *w1 = _start(0, true, 1);
+    expect(w1->holding);
+
+    worker_t *r1 = _start(1, false, 1);
+    worker_t *r2 = _start(2, false, 2);
+    worker_t *w2 = _start(3, true, 3);
+    expect(!r1->holding && !r2->holding && !w2->holding);
+
+    /* the waiting writer has the highest priority */
+    _release(w1);
+    expect(!w1->holding);
+    expect(w2->holding);
+    expect(!r1->holding && !r2->holding);
+
+    /* all waiting readers get the lock at once */
+    _release(w2);
+    expect(r1->holding && r2->holding);
+
+    _release(r1);
+    _release(r2);
+    expect(_lock.readers == 0);
+    expect(_lock.writer == KERNEL_PID_UNDEF);
+    puts("handover OK");
+}
+
+static void _test_try_lock(void)
+{
+    expect(rwlock_try_read_lock(&_lock));
+    expect(rwlock_try_read_lock(&_lock));
+    expect(!rwlock_try_write_lock(&_lock));
+    rwlock_read_unlock(&_lock);
+    rwlock_read_unlock(&_lock);
+
+    expect(rwlock_try_write_lock(&_lock));
+    expect(!rwlock_try_read_lock(&_lock));
+    expect(!rwlock_try_write_lock(&_lock));
+    rwlock_write_unlock(&_lock);
+    expect(rwlock_try_read_lock(&_lock));
+    rwlock_read_unlock(&_lock);
+    puts("try lock OK");
+}
+
+int main(void)
+{
+    _test_shared_readers();
+    _test_handover();
+    _test_try_lock();
+    puts("SUCCESS");
+
+    return 0;
+}
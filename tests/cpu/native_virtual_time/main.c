@@ -0,0 +1,152 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Runs a day of NIB lifecycle in native's virtual time
+ *
+ * A prefix and a default router are configured with lifetimes of several
+ * hours, then the application sleeps for 24 h in steps of one hour and
+ * checks that the entries expire right on time.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ethernet.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/ipv6/nib/pl.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "time_units.h"
+#include "ztimer.h"
+
+#define HOURS               (24U)
+#define PFX_VALID_HOURS     (12U)
+#define PFX_PREF_HOURS      (6U)
+#define RTR_HOURS           (4U)
+
+static const ipv6_addr_t _pfx = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    } };
+static const ipv6_addr_t _rtr = { {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    } };
+
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    static const uint8_t addr[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+
+    (void)dev;
+    expect(max_len >= sizeof(addr));
+    memcpy(value, addr, sizeof(addr));
+    return sizeof(addr);
+}
+
+static void _netif_init(void)
+{
+    netdev_test_setup(&_netdev, 0);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "mock_eth", &_netdev.netdev.netdev) == 0);
+}
+
+static bool _has_prefix(bool *preferred)
+{
+    gnrc_ipv6_nib_pl_t ple;
+    void *state = NULL;
+
+    while (gnrc_ipv6_nib_pl_iter(0, &state, &ple)) {
+        if (ipv6_addr_equal(&ple.pfx, &_pfx)) {
+            uint32_t now = ztimer_now(ZTIMER_MSEC);
+            *preferred = (int32_t)(ple.pref_until - now) > 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool _has_default_router(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    void *state = NULL;
+
+    while (gnrc_ipv6_nib_ft_iter(NULL, 0, &state, &fte)) {
+        if ((fte.dst_len == 0) && ipv6_addr_equal(&fte.next_hop, &_rtr)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(void)
+{
+    _netif_init();
+
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+
+    expect(gnrc_ipv6_nib_pl_set(_netif.pid, &_pfx, 64,
+                                PFX_VALID_HOURS * MS_PER_HOUR,
+                                PFX_PREF_HOURS * MS_PER_HOUR) == 0);
+    expect(gnrc_ipv6_nib_ft_add(NULL, 0, &_rtr, _netif.pid,
+                                RTR_HOURS * SEC_PER_HOUR) == 0);
+
+    for (unsigned hour = 1; hour <= HOURS; hour++) {
+        /* entries expiring at the full hour are gone already, the IPv6
+         * thread handles the timeout before the lower priority main thread */
+        ztimer_sleep(ZTIMER_MSEC, MS_PER_HOUR);
+
+        bool preferred = false;
+        bool prefix = _has_prefix(&preferred);
+        bool router = _has_default_router();
+
+        printf("hour %2u: prefix %s, default router %s\n", hour,
+               prefix ? (preferred ? "preferred" : "deprecated") : "expired",
+               router ? "valid" : "expired");
+
+        expect(prefix == (hour < PFX_VALID_HOURS));
+        expect(!prefix || (preferred == (hour < PFX_PREF_HOURS)));
+        expect(router == (hour < RTR_HOURS));
+    }
+
+    uint32_t elapsed = ztimer_now(ZTIMER_MSEC) - start;
+    printf("simulated %" PRIu32 " s\n", (uint32_t)(elapsed / MS_PER_SEC));
+    expect(elapsed / MS_PER_HOUR == HOURS);
+
+    puts("SUCCESS");
+    return 0;
+}
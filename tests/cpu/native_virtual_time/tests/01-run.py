@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+HOURS = 24
+
+
+def testfunc(child):
+    for hour in range(1, HOURS + 1):
+        child.expect(r"hour\s+{}: prefix \w+, default router \w+\r\n".format(hour))
+    child.expect_exact("simulated {} s".format(HOURS * 60 * 60))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    # a day of simulated time must pass within a few seconds
+    sys.exit(run(testfunc, timeout=10))
@@ -101,6 +101,58 @@ static void tear_down_tests(void)
     gnrc_pktbuf_init();
 }
 
+/* fragment data always starts with room for the fragment header */
+static gnrc_pktsnip_t *_reass_frag(const uint8_t *data, size_t size,
+                                   unsigned offset, bool more, uint32_t id)
+{
+    gnrc_pktsnip_t *ipv6_snip = gnrc_ipv6_hdr_build(NULL, &_src, &_dst);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(ipv6_snip, data, size,
+                                          GNRC_NETTYPE_UNDEF);
+    ipv6_hdr_t *ipv6 = ipv6_snip->data;
+    ipv6_ext_frag_t *frag = pkt->data;
+
+    ipv6->nh = PROTNUM_IPV6_EXT_FRAG;
+    ipv6->hl = TEST_HL;
+    ipv6->len = byteorder_htons(pkt->size);
+    frag->nh = PROTNUM_UDP;
+    frag->resv = 0U;
+    ipv6_ext_frag_set_offset(frag, offset);
+    if (more) {
+        ipv6_ext_frag_set_more(frag);
+    }
+    frag->id = byteorder_htonl(id);
+    return gnrc_ipv6_ext_frag_reass(pkt);
+}
+
+/* receives the last fragment of a datagram of (offset + 15) bytes, so the
+ * entry for it holds just that many bytes */
+static gnrc_ipv6_ext_frag_rbuf_t *_reass_last_frag(unsigned offset, uint32_t id)
+{
+    ipv6_hdr_t ipv6 = { .src = _src, .dst = _dst };
+    gnrc_pktsnip_t *pkt;
+
+    /* entries are evicted by the arrival time of their last fragment */
+    xtimer_usleep(10);
+    if ((pkt = _reass_frag(_test_frag3, sizeof(_test_frag3), offset, false,
+                           id)) != NULL) {
+        /* the last fragment alone never completes a datagram */
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    /* entry exists, so this is only a lookup */
+    return gnrc_ipv6_ext_frag_rbuf_get(&ipv6, id);
+}
+
+static void _assert_reassembled(gnrc_pktsnip_t *pkt)
+{
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), pkt->size);
+    TEST_ASSERT(memcmp(_exp_payload, pkt->data, pkt->size) == 0);
+    TEST_ASSERT_NOT_NULL(pkt->next);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_IPV6, pkt->next->type);
+    gnrc_pktbuf_release(pkt);
+}
+
 static void test_ipv6_ext_frag_rbuf_get(void)
 {
     static ipv6_hdr_t ipv6 = { .src = { .u8 = TEST_SRC },
@@ -401,48 +453,43 @@ static void test_ipv6_ext_frag_reass_out_of_order(void)
 
 static void test_ipv6_ext_frag_reass_out_of_order_rbuf_full(void)
 {
-    gnrc_pktsnip_t *ipv6_snip = gnrc_ipv6_hdr_build(NULL, &_src, &_dst);
-    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(ipv6_snip, _test_frag3,
-                                          sizeof(_test_frag3),
-                                          GNRC_NETTYPE_UNDEF);
-    ipv6_hdr_t *ipv6 = ipv6_snip->data;
-    ipv6_ext_frag_t *frag = pkt->data;
-    gnrc_ipv6_ext_frag_rbuf_t *rbuf;
-    gnrc_ipv6_ext_frag_limits_t *ptr;
+    gnrc_ipv6_ext_frag_rbuf_t *rbufs[CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE];
     static const uint32_t foreign_id = TEST_ID + 44U;
 
-    TEST_ASSERT_EQUAL_INT(1, CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE);
-    /* prepare fragment from a from a foreign datagram */
-    ipv6->nh = PROTNUM_IPV6_EXT_FRAG;
-    ipv6->hl = TEST_HL;
-    ipv6->len = byteorder_htons(pkt->size);
-    frag->nh = PROTNUM_UDP;
-    frag->resv = 0U;
-    ipv6_ext_frag_set_offset(frag, TEST_FRAG3_OFFSET);
-    frag->id = byteorder_htonl(foreign_id);
-
-    /* receive a fragment from a foreign datagram first */
-    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
-    TEST_ASSERT_NOT_NULL((rbuf = gnrc_ipv6_ext_frag_rbuf_get(ipv6,
-                                                             foreign_id)));
-    TEST_ASSERT_NOT_NULL(rbuf->pkt);
-    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->pkt->size);
-    TEST_ASSERT_EQUAL_INT(foreign_id, rbuf->id);
-    TEST_ASSERT(rbuf->last);
-    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, ptr->end);
-    TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
-    TEST_ASSERT(memcmp(&_exp_payload[TEST_FRAG3_OFFSET],
-                       (uint8_t *)rbuf->pkt->data + TEST_FRAG3_OFFSET,
-                       rbuf->pkt->size - TEST_FRAG3_OFFSET) == 0);
+    /* receive fragments from foreign datagrams until rbuf is full */
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i++) {
+        gnrc_ipv6_ext_frag_rbuf_t *rbuf;
+        gnrc_ipv6_ext_frag_limits_t *ptr;
+
+        TEST_ASSERT_NOT_NULL((rbuf = _reass_last_frag(TEST_FRAG3_OFFSET,
+                                                      foreign_id + i)));
+        TEST_ASSERT_NOT_NULL(rbuf->pkt);
+        TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->pkt->size);
+        TEST_ASSERT_EQUAL_INT(foreign_id + i, rbuf->id);
+        TEST_ASSERT(rbuf->last);
+        ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
+        TEST_ASSERT_NOT_NULL(ptr);
+        ptr = ptr->next;
+        TEST_ASSERT_NOT_NULL(ptr);
+        TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->start);
+        TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, ptr->end);
+        TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+        TEST_ASSERT(memcmp(&_exp_payload[TEST_FRAG3_OFFSET],
+                           (uint8_t *)rbuf->pkt->data + TEST_FRAG3_OFFSET,
+                           rbuf->pkt->size - TEST_FRAG3_OFFSET) == 0);
+        rbufs[i] = rbuf;
+    }
 
     /* redo test_ipv6_ext_frag_reass_one_frag but now rbuf is full and oldest
      * entry should be cycled out */
     test_ipv6_ext_frag_reass_out_of_order();
+    /* the oldest entry was reused for the completed datagram, all others are
+     * untouched */
+    TEST_ASSERT_NULL(rbufs[0]->ipv6);
+    for (unsigned i = 1; i < CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL(rbufs[i]->ipv6);
+        TEST_ASSERT_EQUAL_INT(foreign_id + i, rbufs[i]->id);
+    }
 }
 
 static void test_ipv6_ext_frag_reass_one_frag(void)
@@ -479,6 +526,170 @@ static void test_ipv6_ext_frag_reass_one_frag(void)
     gnrc_pktbuf_is_empty();
 }
 
+static void test_ipv6_ext_frag_reass_budget(void)
+{
+    gnrc_pktsnip_t *ipv6_snip = gnrc_ipv6_hdr_build(NULL, &_src, &_dst);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(ipv6_snip, _test_frag3,
+                                          sizeof(_test_frag3),
+                                          GNRC_NETTYPE_UNDEF);
+    ipv6_hdr_t *ipv6 = ipv6_snip->data;
+    ipv6_ext_frag_t *frag = pkt->data;
+
+    ipv6->nh = PROTNUM_IPV6_EXT_FRAG;
+    ipv6->hl = TEST_HL;
+    ipv6->len = byteorder_htons(pkt->size);
+    frag->nh = PROTNUM_UDP;
+    frag->resv = 0U;
+    /* last fragment of a datagram larger than the reassembly buffer may hold */
+    ipv6_ext_frag_set_offset(frag, CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_BUDGET & ~7U);
+    frag->id = byteorder_htonl(TEST_ID);
+
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    /* neither the fragment nor space for the datagram are kept */
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_ipv6_ext_frag_reass_interleaved(void)
+{
+    gnrc_ipv6_ext_frag_rbuf_t *rbufs[CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE];
+    gnrc_ipv6_ext_frag_stats_t *stats = gnrc_ipv6_ext_frag_stats();
+    unsigned full = stats->rbuf_full;
+    unsigned evicted = stats->rbuf_evicted;
+
+    /* receive the fragments of all datagrams interleaved */
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL((rbufs[i] = _reass_last_frag(TEST_FRAG3_OFFSET,
+                                                          TEST_ID + i)));
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i++) {
+        TEST_ASSERT_NULL(_reass_frag(_test_frag2, sizeof(_test_frag2),
+                                     TEST_FRAG2_OFFSET, true, TEST_ID + i));
+    }
+    /* each fragment went into the entry of its own datagram */
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL(rbufs[i]->ipv6);
+        TEST_ASSERT_EQUAL_INT(TEST_ID + i, rbufs[i]->id);
+        TEST_ASSERT(memcmp(&_exp_payload[TEST_FRAG2_OFFSET],
+                           (uint8_t *)rbufs[i]->pkt->data + TEST_FRAG2_OFFSET,
+                           rbufs[i]->pkt->size - TEST_FRAG2_OFFSET) == 0);
+    }
+    /* complete datagrams in reverse order */
+    for (unsigned i = CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i > 0; i--) {
+        _assert_reassembled(_reass_frag(_test_frag1, sizeof(_test_frag1),
+                                        TEST_FRAG1_OFFSET, true,
+                                        TEST_ID + i - 1));
+        TEST_ASSERT_NULL(rbufs[i - 1]->ipv6);
+    }
+    TEST_ASSERT_EQUAL_INT(full, stats->rbuf_full);
+    TEST_ASSERT_EQUAL_INT(evicted, stats->rbuf_evicted);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_ipv6_ext_frag_reass_budget_evict_oldest(void)
+{
+    /* two of these datagrams fit into the budget, a third does not */
+    const unsigned offset = ((CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_BUDGET / 2U) - 15U) &
+                            ~7U;
+    gnrc_ipv6_ext_frag_stats_t *stats = gnrc_ipv6_ext_frag_stats();
+    unsigned full = stats->rbuf_full;
+    unsigned evicted = stats->rbuf_evicted;
+    gnrc_ipv6_ext_frag_rbuf_t *first, *second, *third;
+
+    TEST_ASSERT(CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE > 2);
+    TEST_ASSERT_NOT_NULL((first = _reass_last_frag(offset, TEST_ID)));
+    TEST_ASSERT_NOT_NULL(first->pkt);
+    TEST_ASSERT_NOT_NULL((second = _reass_last_frag(offset, TEST_ID + 1)));
+    TEST_ASSERT_NOT_NULL(second->pkt);
+    /* another fragment makes the first datagram the more recent one */
+    xtimer_usleep(10);
+    TEST_ASSERT_NULL(_reass_frag(_test_frag1, sizeof(_test_frag1),
+                                 TEST_FRAG1_OFFSET, true, TEST_ID));
+    TEST_ASSERT_EQUAL_INT(evicted, stats->rbuf_evicted);
+
+    TEST_ASSERT_NOT_NULL((third = _reass_last_frag(offset, TEST_ID + 2)));
+    TEST_ASSERT_NOT_NULL(third->pkt);
+    TEST_ASSERT_EQUAL_INT(offset + 15U, third->pkt->size);
+    /* only the datagram with the oldest fragment made room */
+    TEST_ASSERT_EQUAL_INT(evicted + 1, stats->rbuf_evicted);
+    TEST_ASSERT_EQUAL_INT(full, stats->rbuf_full);
+    TEST_ASSERT_NULL(second->ipv6);
+    TEST_ASSERT_NOT_NULL(first->ipv6);
+    TEST_ASSERT_EQUAL_INT(TEST_ID, first->id);
+    TEST_ASSERT_EQUAL_INT(TEST_ID + 2, third->id);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_ipv6_ext_frag_reass_rbuf_reuse(void)
+{
+    gnrc_ipv6_ext_frag_rbuf_t *rbufs[CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE];
+    gnrc_ipv6_ext_frag_stats_t *stats = gnrc_ipv6_ext_frag_stats();
+    const unsigned done = CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE / 2;
+    unsigned full = stats->rbuf_full;
+    unsigned evicted = stats->rbuf_evicted;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL((rbufs[i] = _reass_last_frag(TEST_FRAG3_OFFSET,
+                                                          TEST_ID + i)));
+    }
+    /* completing a datagram returns its entry to the free list */
+    TEST_ASSERT_NULL(_reass_frag(_test_frag2, sizeof(_test_frag2),
+                                 TEST_FRAG2_OFFSET, true, TEST_ID + done));
+    _assert_reassembled(_reass_frag(_test_frag1, sizeof(_test_frag1),
+                                    TEST_FRAG1_OFFSET, true, TEST_ID + done));
+    TEST_ASSERT_NULL(rbufs[done]->ipv6);
+    /* a new datagram takes that entry instead of pushing out another one */
+    TEST_ASSERT(rbufs[done] ==
+                _reass_last_frag(TEST_FRAG3_OFFSET,
+                                 TEST_ID + CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE));
+    TEST_ASSERT_EQUAL_INT(full, stats->rbuf_full);
+    TEST_ASSERT_EQUAL_INT(evicted, stats->rbuf_evicted);
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i++) {
+        TEST_ASSERT_NOT_NULL(rbufs[i]->ipv6);
+        TEST_ASSERT_EQUAL_INT(TEST_ID + ((i == done)
+                                         ? CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE
+                                         : i),
+                              rbufs[i]->id);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_ipv6_ext_frag_reass_pktbuf_full(void)
+{
+    gnrc_ipv6_ext_frag_stats_t *stats = gnrc_ipv6_ext_frag_stats();
+    unsigned evicted = stats->rbuf_evicted;
+    gnrc_ipv6_ext_frag_rbuf_t *oldest, *rbuf;
+    gnrc_pktsnip_t *reserve, *filler = NULL;
+
+    /* both datagrams fit into the budget, so only the packet buffer is short */
+    TEST_ASSERT((512U + 15U) + (480U + 15U) <=
+                CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_BUDGET);
+    TEST_ASSERT_NOT_NULL((oldest = _reass_last_frag(512U, TEST_ID)));
+    TEST_ASSERT_NOT_NULL(oldest->pkt);
+    /* leave just enough space to receive a small fragment */
+    TEST_ASSERT_NOT_NULL((reserve = gnrc_pktbuf_add(NULL, NULL, 256U,
+                                                    GNRC_NETTYPE_UNDEF)));
+    for (size_t size = CONFIG_GNRC_PKTBUF_SIZE; size > 0; size /= 2) {
+        gnrc_pktsnip_t *tmp;
+
+        while ((tmp = gnrc_pktbuf_add(filler, NULL, size,
+                                      GNRC_NETTYPE_UNDEF)) != NULL) {
+            filler = tmp;
+        }
+    }
+    gnrc_pktbuf_release(reserve);
+
+    /* the new datagram only fits after the older one is evicted */
+    TEST_ASSERT_NOT_NULL((rbuf = _reass_last_frag(480U, TEST_ID + 1)));
+    TEST_ASSERT_NOT_NULL(rbuf->pkt);
+    TEST_ASSERT_EQUAL_INT(480U + 15U, rbuf->pkt->size);
+    TEST_ASSERT_EQUAL_INT(TEST_ID + 1, rbuf->id);
+    TEST_ASSERT_EQUAL_INT(evicted + 1, stats->rbuf_evicted);
+    TEST_ASSERT_NULL(oldest->ipv6);
+    gnrc_pktbuf_release(filler);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
 static void run_unittests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -490,6 +701,11 @@ static void run_unittests(void)
         new_TestFixture(test_ipv6_ext_frag_reass_out_of_order),
         new_TestFixture(test_ipv6_ext_frag_reass_out_of_order_rbuf_full),
         new_TestFixture(test_ipv6_ext_frag_reass_one_frag),
+        new_TestFixture(test_ipv6_ext_frag_reass_budget),
+        new_TestFixture(test_ipv6_ext_frag_reass_interleaved),
+        new_TestFixture(test_ipv6_ext_frag_reass_budget_evict_oldest),
+        new_TestFixture(test_ipv6_ext_frag_reass_rbuf_reuse),
+        new_TestFixture(test_ipv6_ext_frag_reass_pktbuf_full),
     };
 
     EMB_UNIT_TESTCALLER(ipv6_ext_frag_tests, NULL, tear_down_tests, fixtures);
@@ -0,0 +1,270 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests upper layer checksum offloading to the network device
+ *
+ * An Ethernet interface emulated with netdev_test reports that it calculates
+ * and verifies the upper layer checksums (@ref NETOPT_CSUM_OFFLOAD). Checks
+ * that the stack leaves the checksum of outgoing packets to the device, but
+ * still calculates it for packets looped back to the node itself, and that it
+ * accepts incoming packets the device marked as verified without checking
+ * their checksum.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/udp.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev/eth.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define PORT            (61616U)
+#define WAIT_MS         (20U)
+#define PAYLOAD         "offload"
+
+#define MAC             { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 }
+#define NBR_MAC         { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 }
+#define ADDR            { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 }
+#define NBR_ADDR        { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02 }
+
+typedef struct __attribute__((packed)) {
+    ethernet_hdr_t eth;
+    ipv6_hdr_t ipv6;
+    udp_hdr_t udp;
+    char payload[sizeof(PAYLOAD)];
+} udp_frame_t;
+
+static const uint8_t _mac[] = MAC;
+static const uint8_t _nbr_mac[] = NBR_MAC;
+static const ipv6_addr_t _addr = { .u8 = ADDR };
+static const ipv6_addr_t _nbr_addr = { .u8 = NBR_ADDR };
+
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _queue[8];
+static udp_frame_t _frame;
+static bool _frame_csum_valid;
+static uint8_t _sent[ETHERNET_FRAME_LEN];
+static size_t _sent_len;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_mac));
+    memcpy(value, _mac, sizeof(_mac));
+    return sizeof(_mac);
+}
+
+static int _get_csum_offload(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(netopt_csum_offload_t));
+    *((netopt_csum_offload_t *)value) = NETOPT_CSUM_OFFLOAD_RX |
+                                        NETOPT_CSUM_OFFLOAD_TX;
+    return sizeof(netopt_csum_offload_t);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    if (buf == NULL) {
+        return sizeof(_frame);
+    }
+    expect(len >= (int)sizeof(_frame));
+    memcpy(buf, &_frame, sizeof(_frame));
+    if (_frame_csum_valid) {
+        ((netdev_eth_rx_info_t *)info)->flags |=
+            NETDEV_ETH_RX_INFO_FLAG_CSUM_VALID;
+    }
+    return sizeof(_frame);
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+/* keeps the last UDP packet, neighbor discovery is ignored */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    const ipv6_hdr_t *ipv6 = iolist->iol_next->iol_base;
+    size_t len = iolist_size(iolist);
+
+    (void)dev;
+    if (ipv6->nh == PROTNUM_UDP) {
+        expect(len <= sizeof(_sent));
+        _sent_len = iolist_to_buffer(iolist, _sent, sizeof(_sent));
+    }
+    return len;
+}
+
+static void _netif_init(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_get_cb(&_dev, NETOPT_CSUM_OFFLOAD, _get_csum_offload);
+    netdev_test_set_send_cb(&_dev, _send);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    expect(gnrc_netif_ethernet_create(&_netif, _stack, sizeof(_stack),
+                                      GNRC_NETIF_PRIO, "offload",
+                                      &_dev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_addr, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID)
+           == sizeof(_addr));
+    expect(gnrc_ipv6_nib_nc_set(&_nbr_addr, _netif.pid, _nbr_mac,
+                                sizeof(_nbr_mac)) == 0);
+}
+
+static void _send_udp(const ipv6_addr_t *dst)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, PAYLOAD, sizeof(PAYLOAD),
+                                          GNRC_NETTYPE_UNDEF);
+
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, PORT, PORT);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, NULL, dst);
+    expect(pkt != NULL);
+    _sent_len = 0;
+    expect(gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP,
+                                     GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
+    ztimer_sleep(ZTIMER_MSEC, WAIT_MS);
+}
+
+/* receives the UDP packet dispatched to the main thread, if any */
+static bool _received(void)
+{
+    msg_t msg;
+    bool res = false;
+
+    while (msg_try_receive(&msg) > 0) {
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            gnrc_pktsnip_t *pkt = msg.content.ptr;
+
+            res = res || ((pkt->size == sizeof(PAYLOAD)) &&
+                          (memcmp(pkt->data, PAYLOAD, sizeof(PAYLOAD)) == 0));
+            gnrc_pktbuf_release(pkt);
+        }
+    }
+    return res;
+}
+
+static void _recv_udp(bool csum_valid, bool csum_correct)
+{
+    netdev_t *dev = &_dev.netdev.netdev;
+    uint16_t len = sizeof(_frame.udp) + sizeof(_frame.payload);
+    uint16_t csum;
+
+    memset(&_frame, 0, sizeof(_frame));
+    memcpy(_frame.eth.dst, _mac, sizeof(_frame.eth.dst));
+    memcpy(_frame.eth.src, _nbr_mac, sizeof(_frame.eth.src));
+    _frame.eth.type = byteorder_htons(ETHERTYPE_IPV6);
+    ipv6_hdr_set_version(&_frame.ipv6);
+    _frame.ipv6.len = byteorder_htons(len);
+    _frame.ipv6.nh = PROTNUM_UDP;
+    _frame.ipv6.hl = 64;
+    _frame.ipv6.src = _nbr_addr;
+    _frame.ipv6.dst = _addr;
+    _frame.udp.src_port = byteorder_htons(PORT);
+    _frame.udp.dst_port = byteorder_htons(PORT);
+    _frame.udp.length = byteorder_htons(len);
+    memcpy(_frame.payload, PAYLOAD, sizeof(PAYLOAD));
+    csum = ipv6_hdr_inet_csum(0, &_frame.ipv6, PROTNUM_UDP, len);
+    csum = ~inet_csum(csum, (uint8_t *)&_frame.udp, len);
+    _frame.udp.checksum = byteorder_htons(csum_correct ? csum : csum ^ 0x5a5a);
+    _frame_csum_valid = csum_valid;
+
+    dev->event_callback(dev, NETDEV_EVENT_ISR);
+    ztimer_sleep(ZTIMER_MSEC, WAIT_MS);
+}
+
+static void _test_tx(void)
+{
+    const udp_frame_t *frame = (const udp_frame_t *)_sent;
+
+    expect(_netif.flags & GNRC_NETIF_FLAGS_CSUM_OFFLOAD);
+    /* the checksum is left to the device */
+    _send_udp(&_nbr_addr);
+    expect(_sent_len == sizeof(udp_frame_t));
+    expect(memcmp(frame->payload, PAYLOAD, sizeof(PAYLOAD)) == 0);
+    expect(byteorder_ntohs(frame->udp.checksum) == 0);
+    puts("TX offload OK");
+
+    /* looped back packets never reach the device */
+    _send_udp(&_addr);
+    expect(_sent_len == 0);
+    expect(_received());
+    puts("loopback OK");
+}
+
+static void _test_rx(void)
+{
+    _recv_udp(false, true);
+    expect(_received());
+    _recv_udp(false, false);
+    expect(!_received());
+    /* the device verified the checksum, so the stack does not look at it */
+    _recv_udp(true, false);
+    expect(_received());
+    puts("RX offload OK");
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(PORT,
+                                                           thread_getpid());
+
+    msg_init_queue(_queue, ARRAY_SIZE(_queue));
+    _netif_init();
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &entry);
+
+    _test_tx();
+    _test_rx();
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,251 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests flow queueing of the network interface send queue
+ *
+ * Checks that the flows of an interface take turns by deficit round robin,
+ * that pushed back packets are still sent first, that CoDel drops packets of a
+ * flow whose queueing delay stays above the target, that a full queue
+ * makes room by dropping from the longest flow, and that the entry taken over
+ * that way is never handed to another interface in the meantime.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/pktq.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "pktbuf_internal.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define PORT_BULK       (61616U)
+#define PORT_SPARSE     (61617U)
+#define PORT_OTHER      (61618U)
+#define BULK_SIZE       (600U)
+#define SPARSE_SIZE     (8U)
+
+#define DST_L2ADDR      { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 }
+#define SRC             { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 }
+#define DST             { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02 }
+
+static const uint8_t _dst_l2addr[] = DST_L2ADDR;
+static const ipv6_addr_t _src = { .u8 = SRC };
+static const ipv6_addr_t _dst = { .u8 = DST };
+
+static gnrc_netif_t _netif;
+static gnrc_netif_t _other_netif;
+static char _stealer_stack[THREAD_STACKSIZE_DEFAULT];
+static gnrc_pktsnip_t *_stealer_pkt;
+
+/* builds a UDP packet to the interface whose payload is filled with @p id */
+static gnrc_pktsnip_t *_pkt(uint16_t port, uint8_t id, size_t size)
+{
+    udp_hdr_t udp = {
+        .src_port = byteorder_htons(port),
+        .dst_port = byteorder_htons(port),
+    };
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+    expect(pkt != NULL);
+    memset(pkt->data, id, size);
+    pkt = gnrc_pktbuf_add(pkt, &udp, sizeof(udp), GNRC_NETTYPE_UDP);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, &_src, &_dst);
+    expect(pkt != NULL);
+    ((ipv6_hdr_t *)pkt->data)->nh = PROTNUM_UDP;
+    hdr = gnrc_netif_hdr_build(NULL, 0, _dst_l2addr, sizeof(_dst_l2addr));
+    expect(hdr != NULL);
+    return gnrc_pkt_prepend(pkt, hdr);
+}
+
+static void _put(uint16_t port, uint8_t id, size_t size)
+{
+    expect(gnrc_netif_pktq_put(&_netif, _pkt(port, id, size)) == 0);
+}
+
+static uint8_t _get(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_netif_pktq_get(&_netif);
+    uint8_t id;
+
+    expect(pkt != NULL);
+    id = *((uint8_t *)gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UNDEF)->data);
+    gnrc_pktbuf_release(pkt);
+    return id;
+}
+
+/* the flow currently holding @p numof packets */
+static gnrc_netif_pktq_flow_t *_flow(unsigned numof)
+{
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_FQ_FLOWS; i++) {
+        if (_netif.send_queue.flows[i].numof == numof) {
+            return &_netif.send_queue.flows[i];
+        }
+    }
+    return NULL;
+}
+
+static void _test_round_robin(void)
+{
+    for (uint8_t id = 1; id <= 4; id++) {
+        _put(PORT_BULK, id, BULK_SIZE);
+    }
+    _put(PORT_SPARSE, 5, SPARSE_SIZE);
+    /* the ports must end up in different flows */
+    expect(_flow(4) != NULL);
+    expect(_flow(1) != NULL);
+
+    /* the bulk flow exceeds its quantum with the first packet, so the sparse
+     * flow does not have to wait for the others */
+    expect(_get() == 1);
+    expect(_get() == 5);
+    expect(_get() == 2);
+    expect(_get() == 3);
+    expect(_get() == 4);
+    expect(gnrc_netif_pktq_empty(&_netif));
+    expect(gnrc_netif_pktq_get(&_netif) == NULL);
+    expect(gnrc_netif_pktq_usage() == 0);
+    puts("round robin OK");
+}
+
+static void _test_push_back(void)
+{
+    _put(PORT_SPARSE, 1, SPARSE_SIZE);
+    expect(gnrc_netif_pktq_push_back(&_netif,
+                                     _pkt(PORT_BULK, 2, SPARSE_SIZE)) == 0);
+    expect(_get() == 2);
+    expect(_get() == 1);
+    expect(gnrc_netif_pktq_empty(&_netif));
+    puts("push back OK");
+}
+
+static void _test_codel(void)
+{
+    gnrc_netif_pktq_flow_t *flow;
+
+    for (uint8_t id = 1; id <= 5; id++) {
+        _put(PORT_SPARSE, id, SPARSE_SIZE);
+    }
+    expect((flow = _flow(5)) != NULL);
+    memset(&flow->stats, 0, sizeof(flow->stats));
+
+    /* above the target, but not for an interval yet */
+    ztimer_sleep(ZTIMER_USEC, 2 * CONFIG_GNRC_NETIF_PKTQ_FQ_TARGET_US);
+    expect(_get() == 1);
+    expect(flow->stats.drop_count == 0);
+    /* the queue did not drain for an interval, so a packet is dropped */
+    ztimer_sleep(ZTIMER_USEC, 2 * CONFIG_GNRC_NETIF_PKTQ_FQ_INTERVAL_US);
+    expect(_get() == 3);
+    expect(flow->dropping);
+    expect(flow->stats.drop_count == 1);
+    expect(flow->stats.tx_count == 2);
+    expect(flow->stats.delay_max >= 2 * CONFIG_GNRC_NETIF_PKTQ_FQ_INTERVAL_US);
+    expect(flow->stats.delay_avg > 0);
+    expect(flow->stats.delay_avg < flow->stats.delay_max);
+
+    while (!gnrc_netif_pktq_empty(&_netif)) {
+        _get();
+    }
+    expect(gnrc_netif_pktq_usage() == 0);
+    puts("CoDel OK");
+}
+
+static void _test_overflow(void)
+{
+    gnrc_netif_pktq_flow_t *flow;
+    uint8_t last = 1;
+
+    for (uint8_t id = 1; id < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; id++) {
+        _put(PORT_BULK, id, SPARSE_SIZE);
+    }
+    _put(PORT_OTHER, 0x80, SPARSE_SIZE);
+    expect(gnrc_netif_pktq_usage() == CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE);
+    expect((flow = _flow(CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE - 1)) != NULL);
+    memset(&flow->stats, 0, sizeof(flow->stats));
+
+    /* the oldest packet of the longest flow makes room */
+    _put(PORT_OTHER, 0x81, SPARSE_SIZE);
+    expect(gnrc_netif_pktq_usage() == CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE);
+    expect(flow->stats.drop_count == 1);
+
+    for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
+        uint8_t id = _get();
+
+        expect(id != 1);
+        if (id < 0x80) {
+            expect(id == ++last);
+        }
+    }
+    expect(last == CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE - 1);
+    expect(gnrc_netif_pktq_empty(&_netif));
+    expect(gnrc_netif_pktq_usage() == 0);
+    puts("overflow OK");
+}
+
+static void *_stealer(void *arg)
+{
+    (void)arg;
+    expect(gnrc_netif_pktq_put(&_netif, _stealer_pkt) == 0);
+    return NULL;
+}
+
+static void _test_shared_pool(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    for (uint8_t id = 1; id <= CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; id++) {
+        _put(PORT_BULK, id, SPARSE_SIZE);
+    }
+    _stealer_pkt = _pkt(PORT_BULK, 0x80, SPARSE_SIZE);
+    pkt = _pkt(PORT_OTHER, 0x81, SPARSE_SIZE);
+
+    /* the stealing thread blocks while releasing the packet it dropped */
+    mutex_lock(&gnrc_pktbuf_mutex);
+    expect(thread_create(_stealer_stack, sizeof(_stealer_stack),
+                         THREAD_PRIORITY_MAIN - 1, 0, _stealer, NULL,
+                         "stealer") > KERNEL_PID_UNDEF);
+    /* the pool is still full for the other interface */
+    expect(gnrc_netif_pktq_put(&_other_netif, pkt) == -1);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    gnrc_pktbuf_release(pkt);
+
+    expect(gnrc_netif_pktq_empty(&_other_netif));
+    expect(gnrc_netif_pktq_usage() == CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE);
+    for (uint8_t id = 2; id <= CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; id++) {
+        expect(_get() == id);
+    }
+    expect(_get() == 0x80);
+    expect(gnrc_netif_pktq_empty(&_netif));
+    expect(gnrc_netif_pktq_usage() == 0);
+    puts("shared pool OK");
+}
+
+int main(void)
+{
+    _test_round_robin();
+    _test_push_back();
+    _test_codel();
+    _test_overflow();
+    _test_shared_pool();
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("round robin OK")
+    child.expect_exact("push back OK")
+    child.expect_exact("CoDel OK")
+    child.expect_exact("overflow OK")
+    child.expect_exact("shared pool OK")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,398 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compares MRHOF with OF0 in a simulated lossy topology
+ *
+ * The node under test hears DIOs from two neighbors on an Ethernet interface
+ * emulated with netdev_test:
+ *
+ *                15%
+ *     node ---------------- root (rank 256)
+ *       \                    /
+ *    95% \                  / 95%
+ *         \---- relay -----/
+ *            (rank 512)
+ *
+ * Each link delivers a frame with the given probability, with up to
+ * @ref TRIES_MAX attempts per hop. The transmissions to the neighbors are
+ * reported to the neighbor statistics like a radio with retransmissions would.
+ * For each objective function, the node joins the DODAG and sends
+ * @ref PKTS_NUMOF UDP packets to the root via its preferred parent.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/mrhof.h"
+#include "net/gnrc/udp.h"
+#include "net/icmpv6.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/l2util.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "random.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define TRIES_MAX       (4U)
+#define PROBES_NUMOF    (32U)
+#define PKTS_NUMOF      (200U)
+#define PORT            (61616U)
+#define INSTANCE_ID     (0U)
+#define ROOT_RANK       (256U)
+#define RELAY_RANK      (512U)
+#define WAIT_MS         (20U)
+
+#define MAC             { 0x02, 0x00, 0x00, 0x00, 0x00, 0x10 }
+#define ROOT_MAC        { 0x02, 0x00, 0x00, 0x00, 0x01, 0x01 }
+#define RELAY_MAC       { 0x02, 0x00, 0x00, 0x00, 0x02, 0x01 }
+#define ADDR            { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02 }
+#define DODAG_ID        { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 }
+
+typedef struct {
+    const char *name;
+    uint8_t mac[ETHERNET_ADDR_LEN];
+    ipv6_addr_t link_local;
+    uint16_t rank;
+    unsigned pdr;           /**< percentage of frames from the node arriving */
+    unsigned upstream_pdr;  /**< same for the frames to the root, 0 for the root */
+} nbr_t;
+
+typedef struct {
+    ethernet_hdr_t eth;
+    ipv6_hdr_t ipv6;
+    icmpv6_hdr_t icmpv6;
+    gnrc_rpl_dio_t dio;
+    gnrc_rpl_opt_dodag_conf_t conf;
+} dio_frame_t;
+
+typedef struct {
+    unsigned delivered;
+    unsigned transmissions;
+} result_t;
+
+static const uint8_t _mac[] = MAC;
+static const ipv6_addr_t _dodag_id = { .u8 = DODAG_ID };
+
+static nbr_t _root = {
+    .name = "root", .mac = ROOT_MAC, .rank = ROOT_RANK, .pdr = 15,
+};
+static nbr_t _relay = {
+    .name = "relay", .mac = RELAY_MAC, .rank = RELAY_RANK, .pdr = 95,
+    .upstream_pdr = 95,
+};
+
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static dio_frame_t _frame;
+static int8_t _retries;
+static netdev_event_t _tx_event;
+static bool _tx_pending;
+static result_t _result;
+static unsigned _sent;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_mac));
+    memcpy(value, _mac, sizeof(_mac));
+    return sizeof(_mac);
+}
+
+static int _get_tx_retries_needed(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(int8_t));
+    *((int8_t *)value) = _retries;
+    return sizeof(int8_t);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(_frame);
+    }
+    expect(len >= (int)sizeof(_frame));
+    memcpy(buf, &_frame, sizeof(_frame));
+    return sizeof(_frame);
+}
+
+static void _isr(netdev_t *dev)
+{
+    if (_tx_pending) {
+        _tx_pending = false;
+        dev->event_callback(dev, _tx_event);
+    }
+    else {
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+/* reports the outcome of a transmission from the thread of the interface */
+static void _tx_done(netdev_t *dev, netdev_event_t event, unsigned tries)
+{
+    expect(!_tx_pending);
+    _retries = tries - 1;
+    _tx_event = event;
+    _tx_pending = true;
+    dev->event_callback(dev, NETDEV_EVENT_ISR);
+}
+
+/* returns the number of attempts until a frame got through, 0 if it did not */
+static unsigned _hop(unsigned pdr)
+{
+    for (unsigned tries = 1; tries <= TRIES_MAX; tries++) {
+        if (random_uint32_range(0, 100) < pdr) {
+            return tries;
+        }
+    }
+    return 0;
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    const ethernet_hdr_t *eth = iolist->iol_base;
+    const ipv6_hdr_t *ipv6 = iolist->iol_next->iol_base;
+    size_t len = iolist_size(iolist);
+    nbr_t *nbr = NULL;
+    unsigned tries;
+
+    if (memcmp(eth->dst, _root.mac, sizeof(_root.mac)) == 0) {
+        nbr = &_root;
+    }
+    else if (memcmp(eth->dst, _relay.mac, sizeof(_relay.mac)) == 0) {
+        nbr = &_relay;
+    }
+    if (nbr == NULL) {
+        /* multicast, e.g. DIOs of the node itself */
+        _tx_done(dev, NETDEV_EVENT_TX_COMPLETE, 1);
+        return len;
+    }
+
+    tries = _hop(nbr->pdr);
+    if (tries > 0) {
+        _tx_done(dev, NETDEV_EVENT_TX_COMPLETE, tries);
+    }
+    else {
+        _tx_done(dev, NETDEV_EVENT_TX_NOACK, TRIES_MAX);
+    }
+    if ((ipv6->nh != PROTNUM_UDP) || !ipv6_addr_equal(&ipv6->dst, &_dodag_id)) {
+        return len;
+    }
+
+    _result.transmissions += (tries > 0) ? tries : TRIES_MAX;
+    /* the relay forwards the packet to the root */
+    if ((tries > 0) && (nbr->upstream_pdr > 0)) {
+        tries = _hop(nbr->upstream_pdr);
+        _result.transmissions += (tries > 0) ? tries : TRIES_MAX;
+    }
+    if (tries > 0) {
+        _result.delivered++;
+    }
+    _sent++;
+    return len;
+}
+
+static void _nbr_init(nbr_t *nbr)
+{
+    eui64_t iid;
+
+    expect(l2util_ipv6_iid_from_addr(NETDEV_TYPE_ETHERNET, nbr->mac,
+                                     sizeof(nbr->mac), &iid) == sizeof(iid));
+    ipv6_addr_set_link_local_prefix(&nbr->link_local);
+    ipv6_addr_set_iid(&nbr->link_local, byteorder_ntohll(iid.uint64));
+    expect(gnrc_ipv6_nib_nc_set(&nbr->link_local, _netif.pid, nbr->mac,
+                                sizeof(nbr->mac)) == 0);
+}
+
+static void _netif_init(void)
+{
+    static const ipv6_addr_t addr = { .u8 = ADDR };
+
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_get_cb(&_dev, NETOPT_TX_RETRIES_NEEDED,
+                           _get_tx_retries_needed);
+    netdev_test_set_send_cb(&_dev, _send);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    expect(gnrc_netif_ethernet_create(&_netif, _stack, sizeof(_stack),
+                                      GNRC_NETIF_PRIO, "lossy",
+                                      &_dev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &addr, 128,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID)
+           == sizeof(addr));
+}
+
+static void _recv_dio(const nbr_t *nbr, uint16_t ocp)
+{
+    netdev_t *dev = &_dev.netdev.netdev;
+    ethernet_hdr_t *eth = &_frame.eth;
+    ipv6_hdr_t *ipv6 = &_frame.ipv6;
+    gnrc_rpl_dio_t *dio = &_frame.dio;
+    gnrc_rpl_opt_dodag_conf_t *conf = &_frame.conf;
+    uint16_t len = sizeof(_frame) - sizeof(_frame.eth) - sizeof(_frame.ipv6);
+    uint16_t csum;
+
+    memset(&_frame, 0, sizeof(_frame));
+    l2util_ipv6_group_to_l2_group(NETDEV_TYPE_ETHERNET,
+                                  &ipv6_addr_all_rpl_nodes, eth->dst);
+    memcpy(eth->src, nbr->mac, sizeof(eth->src));
+    eth->type = byteorder_htons(ETHERTYPE_IPV6);
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(len);
+    ipv6->nh = PROTNUM_ICMPV6;
+    ipv6->hl = 255;
+    ipv6->src = nbr->link_local;
+    ipv6->dst = ipv6_addr_all_rpl_nodes;
+    _frame.icmpv6.type = ICMPV6_RPL_CTRL;
+    _frame.icmpv6.code = GNRC_RPL_ICMPV6_CODE_DIO;
+    dio->instance_id = INSTANCE_ID;
+    dio->version_number = GNRC_RPL_COUNTER_INIT;
+    dio->rank = byteorder_htons(nbr->rank);
+    dio->g_mop_prf = (1 << GNRC_RPL_GROUNDED_SHIFT) |
+                     (GNRC_RPL_DEFAULT_MOP << GNRC_RPL_MOP_SHIFT);
+    dio->dodag_id = _dodag_id;
+    conf->type = GNRC_RPL_OPT_DODAG_CONF;
+    conf->length = GNRC_RPL_OPT_DODAG_CONF_LEN;
+    conf->dio_int_doubl = CONFIG_GNRC_RPL_DEFAULT_DIO_INTERVAL_DOUBLINGS;
+    conf->dio_int_min = CONFIG_GNRC_RPL_DEFAULT_DIO_INTERVAL_MIN;
+    conf->dio_redun = CONFIG_GNRC_RPL_DEFAULT_DIO_REDUNDANCY_CONSTANT;
+    conf->max_rank_inc = byteorder_htons(CONFIG_GNRC_RPL_DEFAULT_MAX_RANK_INCREASE);
+    conf->min_hop_rank_inc = byteorder_htons(CONFIG_GNRC_RPL_DEFAULT_MIN_HOP_RANK_INCREASE);
+    conf->ocp = byteorder_htons(ocp);
+    conf->default_lifetime = CONFIG_GNRC_RPL_DEFAULT_LIFETIME;
+    conf->lifetime_unit = byteorder_htons(CONFIG_GNRC_RPL_LIFETIME_UNIT);
+    csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_ICMPV6, len);
+    csum = inet_csum(csum, (uint8_t *)&_frame.icmpv6, len);
+    _frame.icmpv6.csum = byteorder_htons(~csum);
+
+    dev->event_callback(dev, NETDEV_EVENT_ISR);
+    ztimer_sleep(ZTIMER_MSEC, WAIT_MS);
+}
+
+static void _send_udp(const ipv6_addr_t *dst)
+{
+    static const char payload[] = "lossy";
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, payload, sizeof(payload),
+                                          GNRC_NETTYPE_UNDEF);
+
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, PORT, PORT);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, NULL, dst);
+    expect(pkt != NULL);
+    if (ipv6_addr_is_link_local(dst)) {
+        gnrc_pktsnip_t *netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+
+        expect(netif != NULL);
+        gnrc_netif_hdr_set_netif(netif->data, &_netif);
+        pkt = gnrc_pkt_prepend(pkt, netif);
+    }
+    expect(gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP,
+                                     GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
+}
+
+/* lets the neighbor statistics learn both links */
+static void _probe(void)
+{
+    for (unsigned i = 0; i < PROBES_NUMOF; i++) {
+        _send_udp(&_root.link_local);
+        _send_udp(&_relay.link_local);
+    }
+    ztimer_sleep(ZTIMER_MSEC, WAIT_MS);
+}
+
+static void _run(const char *name, uint16_t ocp, const nbr_t *expected)
+{
+    gnrc_rpl_instance_t *inst;
+    const nbr_t *parent;
+
+    _recv_dio(&_root, ocp);
+    _recv_dio(&_relay, ocp);
+    inst = gnrc_rpl_instance_get(INSTANCE_ID);
+    expect(inst != NULL);
+    expect(inst->of->ocp == ocp);
+    expect(inst->dodag.parents != NULL);
+    parent = ipv6_addr_equal(&inst->dodag.parents->addr, &_root.link_local)
+           ? &_root : &_relay;
+
+    memset(&_result, 0, sizeof(_result));
+    _sent = 0;
+    for (unsigned i = 0; i < PKTS_NUMOF; i++) {
+        _send_udp(&_dodag_id);
+    }
+    ztimer_sleep(ZTIMER_MSEC, WAIT_MS);
+    expect(_sent == PKTS_NUMOF);
+
+    printf("%s: parent %s, rank %u, %u%% delivered, "
+           "%u.%02u transmissions per packet\n",
+           name, parent->name, inst->dodag.my_rank,
+           (100 * _result.delivered) / PKTS_NUMOF,
+           _result.transmissions / PKTS_NUMOF,
+           ((100 * _result.transmissions) / PKTS_NUMOF) % 100);
+    expect(parent == expected);
+
+    gnrc_rpl_instance_remove(inst);
+}
+
+int main(void)
+{
+    result_t of0;
+
+    _netif_init();
+    _nbr_init(&_root);
+    _nbr_init(&_relay);
+    expect(gnrc_rpl_init(_netif.pid) > KERNEL_PID_UNDEF);
+    _probe();
+
+    _run("OF0", 0, &_root);
+    of0 = _result;
+    _run("MRHOF", GNRC_RPL_OCP_MRHOF, &_relay);
+    expect(_result.delivered > of0.delivered);
+    expect(_result.transmissions * of0.delivered <
+           of0.transmissions * _result.delivered);
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+
+from testrunner import run
+
+
+RESULT = (r"{name}: parent {parent}, rank \d+, \d+% delivered, "
+          r"\d+\.\d+ transmissions per packet")
+
+
+def testfunc(child):
+    child.expect(RESULT.format(name="OF0", parent="root"))
+    child.expect(RESULT.format(name="MRHOF", parent="relay"))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
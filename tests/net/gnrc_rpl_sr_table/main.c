@@ -0,0 +1,399 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the source route table of a non-storing mode RPL root
+ *
+ * The node under test is the root of a non-storing mode DODAG on an Ethernet
+ * interface emulated with netdev_test. First, it receives DAOs for the
+ * topology
+ *
+ *     root <--- A <--- B <--- C
+ *
+ * and the source routing headers of the UDP packets it sends to C are checked
+ * hop by hop. Then, the table is filled through its API with a tree of
+ * @ref CONFIG_GNRC_RPL_SR_TABLE_SIZE nodes to check and time all routes.
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/rpl.h"
+#include "net/gnrc/rpl/sr_table.h"
+#include "net/gnrc/rpl/srh.h"
+#include "net/gnrc/udp.h"
+#include "net/icmpv6.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/ext/rh.h"
+#include "net/ipv6/hdr.h"
+#include "net/l2util.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define PORT            (61616U)
+#define INSTANCE_ID     (0U)
+#define WAIT_MS         (20U)
+#define LIFETIME        (60U)
+#define ROUNDS          (16U)
+#define ARITY           (3U)
+
+#define MAC             { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 }
+#define DODAG_ID        { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+                          0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 }
+
+typedef struct {
+    uint8_t mac[ETHERNET_ADDR_LEN];
+    ipv6_addr_t addr;
+} node_t;
+
+typedef struct __attribute__((packed)) {
+    ethernet_hdr_t eth;
+    ipv6_hdr_t ipv6;
+    icmpv6_hdr_t icmpv6;
+    gnrc_rpl_dao_t dao;
+    gnrc_rpl_opt_target_t target;
+    gnrc_rpl_opt_transit_t transit;
+    ipv6_addr_t parent;
+} dao_frame_t;
+
+static const uint8_t _mac[] = MAC;
+static const ipv6_addr_t _dodag_id = { .u8 = DODAG_ID };
+
+static node_t _root = { .mac = MAC };
+static node_t _a = { .mac = { 0x02, 0x00, 0x00, 0x00, 0x0a, 0x01 } };
+static node_t _b = { .mac = { 0x02, 0x00, 0x00, 0x00, 0x0b, 0x01 } };
+static node_t _c = { .mac = { 0x02, 0x00, 0x00, 0x00, 0x0c, 0x01 } };
+
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static dao_frame_t _dao;
+static uint8_t _sent[ETHERNET_FRAME_LEN];
+static size_t _sent_len;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_mac));
+    memcpy(value, _mac, sizeof(_mac));
+    return sizeof(_mac);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(_dao);
+    }
+    expect(len >= (int)sizeof(_dao));
+    memcpy(buf, &_dao, sizeof(_dao));
+    return sizeof(_dao);
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+/* keeps the last UDP packet, DIOs and neighbor discovery are ignored */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    const ipv6_hdr_t *ipv6 = iolist->iol_next->iol_base;
+    size_t len = iolist_size(iolist);
+
+    (void)dev;
+    if ((ipv6->nh == PROTNUM_UDP) || (ipv6->nh == PROTNUM_IPV6_EXT_RH)) {
+        expect(len <= sizeof(_sent));
+        _sent_len = iolist_to_buffer(iolist, _sent, sizeof(_sent));
+    }
+    return len;
+}
+
+static void _node_init(node_t *node)
+{
+    eui64_t iid;
+
+    expect(l2util_ipv6_iid_from_addr(NETDEV_TYPE_ETHERNET, node->mac,
+                                     sizeof(node->mac), &iid) == sizeof(iid));
+    node->addr = _dodag_id;
+    ipv6_addr_set_iid(&node->addr, byteorder_ntohll(iid.uint64));
+}
+
+static void _netif_init(void)
+{
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_dev, _send);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    expect(gnrc_netif_ethernet_create(&_netif, _stack, sizeof(_stack),
+                                      GNRC_NETIF_PRIO, "root",
+                                      &_dev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_dodag_id, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID)
+           == sizeof(_dodag_id));
+}
+
+/* receives a DAO of @p node, which reaches the root via @p first_hop */
+static void _recv_dao(const node_t *node, const node_t *parent,
+                      const node_t *first_hop, uint8_t lifetime)
+{
+    netdev_t *dev = &_dev.netdev.netdev;
+    ethernet_hdr_t *eth = &_dao.eth;
+    ipv6_hdr_t *ipv6 = &_dao.ipv6;
+    uint16_t len = sizeof(_dao) - sizeof(_dao.eth) - sizeof(_dao.ipv6);
+    uint16_t csum;
+
+    memset(&_dao, 0, sizeof(_dao));
+    memcpy(eth->dst, _mac, sizeof(eth->dst));
+    memcpy(eth->src, first_hop->mac, sizeof(eth->src));
+    eth->type = byteorder_htons(ETHERTYPE_IPV6);
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(len);
+    ipv6->nh = PROTNUM_ICMPV6;
+    ipv6->hl = 64;
+    ipv6->src = node->addr;
+    ipv6->dst = _dodag_id;
+    _dao.icmpv6.type = ICMPV6_RPL_CTRL;
+    _dao.icmpv6.code = GNRC_RPL_ICMPV6_CODE_DAO;
+    _dao.dao.instance_id = INSTANCE_ID;
+    _dao.target.type = GNRC_RPL_OPT_TARGET;
+    _dao.target.length = GNRC_RPL_OPT_TARGET_LEN;
+    _dao.target.prefix_length = IPV6_ADDR_BIT_LEN;
+    _dao.target.target = node->addr;
+    _dao.transit.type = GNRC_RPL_OPT_TRANSIT;
+    _dao.transit.length = GNRC_RPL_OPT_TRANSIT_INFO_LEN + sizeof(_dao.parent);
+    _dao.transit.path_lifetime = lifetime;
+    _dao.parent = parent->addr;
+    csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_ICMPV6, len);
+    csum = inet_csum(csum, (uint8_t *)&_dao.icmpv6, len);
+    _dao.icmpv6.csum = byteorder_htons(~csum);
+
+    dev->event_callback(dev, NETDEV_EVENT_ISR);
+    ztimer_sleep(ZTIMER_MSEC, WAIT_MS);
+}
+
+static void _send_udp(const ipv6_addr_t *dst)
+{
+    static const char payload[] = "downward";
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, payload, sizeof(payload),
+                                          GNRC_NETTYPE_UNDEF);
+
+    expect(pkt != NULL);
+    pkt = gnrc_udp_hdr_build(pkt, PORT, PORT);
+    expect(pkt != NULL);
+    pkt = gnrc_ipv6_hdr_build(pkt, NULL, dst);
+    expect(pkt != NULL);
+    _sent_len = 0;
+    expect(gnrc_netapi_dispatch_send(GNRC_NETTYPE_UDP,
+                                     GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
+    ztimer_sleep(ZTIMER_MSEC, WAIT_MS);
+}
+
+/* lets every hop process the routing header and compares the destinations */
+static void _expect_route(ipv6_hdr_t *ipv6, gnrc_rpl_srh_t *rh,
+                          const ipv6_addr_t *route, unsigned hops)
+{
+    void *err_ptr;
+
+    expect(ipv6_addr_equal(&ipv6->dst, &route[0]));
+    expect((rh == NULL) ? (hops == 1) : (rh->seg_left == hops - 1));
+    for (unsigned i = 1; i < hops; i++) {
+        expect(gnrc_rpl_srh_process(ipv6, rh, &err_ptr) ==
+               GNRC_IPV6_EXT_RH_FORWARDED);
+        expect(ipv6_addr_equal(&ipv6->dst, &route[i]));
+    }
+}
+
+static void _expect_sent_route(const ipv6_addr_t *route, unsigned hops)
+{
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)&_sent[sizeof(ethernet_hdr_t)];
+    gnrc_rpl_srh_t *rh = NULL;
+    uint8_t nh = ipv6->nh;
+
+    expect(_sent_len > 0);
+    if (nh == PROTNUM_IPV6_EXT_RH) {
+        rh = (gnrc_rpl_srh_t *)(ipv6 + 1);
+        expect(rh->type == IPV6_EXT_RH_TYPE_RPL_SRH);
+        nh = rh->nh;
+        expect(byteorder_ntohs(ipv6->len) ==
+               (rh->len + 1) * 8 + sizeof(udp_hdr_t) + sizeof("downward"));
+    }
+    expect(nh == PROTNUM_UDP);
+    _expect_route(ipv6, rh, route, hops);
+}
+
+static void _test_dao(void)
+{
+    const ipv6_addr_t route[] = { _a.addr, _b.addr, _c.addr };
+
+    /* the parent of A is reported by the IID of the root's link-local address */
+    _recv_dao(&_a, &_root, &_a, LIFETIME);
+    _recv_dao(&_b, &_a, &_a, LIFETIME);
+    _recv_dao(&_c, &_b, &_a, LIFETIME);
+    _send_udp(&_c.addr);
+    _expect_sent_route(route, ARRAY_SIZE(route));
+    _send_udp(&_a.addr);
+    _expect_sent_route(route, 1);
+    puts("DAO routes OK");
+
+    /* C switches to A, the rest of the table stays as it is */
+    _recv_dao(&_c, &_a, &_a, LIFETIME);
+    _send_udp(&_c.addr);
+    _expect_sent_route((ipv6_addr_t[]){ _a.addr, _c.addr }, 2);
+    _send_udp(&_b.addr);
+    _expect_sent_route(route, 2);
+    puts("parent switch OK");
+
+    /* a no-path DAO removes the route */
+    _recv_dao(&_c, &_a, &_a, 0);
+    expect(gnrc_rpl_sr_table_route(&_c.addr, &(ipv6_addr_t){ 0 },
+                                   &(gnrc_pktsnip_t *){ NULL }) == -ENOENT);
+    puts("no-path DAO OK");
+}
+
+static void _node_addr(unsigned i, ipv6_addr_t *addr)
+{
+    *addr = _dodag_id;
+    addr->u8[8] = 0x02;
+    addr->u16[6] = byteorder_htons(0xbeef);
+    addr->u16[7] = byteorder_htons(i);
+}
+
+/* node i, counted from 1, has node i / ARITY as parent, 0 being the root */
+static unsigned _route_to(unsigned i, ipv6_addr_t *route)
+{
+    unsigned hops = 0;
+
+    for (unsigned n = i; n > 0; n /= ARITY) {
+        hops++;
+    }
+    for (unsigned n = i, j = hops; n > 0; n /= ARITY) {
+        _node_addr(n, &route[--j]);
+    }
+    return hops;
+}
+
+static void _test_scale(void)
+{
+    ipv6_addr_t route[CONFIG_GNRC_RPL_SR_TABLE_MAX_HOPS];
+    ipv6_addr_t addr, parent, first_hop;
+    gnrc_pktsnip_t *srh;
+    uint32_t start, usec;
+
+    gnrc_rpl_sr_table_reset(&_dodag_id);
+    /* add the nodes in random order to create parents before their DAO */
+    for (unsigned i = 1; i <= CONFIG_GNRC_RPL_SR_TABLE_SIZE; i++) {
+        unsigned n = ((i * 379) % CONFIG_GNRC_RPL_SR_TABLE_SIZE) + 1;
+
+        _node_addr(n, &addr);
+        _node_addr(n / ARITY, &parent);
+        expect(gnrc_rpl_sr_table_update(&addr, (n < ARITY) ? NULL : &parent,
+                                        LIFETIME) == 0);
+    }
+    _node_addr(CONFIG_GNRC_RPL_SR_TABLE_SIZE + 1, &addr);
+    expect(gnrc_rpl_sr_table_update(&addr, NULL, LIFETIME) == -ENOMEM);
+
+    for (unsigned i = 1; i <= CONFIG_GNRC_RPL_SR_TABLE_SIZE; i++) {
+        unsigned hops = _route_to(i, route);
+        ipv6_hdr_t ipv6 = { 0 };
+
+        expect(gnrc_rpl_sr_table_route(&route[hops - 1], &first_hop, &srh) == 0);
+        ipv6.dst = first_hop;
+        _expect_route(&ipv6, srh ? srh->data : NULL, route, hops);
+        gnrc_pktbuf_release(srh);
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned r = 0; r < ROUNDS; r++) {
+        for (unsigned i = 1; i <= CONFIG_GNRC_RPL_SR_TABLE_SIZE; i++) {
+            _node_addr(i, &addr);
+            expect(gnrc_rpl_sr_table_route(&addr, &first_hop, &srh) == 0);
+            gnrc_pktbuf_release(srh);
+        }
+    }
+    usec = ztimer_now(ZTIMER_USEC) - start;
+    printf("%u nodes: all routes OK, %" PRIu32 " ns per route\n",
+           CONFIG_GNRC_RPL_SR_TABLE_SIZE,
+           (uint32_t)((usec * 1000ULL) / (ROUNDS * CONFIG_GNRC_RPL_SR_TABLE_SIZE)));
+}
+
+static void _test_lifetime(void)
+{
+    ipv6_addr_t addr, parent, first_hop;
+    gnrc_pktsnip_t *srh;
+
+    /* a loop is no route */
+    _node_addr(1, &addr);
+    _node_addr(2, &parent);
+    expect(gnrc_rpl_sr_table_update(&addr, &parent, LIFETIME) == 0);
+    expect(gnrc_rpl_sr_table_update(&parent, &addr, LIFETIME) == 0);
+    expect(gnrc_rpl_sr_table_route(&addr, &first_hop, &srh) == -ENOENT);
+
+    /* expired leaves make room for new nodes */
+    _node_addr(CONFIG_GNRC_RPL_SR_TABLE_SIZE, &addr);
+    expect(gnrc_rpl_sr_table_update(&addr, NULL, 1) == 0);
+    ztimer_sleep(ZTIMER_SEC, 2);
+    expect(gnrc_rpl_sr_table_route(&addr, &first_hop, &srh) == -ENOENT);
+    _node_addr(CONFIG_GNRC_RPL_SR_TABLE_SIZE + 1, &addr);
+    expect(gnrc_rpl_sr_table_update(&addr, NULL, LIFETIME) == 0);
+    expect(gnrc_rpl_sr_table_route(&addr, &first_hop, &srh) == 0);
+    expect(srh == NULL);
+    puts("lifetime OK");
+}
+
+int main(void)
+{
+    _netif_init();
+    _node_init(&_root);
+    _node_init(&_a);
+    _node_init(&_b);
+    _node_init(&_c);
+    /* only A is a neighbor of the root */
+    expect(gnrc_ipv6_nib_nc_set(&_a.addr, _netif.pid, _a.mac,
+                                sizeof(_a.mac)) == 0);
+    expect(gnrc_rpl_init(_netif.pid) > KERNEL_PID_UNDEF);
+    expect(gnrc_rpl_root_init(INSTANCE_ID, &_dodag_id, false, false) != NULL);
+
+    _test_dao();
+    _test_scale();
+    _test_lifetime();
+
+    puts("SUCCESS");
+
+    return 0;
+}
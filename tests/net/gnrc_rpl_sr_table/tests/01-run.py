@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("DAO routes OK")
+    child.expect_exact("parent switch OK")
+    child.expect_exact("no-path DAO OK")
+    child.expect(r"512 nodes: all routes OK, \d+ ns per route")
+    child.expect_exact("lifetime OK")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
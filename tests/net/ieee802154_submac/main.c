@@ -80,9 +80,11 @@ static const uint8_t payload[] =
 
 static int print_addr(int argc, char **argv);
 static int txtsnd(int argc, char **argv);
+static int stats(int argc, char **argv);
 static const shell_command_t shell_commands[] = {
     { "print_addr", "Print IEEE802.15.4 addresses", print_addr },
     { "txtsnd", "Send IEEE 802.15.4 packet", txtsnd },
+    { "stats", "Print or reset SubMAC profiling counters", stats },
     { NULL, NULL, NULL }
 };
 
@@ -431,6 +433,40 @@ static int txtsnd(int argc, char **argv)
     return send(addr, res, len);
 }
 
+static int stats(int argc, char **argv)
+{
+#if IS_USED(MODULE_IEEE802154_SUBMAC_STATS)
+    static const char *states[IEEE802154_FSM_STATE_NUMOF] = {
+        "INVALID", "RX", "IDLE", "PREPARE", "TX", "WAIT_FOR_ACK",
+    };
+    ieee802154_submac_stats_t s;
+
+    mutex_lock(&lock);
+    if ((argc > 1) && (strcmp(argv[1], "reset") == 0)) {
+        ieee802154_submac_reset_stats(&submac);
+        mutex_unlock(&lock);
+        return 0;
+    }
+    ieee802154_submac_get_stats(&submac, &s);
+    mutex_unlock(&lock);
+
+    puts("state         entered         time [us]");
+    for (unsigned i = IEEE802154_FSM_STATE_RX; i < IEEE802154_FSM_STATE_NUMOF; i++) {
+        printf("%-12s %8" PRIu32 " %17" PRIu32 "\n", states[i], s.state_enter[i],
+               s.state_us[i]);
+    }
+    printf("frames: %" PRIu32 ", no ACK: %" PRIu32 ", busy: %" PRIu32 "\n",
+           s.tx_frames, s.tx_noack, s.tx_busy);
+    printf("retransmissions: %" PRIu32 ", CSMA-CA retries: %" PRIu32
+           ", backoff: %" PRIu32 " us\n", s.retrans, s.cca_retries, s.backoff_us);
+#else
+    (void)argc;
+    (void)argv;
+    puts("Not supported, use the ieee802154_submac_stats module");
+#endif
+    return 0;
+}
+
 static int _init(void)
 {
     mutex_init(&lock);
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+STATES = ("RX", "IDLE", "PREPARE", "TX", "WAIT_FOR_ACK")
+# CONFIG_IEEE802154_DEFAULT_MAX_FRAME_RETRANS
+MAX_FRAME_RETRANS = 4
+# no one answers frames to this address with an ACK
+DST_ADDR = "00:11:22:33:44:55:66:77"
+
+
+def get_stats(child):
+    stats = {}
+
+    child.sendline("stats")
+    child.expect_exact("state         entered         time [us]")
+    for state in STATES:
+        child.expect(r"{}\s+(\d+)\s+\d+\r\n".format(state))
+        stats[state] = int(child.match.group(1))
+    child.expect(r"frames: (\d+), no ACK: (\d+), busy: (\d+)\r\n")
+    stats["frames"], stats["noack"], stats["busy"] = \
+        (int(group) for group in child.match.groups())
+    child.expect(r"retransmissions: (\d+), CSMA-CA retries: (\d+),\s+"
+                 r"backoff: (\d+) us\r\n")
+    stats["retrans"], stats["cca_retries"], stats["backoff"] = \
+        (int(group) for group in child.match.groups())
+    return stats
+
+
+def testfunc(child):
+    child.expect_exact("Initialization successful - starting the shell now")
+    child.sendline("stats reset")
+    stats = get_stats(child)
+    assert not any(stats.values()), stats
+
+    child.sendline("txtsnd {} 10".format(DST_ADDR))
+    child.expect_exact("No ACK")
+    stats = get_stats(child)
+    assert stats["frames"] == 1, stats
+    assert stats["noack"] == 1, stats
+    assert stats["busy"] == 0, stats
+    assert stats["retrans"] == MAX_FRAME_RETRANS, stats
+    # every attempt is sent and waits for the ACK in vain
+    assert stats["TX"] == MAX_FRAME_RETRANS + 1, stats
+    assert stats["WAIT_FOR_ACK"] == MAX_FRAME_RETRANS + 1, stats
+    assert stats["IDLE"] == 1, stats
+
+    child.sendline("stats reset")
+    stats = get_stats(child)
+    assert not any(stats.values()), stats
+    print("stats OK")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
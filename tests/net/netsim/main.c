@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       In-process radio medium simulator test application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "net/netsim.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define DELAY_US        (1000U)
+#define GRID_WIDTH      (10U)
+#define GRID_NUMOF      (GRID_WIDTH * GRID_WIDTH)
+#define FLOOD_NUMOF     (10U)
+
+/* a simulation can not be stopped, so every test has its own */
+static netsim_t _line_sim, _loss_sim, _netdev_sim, _flood_sim;
+static netsim_node_t _line[3], _loss[4], _netdev[2], _grid[GRID_NUMOF];
+
+static unsigned _rx_count[GRID_NUMOF];
+static uint32_t _rx_latency[GRID_NUMOF];
+/* flood: sequence numbers each node has seen */
+static uint32_t _seen[GRID_NUMOF];
+
+static void _reset(void)
+{
+    memset(_rx_count, 0, sizeof(_rx_count));
+    memset(_rx_latency, 0, sizeof(_rx_latency));
+    memset(_seen, 0, sizeof(_seen));
+}
+
+static void _wait(void)
+{
+    /* with virtual time, this returns once the medium went quiet */
+    ztimer_sleep(ZTIMER_USEC, 100 * DELAY_US);
+}
+
+static void _rx_count_cb(netsim_node_t *node, const netsim_frame_t *frame)
+{
+    _rx_count[node->id]++;
+    _rx_latency[node->id] = ztimer_now(ZTIMER_USEC) - frame->origin_us;
+}
+
+static void _rx_relay_cb(netsim_node_t *node, const netsim_frame_t *frame)
+{
+    _rx_count_cb(node, frame);
+    /* node 1 relays frames of node 0 once */
+    if ((node->id == 1) && (frame->src == 0)) {
+        expect(netsim_forward(node, frame) == frame->len);
+    }
+}
+
+static void _test_line(void)
+{
+    static const netsim_grid_t line = {
+        .width = 1, .link = { .delay_us = DELAY_US },
+    };
+
+    _reset();
+    expect(netsim_init(&_line_sim, _line, ARRAY_SIZE(_line), netsim_link_grid,
+                       &line, 1) == 0);
+    for (unsigned i = 0; i < ARRAY_SIZE(_line); i++) {
+        netsim_node_set_rx_cb(&_line[i], _rx_relay_cb, NULL);
+    }
+
+    expect(netsim_send(&_line[0], "hello", 5) == 5);
+    _wait();
+
+    /* node 0 hears its own frame relayed by node 1 */
+    expect(_rx_count[0] == 1);
+    expect(_rx_count[1] == 1);
+    expect(_rx_count[2] == 1);
+    expect(_rx_latency[1] == DELAY_US);
+    expect(_rx_latency[2] == 2 * DELAY_US);
+
+    netsim_stats_t stats;
+    netsim_get_stats(&_line[2], &stats);
+    expect(stats.rx == 1);
+    expect(stats.latency_max_us == 2 * DELAY_US);
+
+    char big[CONFIG_NETSIM_FRAME_SIZE + 1] = { 0 };
+    expect(netsim_send(&_line[0], big, sizeof(big)) == -EMSGSIZE);
+    puts("line OK");
+}
+
+static void _test_loss(void)
+{
+    static const netsim_link_t lossy = { .delay_us = DELAY_US, .loss = 1000 };
+
+    _reset();
+    expect(netsim_init(&_loss_sim, _loss, ARRAY_SIZE(_loss), netsim_link_full,
+                       &lossy, 1) == 0);
+    for (unsigned i = 0; i < ARRAY_SIZE(_loss); i++) {
+        netsim_node_set_rx_cb(&_loss[i], _rx_count_cb, NULL);
+    }
+
+    expect(netsim_send(&_loss[0], "x", 1) == 1);
+    _wait();
+
+    for (unsigned i = 1; i < ARRAY_SIZE(_loss); i++) {
+        netsim_stats_t stats;
+        netsim_get_stats(&_loss[i], &stats);
+        expect(_rx_count[i] == 0);
+        expect(stats.lost == 1);
+    }
+    puts("loss OK");
+}
+
+static char _netdev_buf[CONFIG_NETSIM_FRAME_SIZE];
+static int _netdev_len;
+
+static void _event_cb(netdev_t *dev, netdev_event_t event)
+{
+    if (event == NETDEV_EVENT_ISR) {
+        dev->driver->isr(dev);
+    }
+    else if (event == NETDEV_EVENT_RX_COMPLETE) {
+        int len = dev->driver->recv(dev, NULL, 0, NULL);
+        expect(len > 0);
+        _netdev_len = dev->driver->recv(dev, _netdev_buf, len, NULL);
+    }
+}
+
+static void _test_netdev(void)
+{
+    static const netsim_link_t link = { .delay_us = DELAY_US };
+    const char part1[] = "hello ";
+    const char part2[] = "netdev";
+
+    expect(netsim_init(&_netdev_sim, _netdev, ARRAY_SIZE(_netdev),
+                       netsim_link_full, &link, 1) == 0);
+    netdev_t *rx = netsim_node_netdev(&_netdev[1]);
+    netdev_t *tx = netsim_node_netdev(&_netdev[0]);
+    rx->event_callback = _event_cb;
+
+    iolist_t iol2 = { .iol_base = (void *)part2, .iol_len = sizeof(part2) };
+    iolist_t iol1 = { .iol_next = &iol2, .iol_base = (void *)part1,
+                      .iol_len = sizeof(part1) - 1 };
+    expect(tx->driver->send(tx, &iol1) == sizeof(part1) - 1 + sizeof(part2));
+    _wait();
+
+    expect(_netdev_len == sizeof(part1) - 1 + sizeof(part2));
+    expect(strcmp(_netdev_buf, "hello netdev") == 0);
+
+    netsim_stats_t stats;
+    netsim_get_stats(&_netdev[1], &stats);
+    expect((stats.rx == 1) && (stats.queued == 0) && (stats.queued_max == 1));
+    puts("netdev OK");
+}
+
+static void _rx_flood_cb(netsim_node_t *node, const netsim_frame_t *frame)
+{
+    uint8_t seq = frame->data[0];
+
+    if (!(_seen[node->id] & (1UL << seq))) {
+        _seen[node->id] |= 1UL << seq;
+        netsim_forward(node, frame);
+    }
+}
+
+static void _test_flood(void)
+{
+    static const netsim_grid_t grid = {
+        .width = GRID_WIDTH, .link = { .delay_us = DELAY_US, .loss = 100 },
+    };
+
+    _reset();
+    expect(netsim_init(&_flood_sim, _grid, GRID_NUMOF, netsim_link_grid,
+                       &grid, 42) == 0);
+    for (unsigned i = 0; i < GRID_NUMOF; i++) {
+        netsim_node_set_rx_cb(&_grid[i], _rx_flood_cb, NULL);
+    }
+
+    for (uint8_t seq = 0; seq < FLOOD_NUMOF; seq++) {
+        _seen[0] |= 1UL << seq;
+        expect(netsim_send(&_grid[0], &seq, 1) == 1);
+        _wait();
+    }
+
+    unsigned reached = 0;
+    for (unsigned i = 0; i < GRID_NUMOF; i++) {
+        reached += __builtin_popcount(_seen[i]);
+    }
+    netsim_print_stats(&_flood_sim);
+    printf("flood reached %u of %u\n", reached, GRID_NUMOF * FLOOD_NUMOF);
+
+    /* the far corner is at least 18 hops away */
+    netsim_stats_t stats;
+    netsim_get_stats(&_grid[GRID_NUMOF - 1], &stats);
+    expect(stats.latency_max_us >= 2 * (GRID_WIDTH - 1) * DELAY_US);
+    /* with 10 % loss per link, some nodes miss a frame from all neighbors */
+    expect(reached > GRID_NUMOF * FLOOD_NUMOF * 8 / 10);
+    puts("flood OK");
+}
+
+int main(void)
+{
+    _test_line();
+    _test_loss();
+    _test_netdev();
+    _test_flood();
+
+    puts("SUCCESS");
+    return 0;
+}
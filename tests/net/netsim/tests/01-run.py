@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("line OK")
+    child.expect_exact("loss OK")
+    child.expect_exact("netdev OK")
+    child.expect(r"flood reached (\d+) of (\d+)\r\n")
+    child.expect_exact("flood OK")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,137 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the per neighbor traffic statistics
+ *
+ * Feeds transmissions and receptions into the neighbor statistics of an
+ * interface and checks the packet, retry, busy and byte counters as well as
+ * the throughput history read back by netstats_nb_iter().
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/netstats/neighbor.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define NBR_A           { 0x02, 0x00, 0x00, 0x00, 0x00, 0x0a }
+#define NBR_B           { 0x02, 0x00, 0x00, 0x00, 0x00, 0x0b }
+
+static const uint8_t _nbr_a[] = NBR_A;
+static const uint8_t _nbr_b[] = NBR_B;
+
+static netif_t _netif;
+
+/* looks up the entry of @p l2_addr by iterating over all entries */
+static void _find(const uint8_t *l2_addr, netstats_nb_t *out)
+{
+    unsigned state = 0;
+
+    while (netstats_nb_iter(&_netif, &state, out)) {
+        if (memcmp(out->l2_addr, l2_addr, out->l2_addr_len) == 0) {
+            return;
+        }
+    }
+    expect(false);
+}
+
+static void _test_tx(void)
+{
+    netstats_nb_t stats;
+
+    netstats_nb_record(&_netif, _nbr_a, sizeof(_nbr_a), 100);
+    netstats_nb_update_tx(&_netif, NETSTATS_NB_SUCCESS, 3);
+    netstats_nb_record(&_netif, _nbr_a, sizeof(_nbr_a), 50);
+    netstats_nb_update_tx(&_netif, NETSTATS_NB_NOACK, 4);
+    netstats_nb_record(&_netif, _nbr_a, sizeof(_nbr_a), 80);
+    netstats_nb_update_tx(&_netif, NETSTATS_NB_BUSY, 0);
+    /* multicast is not counted for any neighbor */
+    netstats_nb_record(&_netif, NULL, 0, 0);
+    netstats_nb_update_tx(&_netif, NETSTATS_NB_SUCCESS, 1);
+
+    _find(_nbr_a, &stats);
+    expect(stats.tx_count == 2);
+    expect(stats.tx_fail == 1);
+    expect(stats.tx_retries == 5);
+    expect(stats.tx_busy == 1);
+    expect(stats.tx_bytes == 150);
+    expect(stats.rx_bytes == 0);
+    expect(stats.history[0] == 150);
+    puts("TX OK");
+}
+
+static void _test_rx(void)
+{
+    netstats_nb_t stats;
+    unsigned state = 0, numof = 0;
+
+    netstats_nb_update_rx(&_netif, _nbr_b, sizeof(_nbr_b), 0, 0, 40);
+    netstats_nb_update_rx(&_netif, _nbr_b, sizeof(_nbr_b), 0, 0, 60);
+
+    _find(_nbr_b, &stats);
+    expect(stats.rx_count == 2);
+    expect(stats.rx_bytes == 100);
+    expect(stats.tx_bytes == 0);
+    expect(stats.tx_count == 0);
+
+    while (netstats_nb_iter(&_netif, &state, &stats)) {
+        numof++;
+    }
+    expect(numof == 2);
+    puts("RX OK");
+}
+
+static void _test_history(void)
+{
+    netstats_nb_t stats;
+
+    /* start at the beginning of a window */
+    ztimer_sleep(ZTIMER_SEC, 1);
+    netstats_nb_update_rx(&_netif, _nbr_b, sizeof(_nbr_b), 0, 0, 10);
+    _find(_nbr_b, &stats);
+    expect(stats.history[0] == 10);
+
+    ztimer_sleep(ZTIMER_SEC, 1);
+    netstats_nb_update_rx(&_netif, _nbr_b, sizeof(_nbr_b), 0, 0, 20);
+    _find(_nbr_b, &stats);
+    expect(stats.history[0] == 20);
+    expect(stats.history[1] == 10);
+
+    /* reading moves idle neighbors on to the current window as well */
+    ztimer_sleep(ZTIMER_SEC, 2);
+    _find(_nbr_b, &stats);
+    expect(stats.history[0] == 0);
+    expect(stats.history[1] == 0);
+    expect(stats.history[2] == 20);
+    expect(stats.history[3] == 10);
+    expect(stats.rx_bytes == 130);
+
+    ztimer_sleep(ZTIMER_SEC, NETSTATS_NB_HISTORY_SIZE);
+    _find(_nbr_b, &stats);
+    for (unsigned i = 0; i < NETSTATS_NB_HISTORY_SIZE; i++) {
+        expect(stats.history[i] == 0);
+    }
+    puts("history OK");
+}
+
+int main(void)
+{
+    netstats_nb_init(&_netif);
+
+    _test_tx();
+    _test_rx();
+    _test_history();
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,19 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("TX OK")
+    child.expect_exact("RX OK")
+    child.expect_exact("history OK")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,186 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for sock with stackless coroutines
+ *
+ * Runs an echo server and many clients as coroutines on the event queue of
+ * the main thread, talking to each other via the loopback address.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "event/coro.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/coro.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define CLIENTS_NUMOF   (64U)
+#define ROUNDS_NUMOF    (4U)
+#define SERVER_PORT     (12345U)
+#define SILENT_PORT     (12346U)
+#define TIMEOUT_MS      (1000U)
+
+typedef struct {
+    unsigned id;
+    unsigned round;
+} request_t;
+
+typedef struct {
+    event_coro_t coro;
+    sock_udp_t sock;
+    sock_udp_ep_t remote;
+    ssize_t res;
+    request_t buf;
+} server_t;
+
+typedef struct {
+    event_coro_t coro;
+    sock_udp_t sock;
+    uint16_t port;
+    unsigned id;
+    unsigned round;
+    unsigned replies;
+    ssize_t res;
+    request_t buf;
+} client_t;
+
+static event_queue_t _queue;
+static server_t _server;
+static client_t _clients[CLIENTS_NUMOF];
+static unsigned _done;
+
+static void _on_done(event_coro_t *coro)
+{
+    (void)coro;
+    _done++;
+}
+
+static void _run_until_done(unsigned numof)
+{
+    while (_done < numof) {
+        event_t *event = event_wait(&_queue);
+        event->handler(event);
+    }
+}
+
+static int _echo_server(event_coro_t *coro)
+{
+    server_t *s = container_of(coro, server_t, coro);
+
+    EVENT_CORO_BEGIN(coro);
+    while (1) {
+        SOCK_CORO_AWAIT(coro, s->res,
+                        sock_udp_recv(&s->sock, &s->buf, sizeof(s->buf), 0,
+                                      &s->remote));
+        expect(s->res == sizeof(s->buf));
+        expect(sock_udp_send(&s->sock, &s->buf, s->res, &s->remote) == s->res);
+    }
+    EVENT_CORO_END(coro);
+}
+
+static int _client(event_coro_t *coro)
+{
+    client_t *c = container_of(coro, client_t, coro);
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = c->port };
+
+    EVENT_CORO_BEGIN(coro);
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    expect(sock_udp_create(&c->sock, NULL, &remote, 0) == 0);
+    sock_udp_coro_attach(&c->sock, coro);
+
+    for (c->round = 0; c->round < ROUNDS_NUMOF; c->round++) {
+        c->buf.id = c->id;
+        c->buf.round = c->round;
+        expect(sock_udp_send(&c->sock, &c->buf, sizeof(c->buf), NULL)
+               == sizeof(c->buf));
+        SOCK_CORO_AWAIT_TIMEOUT(coro, c->res,
+                                sock_udp_recv(&c->sock, &c->buf, sizeof(c->buf),
+                                              0, NULL),
+                                ZTIMER_MSEC, TIMEOUT_MS);
+        if (c->res == -ETIMEDOUT) {
+            break;
+        }
+        expect(c->res == sizeof(c->buf));
+        expect((c->buf.id == c->id) && (c->buf.round == c->round));
+        c->replies++;
+    }
+    sock_udp_close(&c->sock);
+    EVENT_CORO_END(coro);
+}
+
+static void _start_clients(unsigned numof, uint16_t port)
+{
+    _done = 0;
+    for (unsigned i = 0; i < numof; i++) {
+        client_t *c = &_clients[i];
+        memset(c, 0, sizeof(*c));
+        c->id = i;
+        c->port = port;
+        event_coro_init(&c->coro, &_queue, _client);
+        event_coro_set_done(&c->coro, _on_done);
+        event_coro_start(&c->coro);
+    }
+}
+
+static void _test_echo(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+    local.port = SERVER_PORT;
+    expect(sock_udp_create(&_server.sock, &local, NULL, 0) == 0);
+    event_coro_init(&_server.coro, &_queue, _echo_server);
+    sock_udp_coro_attach(&_server.sock, &_server.coro);
+    event_coro_start(&_server.coro);
+
+    _start_clients(CLIENTS_NUMOF, SERVER_PORT);
+    _run_until_done(CLIENTS_NUMOF);
+    for (unsigned i = 0; i < CLIENTS_NUMOF; i++) {
+        expect(_clients[i].replies == ROUNDS_NUMOF);
+    }
+
+    /* the server still waits for requests */
+    sock_udp_close(&_server.sock);
+    event_cancel(&_queue, &_server.coro.super);
+    puts("echo OK");
+}
+
+static void _test_timeout(void)
+{
+    uint32_t start = ztimer_now(ZTIMER_MSEC);
+
+    /* nobody answers */
+    _start_clients(2, SILENT_PORT);
+    _run_until_done(2);
+    expect(ztimer_now(ZTIMER_MSEC) - start >= TIMEOUT_MS);
+    expect(_clients[0].res == -ETIMEDOUT);
+    expect(_clients[0].replies == 0);
+    expect(_clients[1].res == -ETIMEDOUT);
+    puts("timeout OK");
+}
+
+int main(void)
+{
+    event_queue_init(&_queue);
+
+    _test_echo();
+    _test_timeout();
+
+    printf("%u sessions on one thread\n", CLIENTS_NUMOF + 1);
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the C++20 coroutine adapters
+ *
+ * Runs an echo server and many clients as tasks on the event queue of the
+ * main thread, talking to each other via the loopback address.
+ *
+ * @}
+ */
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "riot/coroutine.hpp"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+namespace {
+
+constexpr unsigned clients_numof = 32;
+constexpr unsigned rounds_numof = 4;
+constexpr uint16_t server_port = 12345;
+constexpr uint16_t silent_port = 12346;
+constexpr uint32_t timeout_ms = 1000;
+
+struct request {
+  unsigned id;
+  unsigned round;
+};
+
+event_queue_t s_queue;
+unsigned s_done;
+
+/* handles the queued events until @p numof tasks finished */
+void run_until_done(unsigned numof) {
+  while (s_done < numof) {
+    event_t* event = event_wait(&s_queue);
+    event->handler(event);
+  }
+}
+
+riot::task take_turns(char name, char* log) {
+  for (unsigned i = 0; i < 2; i++) {
+    log[strlen(log)] = name;
+    co_await riot::yield();
+  }
+  s_done++;
+}
+
+void test_yield() {
+  char log[8] = {};
+
+  s_done = 0;
+  take_turns('a', log).start(&s_queue);
+  take_turns('b', log).start(&s_queue);
+  run_until_done(2);
+  expect(strcmp(log, "abab") == 0);
+  puts("yield OK");
+}
+
+riot::task sleep(uint32_t* elapsed) {
+  uint32_t start = ztimer_now(ZTIMER_MSEC);
+  co_await riot::sleep_for(ZTIMER_MSEC, 10);
+  *elapsed = ztimer_now(ZTIMER_MSEC) - start;
+  s_done++;
+}
+
+void test_sleep() {
+  uint32_t elapsed = 0;
+
+  s_done = 0;
+  sleep(&elapsed).start(&s_queue);
+  run_until_done(1);
+  expect(elapsed >= 10);
+  puts("sleep OK");
+}
+
+riot::task echo_server(unsigned clients, bool* stopped) {
+  sock_udp_t sock;
+  sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+  local.port = server_port;
+  expect(sock_udp_create(&sock, &local, nullptr, 0) == 0);
+
+  while (s_done < clients) {
+    request req;
+    sock_udp_ep_t remote;
+    ssize_t res = co_await riot::async_recv(&sock, &req, sizeof(req), &remote)
+                      .timeout(ZTIMER_MSEC, 100);
+    if (res == -ETIMEDOUT) {
+      continue;
+    }
+    expect(res == sizeof(req));
+    expect(sock_udp_send(&sock, &req, res, &remote) == res);
+  }
+  sock_udp_close(&sock);
+  *stopped = true;
+}
+
+riot::task client(unsigned id, uint16_t port, unsigned* replies,
+                  ssize_t* last) {
+  sock_udp_t sock;
+  sock_udp_ep_t remote = {};
+  remote.family = AF_INET6;
+  remote.port = port;
+  ipv6_addr_set_loopback(reinterpret_cast<ipv6_addr_t*>(&remote.addr.ipv6));
+  expect(sock_udp_create(&sock, nullptr, &remote, 0) == 0);
+
+  for (unsigned round = 0; round < rounds_numof; round++) {
+    request req = {id, round};
+    expect(sock_udp_send(&sock, &req, sizeof(req), nullptr) == sizeof(req));
+    *last = co_await riot::async_recv(&sock, &req, sizeof(req))
+                .timeout(ZTIMER_MSEC, timeout_ms);
+    if (*last == -ETIMEDOUT) {
+      break;
+    }
+    expect(*last == sizeof(req));
+    expect((req.id == id) && (req.round == round));
+    (*replies)++;
+  }
+  sock_udp_close(&sock);
+  s_done++;
+}
+
+void test_echo() {
+  static unsigned replies[clients_numof];
+  static ssize_t last[clients_numof];
+  bool stopped = false;
+
+  s_done = 0;
+  echo_server(clients_numof, &stopped).start(&s_queue);
+  for (unsigned i = 0; i < clients_numof; i++) {
+    client(i, server_port, &replies[i], &last[i]).start(&s_queue);
+  }
+  run_until_done(clients_numof);
+  for (unsigned i = 0; i < clients_numof; i++) {
+    expect(replies[i] == rounds_numof);
+  }
+
+  while (!stopped) {
+    event_t* event = event_wait(&s_queue);
+    event->handler(event);
+  }
+  puts("echo OK");
+}
+
+void test_timeout() {
+  unsigned replies = 0;
+  ssize_t last = 0;
+  uint32_t start = ztimer_now(ZTIMER_MSEC);
+
+  /* nobody answers */
+  s_done = 0;
+  client(0, silent_port, &replies, &last).start(&s_queue);
+  run_until_done(1);
+  expect(ztimer_now(ZTIMER_MSEC) - start >= timeout_ms);
+  expect(last == -ETIMEDOUT);
+  expect(replies == 0);
+  puts("timeout OK");
+}
+
+} // namespace
+
+int main() {
+  event_queue_init(&s_queue);
+
+  test_yield();
+  test_sleep();
+  test_echo();
+  test_timeout();
+
+  puts("SUCCESS");
+
+  return 0;
+}
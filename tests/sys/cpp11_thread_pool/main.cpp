@@ -0,0 +1,144 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Test pooled threads and the thread pool
+ *
+ * @}
+ */
+
+#include <cstdio>
+#include <system_error>
+
+#include "riot/mutex.hpp"
+#include "riot/thread.hpp"
+#include "riot/thread_pool.hpp"
+#include "riot/condition_variable.hpp"
+
+#include "test_utils/expect.h"
+
+using namespace riot;
+
+static constexpr unsigned stacks_numof = 2;
+static constexpr unsigned tasks_numof = 4;
+static constexpr unsigned rounds = 100;
+
+using worker_thread
+  = pooled_thread<THREAD_STACKSIZE_DEFAULT, THREAD_PRIORITY_MAIN - 1,
+                  stacks_numof>;
+
+static void test_pooled_threads(int initial_num_threads) {
+  unsigned sum = 0;
+  for (unsigned i = 0; i < rounds; i++) {
+    worker_thread t([&sum](unsigned j) { sum += j; }, i);
+    t.join();
+    expect(worker_thread::pool().available() == stacks_numof);
+  }
+  expect(sum == rounds * (rounds - 1) / 2);
+
+  // a pooled thread can be moved into a plain thread
+  thread t = worker_thread([] {
+    // nop
+  });
+  expect(t.joinable());
+  t.join();
+
+  // a detached thread returns its stack once it is finished
+  worker_thread([] {
+    // nop
+  }).detach();
+  expect(worker_thread::pool().available() == stacks_numof);
+
+  expect(sched_num_threads == initial_num_threads);
+  puts("pooled threads OK");
+}
+
+static void test_pool_exhaustion(int initial_num_threads) {
+  mutex m;
+  condition_variable cv;
+  bool done = false;
+  auto wait_done = [&] {
+    unique_lock<mutex> lk(m);
+    cv.wait(lk, [&] { return done; });
+  };
+
+  worker_thread t1(wait_done);
+  worker_thread t2(wait_done);
+  expect(worker_thread::pool().available() == 0);
+  bool failed = false;
+  try {
+    worker_thread t3(wait_done);
+  }
+  catch (const std::system_error& e) {
+    failed = true;
+  }
+  expect(failed);
+
+  {
+    lock_guard<mutex> lk(m);
+    done = true;
+    cv.notify_all();
+  }
+  t1.join();
+  t2.join();
+  expect(worker_thread::pool().available() == stacks_numof);
+  expect(sched_num_threads == initial_num_threads);
+  puts("pool exhaustion OK");
+}
+
+static void test_thread_pool(int initial_num_threads) {
+  unsigned count = 0;
+  {
+    thread_pool<2, tasks_numof, THREAD_STACKSIZE_DEFAULT> pool;
+    expect(sched_num_threads == initial_num_threads + 2);
+    for (unsigned i = 0; i < rounds; i++) {
+      pool.post([&count] { count++; });
+    }
+    pool.wait();
+    expect(count == rounds);
+    expect(pool.pending() == 0);
+  }
+  expect(sched_num_threads == initial_num_threads);
+  puts("thread pool OK");
+}
+
+static void test_thread_pool_queue(int initial_num_threads) {
+  unsigned count = 0;
+  {
+    // the workers only run while main blocks
+    thread_pool<1, tasks_numof, THREAD_STACKSIZE_DEFAULT,
+                THREAD_PRIORITY_MAIN + 1> pool;
+    for (unsigned i = 0; i < tasks_numof; i++) {
+      expect(pool.try_post([&count] { count++; }));
+    }
+    expect(!pool.try_post([&count] { count++; }));
+    expect(pool.pending() == tasks_numof);
+    expect(count == 0);
+
+    // blocks until the worker took a task from the queue
+    pool.post([&count] { count++; });
+    expect(pool.pending() == tasks_numof);
+  }
+  // the destructor runs the remaining tasks
+  expect(count == tasks_numof + 1);
+  expect(sched_num_threads == initial_num_threads);
+  puts("thread pool queue OK");
+}
+
+int main() {
+  const int initial_num_threads = sched_num_threads;
+
+  test_pooled_threads(initial_num_threads);
+  test_pool_exhaustion(initial_num_threads);
+  test_thread_pool(initial_num_threads);
+  test_thread_pool_queue(initial_num_threads);
+  puts("SUCCESS");
+
+  return 0;
+}
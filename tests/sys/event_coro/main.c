@@ -0,0 +1,206 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for stackless coroutines
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "container.h"
+#include "event/coro.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define COROS_NUMOF     (100U)
+#define ROUNDS_NUMOF    (5U)
+
+typedef struct {
+    event_coro_t coro;
+    unsigned id;
+    unsigned round;
+} counter_t;
+
+typedef struct {
+    event_coro_t coro;
+    bool ready;
+    bool timed_out;
+    uint32_t start;
+    uint32_t elapsed;
+} waiter_t;
+
+static event_queue_t _queue;
+static counter_t _counters[COROS_NUMOF];
+static waiter_t _waiter;
+static unsigned _step;
+static unsigned _done;
+
+static void _on_done(event_coro_t *coro)
+{
+    (void)coro;
+    _done++;
+}
+
+/* handles the queued events until @p numof coroutines finished */
+static void _run_until_done(unsigned numof)
+{
+    while (_done < numof) {
+        event_t *event = event_wait(&_queue);
+        event->handler(event);
+    }
+}
+
+/* handles the events that are queued right now */
+static void _run_pending(void)
+{
+    event_t *event;
+
+    while ((event = event_get(&_queue))) {
+        event->handler(event);
+    }
+}
+
+static int _count(event_coro_t *coro)
+{
+    counter_t *c = container_of(coro, counter_t, coro);
+
+    EVENT_CORO_BEGIN(coro);
+    for (c->round = 0; c->round < ROUNDS_NUMOF; c->round++) {
+        /* the coroutines take turns */
+        expect(_step == c->round * COROS_NUMOF + c->id);
+        _step++;
+        EVENT_CORO_YIELD(coro);
+    }
+    EVENT_CORO_END(coro);
+}
+
+static void _test_interleaving(void)
+{
+    _done = 0;
+    for (unsigned i = 0; i < COROS_NUMOF; i++) {
+        _counters[i].id = i;
+        event_coro_init(&_counters[i].coro, &_queue, _count);
+        event_coro_set_done(&_counters[i].coro, _on_done);
+        event_coro_start(&_counters[i].coro);
+    }
+    _run_until_done(COROS_NUMOF);
+    expect(_step == COROS_NUMOF * ROUNDS_NUMOF);
+    expect(event_get(&_queue) == NULL);
+    puts("interleaving OK");
+}
+
+static int _wait(event_coro_t *coro)
+{
+    waiter_t *w = container_of(coro, waiter_t, coro);
+
+    EVENT_CORO_BEGIN(coro);
+    EVENT_CORO_WAIT_UNTIL(coro, w->ready);
+    EVENT_CORO_END(coro);
+}
+
+static void _test_wait(void)
+{
+    _done = 0;
+    _waiter.ready = false;
+    event_coro_init(&_waiter.coro, &_queue, _wait);
+    event_coro_set_done(&_waiter.coro, _on_done);
+    event_coro_start(&_waiter.coro);
+
+    _run_pending();
+    expect(_done == 0);
+
+    /* waking up does not help as long as the condition is false */
+    event_coro_wake(&_waiter.coro);
+    _run_pending();
+    expect(_done == 0);
+
+    _waiter.ready = true;
+    event_coro_wake(&_waiter.coro);
+    /* finishing drops the second wake-up */
+    event_coro_wake(&_waiter.coro);
+    _run_pending();
+    expect(_done == 1);
+    expect(event_get(&_queue) == NULL);
+    puts("wait OK");
+}
+
+static int _wait_timeout(event_coro_t *coro)
+{
+    waiter_t *w = container_of(coro, waiter_t, coro);
+
+    EVENT_CORO_BEGIN(coro);
+    EVENT_CORO_WAIT_UNTIL_TIMEOUT(coro, w->ready, ZTIMER_MSEC, 10);
+    w->timed_out = event_coro_timed_out(coro);
+    EVENT_CORO_END(coro);
+}
+
+static void _test_timeout(void)
+{
+    /* nothing happens */
+    _done = 0;
+    _waiter.ready = false;
+    event_coro_init(&_waiter.coro, &_queue, _wait_timeout);
+    event_coro_set_done(&_waiter.coro, _on_done);
+    event_coro_start(&_waiter.coro);
+    _run_until_done(1);
+    expect(_waiter.timed_out);
+
+    /* the condition becomes true in time */
+    _done = 0;
+    event_coro_start(&_waiter.coro);
+    _run_pending();
+    _waiter.ready = true;
+    event_coro_wake(&_waiter.coro);
+    _run_pending();
+    expect(_done == 1);
+    expect(!_waiter.timed_out);
+
+    /* the timer has been stopped */
+    ztimer_sleep(ZTIMER_MSEC, 20);
+    expect(event_get(&_queue) == NULL);
+    puts("timeout OK");
+}
+
+static int _sleep(event_coro_t *coro)
+{
+    waiter_t *w = container_of(coro, waiter_t, coro);
+
+    EVENT_CORO_BEGIN(coro);
+    w->start = ztimer_now(ZTIMER_MSEC);
+    EVENT_CORO_SLEEP(coro, ZTIMER_MSEC, 10);
+    w->elapsed = ztimer_now(ZTIMER_MSEC) - w->start;
+    EVENT_CORO_END(coro);
+}
+
+static void _test_sleep(void)
+{
+    _done = 0;
+    event_coro_init(&_waiter.coro, &_queue, _sleep);
+    event_coro_set_done(&_waiter.coro, _on_done);
+    event_coro_start(&_waiter.coro);
+    _run_until_done(1);
+    expect(_waiter.elapsed >= 10);
+    puts("sleep OK");
+}
+
+int main(void)
+{
+    event_queue_init(&_queue);
+
+    _test_interleaving();
+    _test_wait();
+    _test_timeout();
+    _test_sleep();
+
+    puts("SUCCESS");
+
+    return 0;
+}
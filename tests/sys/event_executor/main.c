@@ -0,0 +1,232 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the work-stealing task executor
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "event.h"
+#include "event/executor.h"
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define WORKERS_NUMOF   (2U)
+#define TASKS_NUMOF     (WORKERS_NUMOF * CONFIG_EVENT_EXECUTOR_DEQUE_SIZE)
+
+typedef struct {
+    event_task_t task;
+    unsigned runs;
+} test_task_t;
+
+static event_executor_t _executor;
+static event_executor_worker_t _workers[WORKERS_NUMOF];
+static test_task_t _tasks[TASKS_NUMOF + 1];
+static mutex_t _block = MUTEX_INIT_LOCKED;
+
+static void _count(event_t *event)
+{
+    test_task_t *t = container_of(event, test_task_t, task.super);
+    t->runs++;
+}
+
+static void _blocking(event_t *event)
+{
+    mutex_lock(&_block);
+    _count(event);
+}
+
+static void _spawn(event_t *event)
+{
+    /* the subtasks follow the spawning task */
+    test_task_t *t = container_of(event, test_task_t, task.super);
+    for (unsigned i = 1; i < 3; i++) {
+        expect(event_executor_post(&_executor, &t[i].task) == 0);
+    }
+    _count(event);
+}
+
+static void _nop(event_t *event)
+{
+    (void)event;
+}
+
+static void _reset(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_tasks); i++) {
+        event_task_init(&_tasks[i].task, _count);
+        _tasks[i].runs = 0;
+    }
+}
+
+static uint32_t _executed(void)
+{
+    uint32_t sum = 0;
+    for (unsigned i = 0; i < WORKERS_NUMOF; i++) {
+        sum += _workers[i].executed;
+    }
+    return sum;
+}
+
+static uint32_t _stolen(void)
+{
+    uint32_t sum = 0;
+    for (unsigned i = 0; i < WORKERS_NUMOF; i++) {
+        sum += _workers[i].stolen;
+    }
+    return sum;
+}
+
+static void _test_distribution(void)
+{
+    _reset();
+    uint32_t executed = _executed();
+
+    for (unsigned i = 0; i < 4; i++) {
+        expect(event_executor_post(&_executor, &_tasks[i].task) == 0);
+    }
+    /* the workers have a lower priority, so nothing ran yet */
+    expect(_workers[0].numof == 2);
+    expect(_workers[1].numof == 2);
+    expect(!event_task_done(&_tasks[0].task));
+
+    for (unsigned i = 0; i < 4; i++) {
+        event_task_wait(&_tasks[i].task);
+        expect(event_task_done(&_tasks[i].task));
+        expect(_tasks[i].runs == 1);
+    }
+    expect(_executed() - executed == 4);
+    puts("distribution OK");
+}
+
+static void _test_stealing(void)
+{
+    _reset();
+    uint32_t stolen = _stolen();
+
+    /* the first task blocks its worker, the tasks queued behind it have to
+     * be stolen by the other one */
+    _tasks[0].task.super.handler = _blocking;
+    for (unsigned i = 0; i < 5; i++) {
+        expect(event_executor_post(&_executor, &_tasks[i].task) == 0);
+    }
+    for (unsigned i = 1; i < 5; i++) {
+        event_task_wait(&_tasks[i].task);
+        expect(_tasks[i].runs == 1);
+    }
+    expect(!event_task_done(&_tasks[0].task));
+    expect(_stolen() > stolen);
+
+    mutex_unlock(&_block);
+    event_task_wait(&_tasks[0].task);
+    expect(_tasks[0].runs == 1);
+    puts("stealing OK");
+}
+
+static void _test_completion(void)
+{
+    event_queue_t queue;
+    event_t done = { .handler = _nop };
+
+    _reset();
+    event_queue_init(&queue);
+    event_task_set_completion(&_tasks[0].task, &queue, &done);
+    expect(event_executor_post(&_executor, &_tasks[0].task) == 0);
+
+    expect(event_wait(&queue) == &done);
+    expect(_tasks[0].runs == 1);
+    event_task_wait(&_tasks[0].task);
+    puts("completion OK");
+}
+
+static void _test_repost(void)
+{
+    event_queue_t queue;
+    event_t done = { .handler = _nop };
+
+    _reset();
+    event_queue_init(&queue);
+    event_task_set_completion(&_tasks[0].task, &queue, &done);
+    expect(event_executor_post(&_executor, &_tasks[0].task) == 0);
+
+    /* re-post the task as soon as it reports completion, the first run must
+     * not mark the second one done */
+    expect(event_wait(&queue) == &done);
+    _tasks[0].task.super.handler = _blocking;
+    expect(event_executor_post(&_executor, &_tasks[0].task) == 0);
+    ztimer_sleep(ZTIMER_MSEC, 10);
+    expect(!event_task_done(&_tasks[0].task));
+
+    mutex_unlock(&_block);
+    expect(event_wait(&queue) == &done);
+    event_task_wait(&_tasks[0].task);
+    expect(_tasks[0].runs == 2);
+    puts("repost OK");
+}
+
+static void _test_subtasks(void)
+{
+    _reset();
+
+    _tasks[0].task.super.handler = _spawn;
+    expect(event_executor_post(&_executor, &_tasks[0].task) == 0);
+    event_task_wait(&_tasks[0].task);
+    for (unsigned i = 0; i < 3; i++) {
+        event_task_wait(&_tasks[i].task);
+        expect(_tasks[i].runs == 1);
+    }
+    puts("subtasks OK");
+}
+
+static void _test_full(void)
+{
+    _reset();
+
+    for (unsigned i = 0; i < TASKS_NUMOF; i++) {
+        expect(event_executor_post(&_executor, &_tasks[i].task) == 0);
+    }
+    expect(event_executor_post(&_executor, &_tasks[TASKS_NUMOF].task)
+           == -ENOBUFS);
+    expect(event_task_done(&_tasks[TASKS_NUMOF].task));
+
+    for (unsigned i = 0; i < TASKS_NUMOF; i++) {
+        event_task_wait(&_tasks[i].task);
+        expect(_tasks[i].runs == 1);
+    }
+    expect(_tasks[TASKS_NUMOF].runs == 0);
+    puts("full OK");
+}
+
+int main(void)
+{
+    expect(event_executor_init(&_executor, _workers, WORKERS_NUMOF,
+                               THREAD_PRIORITY_MAIN + 1) == 0);
+
+    _test_distribution();
+    _test_stealing();
+    _test_completion();
+    _test_repost();
+    _test_subtasks();
+    _test_full();
+
+    for (unsigned i = 0; i < WORKERS_NUMOF; i++) {
+        printf("worker %u: executed %" PRIu32 ", stolen %" PRIu32 "\n",
+               i, _workers[i].executed, _workers[i].stolen);
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2026 The RIOT Authors
+# SPDX-License-Identifier: LGPL-2.1-only
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("distribution OK")
+    child.expect_exact("stealing OK")
+    child.expect_exact("completion OK")
+    child.expect_exact("repost OK")
+    child.expect_exact("subtasks OK")
+    child.expect_exact("full OK")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
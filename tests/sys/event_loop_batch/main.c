@@ -0,0 +1,215 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the batched event loop
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "event.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define QUEUES_NUMOF    (3U)
+#define EVENTS_NUMOF    (2 * CONFIG_EVENT_LOOP_BATCH_SIZE)
+#define LOG_SIZE        (4 * EVENTS_NUMOF)
+#define HANDLER_US      (1000U)
+
+enum {
+    Q_HIGH,
+    Q_MID,
+    Q_LOW,
+};
+
+typedef struct {
+    event_t super;
+    unsigned id;
+    void (*hook)(void);
+} test_event_t;
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static event_queue_t _queues[QUEUES_NUMOF];
+static test_event_t _events[EVENTS_NUMOF];
+static test_event_t _high = { .id = 100 };
+
+static unsigned _log[LOG_SIZE];
+static unsigned _log_numof;
+
+static void _handler(event_t *event)
+{
+    test_event_t *ev = container_of(event, test_event_t, super);
+
+    expect(_log_numof < LOG_SIZE);
+    _log[_log_numof++] = ev->id;
+    if (ev->hook) {
+        ev->hook();
+    }
+}
+
+static void *_worker(void *arg)
+{
+    (void)arg;
+
+    event_queues_claim(_queues, QUEUES_NUMOF);
+    event_loop_multi(_queues, QUEUES_NUMOF);
+
+    return NULL;
+}
+
+static void _reset(void)
+{
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        _events[i].hook = NULL;
+    }
+    _high.hook = NULL;
+    _log_numof = 0;
+    memset(_log, 0, sizeof(_log));
+    for (unsigned i = 0; i < QUEUES_NUMOF; i++) {
+        event_queue_stats_reset(&_queues[i]);
+    }
+}
+
+/* the worker has a lower priority, so it only runs while main waits here */
+static void _run(void)
+{
+    event_sync(&_queues[Q_LOW]);
+}
+
+static void _test_order(void)
+{
+    _reset();
+
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        event_post(&_queues[Q_LOW], &_events[i].super);
+    }
+    event_post(&_queues[Q_HIGH], &_high.super);
+    _run();
+
+    expect(_log_numof == EVENTS_NUMOF + 1);
+    expect(_log[0] == _high.id);
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        expect(_log[i + 1] == i);
+    }
+    puts("order OK");
+}
+
+static void _post_high(void)
+{
+    event_post(&_queues[Q_HIGH], &_high.super);
+}
+
+static void _test_preemption(void)
+{
+    _reset();
+
+    /* the first event of the batch makes the high priority queue pending,
+     * its event must be handled before the rest of the batch */
+    _events[0].hook = _post_high;
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        event_post(&_queues[Q_LOW], &_events[i].super);
+    }
+    _run();
+
+    expect(_log_numof == EVENTS_NUMOF + 1);
+    expect(_log[0] == 0);
+    expect(_log[1] == _high.id);
+    for (unsigned i = 1; i < EVENTS_NUMOF; i++) {
+        expect(_log[i + 1] == i);
+    }
+    puts("preemption OK");
+}
+
+static void _cancel_and_repost(void)
+{
+    /* both events are in the same batch as the calling handler */
+    event_cancel(&_queues[Q_MID], &_events[2].super);
+    event_post(&_queues[Q_MID], &_events[1].super);
+}
+
+static void _test_cancel(void)
+{
+    _reset();
+
+    _events[0].hook = _cancel_and_repost;
+    for (unsigned i = 0; i < 4; i++) {
+        event_post(&_queues[Q_MID], &_events[i].super);
+    }
+    _run();
+
+    expect(_log_numof == 3);
+    expect(_log[0] == 0);
+    expect(_log[1] == 1);
+    expect(_log[2] == 3);
+    puts("cancel OK");
+}
+
+static void _spin(void)
+{
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    while (ztimer_now(ZTIMER_USEC) - start < HANDLER_US) {}
+}
+
+static void _test_stats(void)
+{
+    event_queue_stats_t stats;
+
+    _reset();
+
+    _events[0].hook = _spin;
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        event_post(&_queues[Q_MID], &_events[i].super);
+    }
+    event_queue_stats_get(&_queues[Q_MID], &stats);
+    expect(stats.depth == EVENTS_NUMOF);
+    expect(stats.depth_max == EVENTS_NUMOF);
+    expect(stats.dispatched == 0);
+    _run();
+
+    event_queue_stats_get(&_queues[Q_MID], &stats);
+    expect(stats.posted == EVENTS_NUMOF);
+    expect(stats.dispatched == EVENTS_NUMOF);
+    expect(stats.depth == 0);
+    expect(stats.depth_max == EVENTS_NUMOF);
+    expect(stats.handler_max_us >= HANDLER_US);
+    expect(stats.handler_sum_us >= HANDLER_US);
+    /* the last event waited for the spinning handler */
+    expect(stats.latency_max_us >= HANDLER_US);
+
+    event_queue_stats_get(&_queues[Q_HIGH], &stats);
+    expect(stats.posted == 0);
+    expect(stats.dispatched == 0);
+    puts("stats OK");
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        _events[i].super.handler = _handler;
+        _events[i].id = i;
+    }
+    _high.super.handler = _handler;
+
+    event_queues_init_detached(_queues, QUEUES_NUMOF);
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1, 0,
+                  _worker, NULL, "worker");
+
+    _test_order();
+    _test_preemption();
+    _test_cancel();
+    _test_stats();
+    puts("SUCCESS");
+
+    return 0;
+}
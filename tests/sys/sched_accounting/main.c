@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Scheduler latency accounting test application
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "sched_accounting.h"
+#include "shell.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "ztimer.h"
+
+#define BLOCK_US    (2000U)
+
+static char _blocker_stack[THREAD_STACKSIZE_DEFAULT];
+static char _spinner_stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _mutex = MUTEX_INIT_LOCKED;
+
+static void *_blocker(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    msg_receive(&msg);
+    mutex_lock(&_mutex);
+    thread_flags_wait_any(0x1);
+    thread_sleep();
+
+    return NULL;
+}
+
+static void *_spinner(void *arg)
+{
+    (void)arg;
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+
+    while (ztimer_now(ZTIMER_USEC) - start < 5 * BLOCK_US) {}
+
+    return NULL;
+}
+
+static void _test_blocking(void)
+{
+    sched_accounting_t stats;
+    msg_t msg = { 0 };
+
+    kernel_pid_t pid = thread_create(_blocker_stack, sizeof(_blocker_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _blocker, NULL, "blocker");
+
+    ztimer_sleep(ZTIMER_USEC, BLOCK_US);
+    msg_send(&msg, pid);
+    ztimer_sleep(ZTIMER_USEC, BLOCK_US);
+    mutex_unlock(&_mutex);
+    ztimer_sleep(ZTIMER_USEC, BLOCK_US);
+    thread_flags_set(thread_get(pid), 0x1);
+    ztimer_sleep(ZTIMER_USEC, BLOCK_US);
+    thread_wakeup(pid);
+
+    expect(sched_accounting_get(pid, &stats) == 0);
+    expect(stats.wakeups == 5);
+    expect(stats.blocked_us[SCHED_ACCOUNTING_BLOCK_MSG] >= BLOCK_US);
+    expect(stats.blocked_us[SCHED_ACCOUNTING_BLOCK_MUTEX] >= BLOCK_US);
+    expect(stats.blocked_us[SCHED_ACCOUNTING_BLOCK_FLAGS] >= BLOCK_US);
+    expect(stats.blocked_us[SCHED_ACCOUNTING_BLOCK_SLEEP] >= BLOCK_US);
+    expect(stats.blocked_us[SCHED_ACCOUNTING_BLOCK_OTHER] == 0);
+    puts("blocking OK");
+
+    /* the blocker has a higher priority, so it ran right after each wakeup */
+    uint32_t runs = 0;
+    for (unsigned i = 0; i < CONFIG_SCHED_ACCOUNTING_HIST_NUMOF; i++) {
+        runs += stats.latency_hist[i];
+    }
+    expect(runs == stats.wakeups);
+    expect(stats.latency_max_us < BLOCK_US);
+    expect(sched_accounting_get(KERNEL_PID_UNDEF, &stats) == -EINVAL);
+    puts("latency OK");
+}
+
+static void _test_preemption(void)
+{
+    sched_accounting_t stats;
+
+    kernel_pid_t pid = thread_create(_spinner_stack, sizeof(_spinner_stack),
+                                     THREAD_PRIORITY_MAIN + 1, 0,
+                                     _spinner, NULL, "spinner");
+
+    /* the spinner runs while main sleeps, main preempts it on wakeup */
+    ztimer_sleep(ZTIMER_USEC, BLOCK_US);
+
+    expect(sched_accounting_get(pid, &stats) == 0);
+    expect(stats.preemptions >= 1);
+
+    expect(sched_accounting_get(thread_getpid(), &stats) == 0);
+    expect(stats.blocked_us[SCHED_ACCOUNTING_BLOCK_MUTEX] >= BLOCK_US);
+
+    if (IS_USED(MODULE_NATIVE)) {
+        sched_accounting_isr_t isr;
+        sched_accounting_get_isr(&isr);
+        expect(isr.count > 0);
+    }
+    puts("preemption OK");
+}
+
+int main(void)
+{
+    _test_blocking();
+    _test_preemption();
+    puts("SUCCESS");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
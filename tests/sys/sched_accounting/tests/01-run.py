@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("blocking OK")
+    child.expect_exact("latency OK")
+    child.expect_exact("preemption OK")
+    child.expect_exact("SUCCESS")
+    child.sendline("schedacct")
+    child.expect(r"pid \| name\s+\| wakeups \| preempt \| lat avg \| lat max")
+    child.expect(r"\s+\d+ \| main\s+\|\s+\d+ \|")
+    child.expect(r"ISR: \d+ handled")
+    child.sendline("schedacct hist 1")
+    child.expect_exact("latency [us]         | count")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
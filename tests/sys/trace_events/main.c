@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: 2026 The RIOT Authors
+ * SPDX-License-Identifier: LGPL-2.1-only
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Binary event tracer test application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "trace_events.h"
+
+static char _stack[THREAD_STACKSIZE_SMALL];
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+    return NULL;
+}
+
+/* reads the next user event, skipping everything else */
+static int _read_user(trace_events_reader_t *reader, trace_event_t *event)
+{
+    int res;
+
+    while ((res = trace_events_read(reader, event)) > 0) {
+        if (event->id == TRACE_EVENT_USER) {
+            break;
+        }
+    }
+    return res;
+}
+
+int main(void)
+{
+    trace_events_reader_t a, b;
+    trace_event_t event;
+    const trace_events_ring_t *ring = trace_events_ring();
+
+    expect(ring);
+    expect(ring->magic == TRACE_EVENTS_MAGIC);
+    expect(ring->numof == CONFIG_TRACE_EVENTS_NUMOF);
+
+    /* two readers see the same records */
+    trace_events_reader_init(&a);
+    trace_events_reader_init(&b);
+    TRACE_EVENT(TRACE_EVENT_USER, 1, 0x12345678);
+    expect(_read_user(&a, &event) == 1);
+    expect((event.arg0 == 1) && (event.arg1 == 0x12345678));
+    expect(_read_user(&a, &event) == 0);
+    expect(_read_user(&b, &event) == 1);
+    expect((event.arg0 == 1) && (event.arg1 == 0x12345678));
+    uint32_t t_first = event.time;
+
+    TRACE_EVENT(TRACE_EVENT_USER, 2, 0);
+    expect(_read_user(&a, &event) == 1);
+    expect((event.arg0 == 2) && ((int32_t)(event.time - t_first) >= 0));
+    puts("readers OK");
+
+    /* the scheduler reports switching to a new thread */
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _thread, NULL, "trace");
+    bool found = false;
+    while (trace_events_read(&a, &event) > 0) {
+        if ((event.id == TRACE_EVENT_SCHED_SWITCH) && (event.arg0 == pid)) {
+            found = true;
+        }
+    }
+    expect(found);
+    puts("sched OK");
+
+    /* a reader that falls behind loses the oldest records */
+    trace_events_reader_init(&a);
+    for (unsigned i = 0; i < 2 * CONFIG_TRACE_EVENTS_NUMOF; i++) {
+        TRACE_EVENT(TRACE_EVENT_USER, i, 0);
+    }
+    expect(trace_events_read(&a, &event) == -EOVERFLOW);
+    unsigned n = 0;
+    while (_read_user(&a, &event) > 0) {
+        expect(event.arg0 == CONFIG_TRACE_EVENTS_NUMOF + n);
+        n++;
+    }
+    expect(n == CONFIG_TRACE_EVENTS_NUMOF);
+    puts("overflow OK");
+
+    puts("SUCCESS");
+    return 0;
+}
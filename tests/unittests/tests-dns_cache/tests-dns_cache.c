@@ -6,9 +6,11 @@
  * directory for more details.
  */
 
+#include <errno.h>
 #include <stdint.h>
 #include <string.h>
 #include "net/af.h"
+#include "net/ipv4/addr.h"
 #include "net/ipv6.h"
 #include "ztimer.h"
 
@@ -51,11 +53,98 @@ static void test_dns_cache_add_ttl0(void)
     TEST_ASSERT_EQUAL_INT(0, dns_cache_query("example.com", &addr_out, AF_INET6));
 }
 
+static void test_dns_cache_multiple(void)
+{
+    ipv6_addr_t addr_a = IPV6_ADDR_ALL_NODES_IF_LOCAL;
+    ipv6_addr_t addr_b = IPV6_ADDR_ALL_ROUTERS_IF_LOCAL;
+    ipv4_addr_t addr_v4 = { .u8 = { 192, 0, 2, 1 } };
+    ipv6_addr_t addr_out;
+
+    dns_cache_add("example.com", &addr_a, sizeof(addr_a), 10);
+    dns_cache_add("example.com", &addr_b, sizeof(addr_b), 10);
+    dns_cache_add("example.com", &addr_v4, sizeof(addr_v4), 10);
+
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_out), dns_cache_query("example.com", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&addr_a, &addr_out, sizeof(addr_a)));
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_v4), dns_cache_query("example.com", &addr_out, AF_INET));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&addr_v4, &addr_out, sizeof(addr_v4)));
+
+    /* removing one record keeps the others */
+    dns_cache_add("example.com", &addr_a, sizeof(addr_a), 0);
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_out), dns_cache_query("example.com", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&addr_b, &addr_out, sizeof(addr_b)));
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_v4), dns_cache_query("example.com", &addr_out, AF_INET));
+
+    dns_cache_add("example.com", &addr_b, sizeof(addr_b), 0);
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("example.com", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_v4), dns_cache_query("example.com", &addr_out, AF_UNSPEC));
+    dns_cache_add("example.com", &addr_v4, sizeof(addr_v4), 0);
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("example.com", &addr_out, AF_UNSPEC));
+}
+
+static void test_dns_cache_negative(void)
+{
+    ipv6_addr_t addr_in = IPV6_ADDR_ALL_NODES_IF_LOCAL;
+    ipv4_addr_t addr_v4 = { .u8 = { 192, 0, 2, 1 } };
+    ipv6_addr_t addr_out;
+
+    /* NODATA for AAAA does not affect A records */
+    dns_cache_add("example.com", &addr_v4, sizeof(addr_v4), 10);
+    dns_cache_add_negative("example.com", AF_INET6, 1);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, dns_cache_query("example.com", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_v4), dns_cache_query("example.com", &addr_out, AF_INET));
+
+    /* a new record replaces the negative entry */
+    dns_cache_add("example.com", &addr_in, sizeof(addr_in), 10);
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_out), dns_cache_query("example.com", &addr_out, AF_INET6));
+
+    /* NXDOMAIN replaces all records */
+    dns_cache_add_negative("example.com", AF_UNSPEC, 1);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, dns_cache_query("example.com", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, dns_cache_query("example.com", &addr_out, AF_INET));
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("example.org", &addr_out, AF_INET));
+
+    /* negative entries expire as well */
+    ztimer_sleep(ZTIMER_USEC, 1100000);
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("example.com", &addr_out, AF_UNSPEC));
+}
+
+static void test_dns_cache_evict(void)
+{
+    static const char *names[] = {
+        "a.example.com", "b.example.com", "c.example.com",
+        "d.example.com", "e.example.com", "f.example.com",
+    };
+    ipv6_addr_t addr_in = IPV6_ADDR_ALL_NODES_IF_LOCAL;
+    ipv6_addr_t addr_out;
+
+    /* the first entry to expire is evicted */
+    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE + 1; i++) {
+        dns_cache_add(names[i], &addr_in, sizeof(addr_in), 10 + i);
+    }
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query(names[0], &addr_out, AF_INET6));
+    for (unsigned i = 1; i < CONFIG_DNS_CACHE_SIZE + 1; i++) {
+        TEST_ASSERT_EQUAL_INT(sizeof(addr_out), dns_cache_query(names[i], &addr_out, AF_INET6));
+    }
+
+    /* a new entry that would expire first is not added */
+    dns_cache_add(names[0], &addr_in, sizeof(addr_in), 1);
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query(names[0], &addr_out, AF_INET6));
+
+    for (unsigned i = 1; i < CONFIG_DNS_CACHE_SIZE + 1; i++) {
+        dns_cache_add(names[i], &addr_in, sizeof(addr_in), 0);
+        TEST_ASSERT_EQUAL_INT(0, dns_cache_query(names[i], &addr_out, AF_INET6));
+    }
+}
+
 Test *tests_dns_cache_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_dns_cache_add),
         new_TestFixture(test_dns_cache_add_ttl0),
+        new_TestFixture(test_dns_cache_multiple),
+        new_TestFixture(test_dns_cache_negative),
+        new_TestFixture(test_dns_cache_evict),
     };
 
     EMB_UNIT_TESTCALLER(dns_cache_tests, NULL, NULL, fixtures);
@@ -6,6 +6,7 @@
  * directory for more details.
  */
 
+#include <errno.h>
 #include <stdint.h>
 #include <string.h>
 #include "net/af.h"
@@ -48,6 +49,8 @@ static void test_dns_msg_valid_AAAA(void)
     TEST_ASSERT_EQUAL_INT(16, res);
     TEST_ASSERT_EQUAL_INT(ttl, ttl_out);
     TEST_ASSERT_EQUAL_INT(0, memcmp(addr, addr_out, sizeof(addr)));
+    res = dns_msg_parse_negative(dns_msg, sizeof(dns_msg), AF_INET6, &ttl_out);
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, res);
 }
 
 static void test_dns_msg_valid_dns64(void)
@@ -140,12 +143,80 @@ static void test_dns_msg_valid_dns64_w_long_cnames(void)
     TEST_ASSERT_EQUAL_INT(0, memcmp(addr, addr_out, sizeof(addr)));
 }
 
+static void test_dns_msg_nxdomain(void)
+{
+    const uint8_t dns_msg[] = {
+        /* in scapy notation:
+         * <DNS  id=0 qr=1 opcode=QUERY aa=0 tc=0 rd=1 ra=1 z=0 ad=0 cd=0 rcode=name-error
+         *       qdcount=1 ancount=0 nscount=1 arcount=0
+         *       qd=<DNSQR  qname='example.org.' qtype=AAAA qclass=IN |>
+         *       an=None
+         *       ns=<DNSRRSOA  rrname='\\xc0\x0c' type=SOA rclass=IN ttl=3600
+         *                     mname='ns.example.org.' rname='foo.example.org.'
+         *                     serial=1 refresh=7200 retry=900 expire=1209600
+         *                     minimum=300 |>
+         *       ar=None |> */
+        0x00, 0x00, 0x81, 0x83, 0x00, 0x01, 0x00, 0x00,
+        0x00, 0x01, 0x00, 0x00, 0x07, 0x65, 0x78, 0x61,
+        0x6d, 0x70, 0x6c, 0x65, 0x03, 0x6f, 0x72, 0x67,
+        0x00, 0x00, 0x1c, 0x00, 0x01, 0xc0, 0x0c, 0x00,
+        0x06, 0x00, 0x01, 0x00, 0x00, 0x0e, 0x10, 0x00,
+        0x1f, 0x02, 0x6e, 0x73, 0xc0, 0x0c, 0x03, 0x66,
+        0x6f, 0x6f, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x01,
+        0x00, 0x00, 0x1c, 0x20, 0x00, 0x00, 0x03, 0x84,
+        0x00, 0x12, 0x75, 0x00, 0x00, 0x00, 0x01, 0x2c,
+    };
+    uint8_t addr_out[16];
+    uint32_t ttl_out;
+    int res = dns_msg_parse_reply(dns_msg, sizeof(dns_msg), AF_INET6, &addr_out, &ttl_out);
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, res);
+    res = dns_msg_parse_negative(dns_msg, sizeof(dns_msg), AF_INET6, &ttl_out);
+    TEST_ASSERT_EQUAL_INT(AF_UNSPEC, res);
+    /* minimum of SOA TTL and SOA MINIMUM */
+    TEST_ASSERT_EQUAL_INT(300, ttl_out);
+}
+
+static void test_dns_msg_nodata(void)
+{
+    const uint8_t dns_msg[] = {
+        /* in scapy notation:
+         * <DNS  id=0 qr=1 opcode=QUERY aa=0 tc=0 rd=1 ra=1 z=0 ad=0 cd=0 rcode=ok
+         *       qdcount=1 ancount=0 nscount=1 arcount=0
+         *       qd=<DNSQR  qname='example.org.' qtype=AAAA qclass=IN |>
+         *       an=None
+         *       ns=<DNSRRSOA  rrname='\\xc0\x0c' type=SOA rclass=IN ttl=3600
+         *                     mname='ns.example.org.' rname='foo.example.org.'
+         *                     serial=1 refresh=7200 retry=900 expire=1209600
+         *                     minimum=300 |>
+         *       ar=None |> */
+        0x00, 0x00, 0x81, 0x80, 0x00, 0x01, 0x00, 0x00,
+        0x00, 0x01, 0x00, 0x00, 0x07, 0x65, 0x78, 0x61,
+        0x6d, 0x70, 0x6c, 0x65, 0x03, 0x6f, 0x72, 0x67,
+        0x00, 0x00, 0x1c, 0x00, 0x01, 0xc0, 0x0c, 0x00,
+        0x06, 0x00, 0x01, 0x00, 0x00, 0x0e, 0x10, 0x00,
+        0x1f, 0x02, 0x6e, 0x73, 0xc0, 0x0c, 0x03, 0x66,
+        0x6f, 0x6f, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x01,
+        0x00, 0x00, 0x1c, 0x20, 0x00, 0x00, 0x03, 0x84,
+        0x00, 0x12, 0x75, 0x00, 0x00, 0x00, 0x01, 0x2c,
+    };
+    uint8_t addr_out[16];
+    uint32_t ttl_out;
+    int res = dns_msg_parse_reply(dns_msg, sizeof(dns_msg), AF_INET6, &addr_out, &ttl_out);
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, res);
+    res = dns_msg_parse_negative(dns_msg, sizeof(dns_msg), AF_INET6, &ttl_out);
+    TEST_ASSERT_EQUAL_INT(AF_INET6, res);
+    /* minimum of SOA TTL and SOA MINIMUM */
+    TEST_ASSERT_EQUAL_INT(300, ttl_out);
+}
+
 Test *tests_dns_msg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_dns_msg_valid_AAAA),
         new_TestFixture(test_dns_msg_valid_dns64),
         new_TestFixture(test_dns_msg_valid_dns64_w_long_cnames),
+        new_TestFixture(test_dns_msg_nxdomain),
+        new_TestFixture(test_dns_msg_nodata),
     };
 
     EMB_UNIT_TESTCALLER(dns_msg_tests, NULL, NULL, fixtures);
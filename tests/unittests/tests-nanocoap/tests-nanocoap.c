@@ -20,6 +20,7 @@
 #include "embUnit.h"
 
 #include "net/nanocoap.h"
+#include "net/nanocoap/resource_trie.h"
 
 #include "unittests-constants.h"
 #include "tests-nanocoap.h"
@@ -1285,6 +1286,107 @@ static void test_nanocoap__out_of_bounds_option(void)
     TEST_ASSERT_EQUAL_INT(-EBADMSG, coap_parse(&pkt, invalid_msg, sizeof(invalid_msg)));
 }
 
+static const coap_resource_t _trie_resources[] = {
+    { .path = "/a",         .methods = COAP_GET },
+    { .path = "/a/b",       .methods = COAP_GET },
+    { .path = "/a/b",       .methods = COAP_POST },
+    { .path = "/a/",        .methods = COAP_GET | COAP_MATCH_SUBTREE },
+    { .path = "/res",       .methods = COAP_GET | COAP_MATCH_SUBTREE },
+    { .path = "/resource",  .methods = COAP_PUT },
+    { .path = "/x/y/z",     .methods = COAP_GET },
+};
+
+/*
+ * Looks up @p path in @p trie and with the linear lookup in @p linear.
+ * Returns the index of the matching resource or a negative errno.
+ */
+static int _trie_lookup(const coap_resource_trie_t *trie, unsigned method,
+                        const char *path, int *linear)
+{
+    uint8_t buf[_BUF_SIZE];
+    uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
+    coap_pkt_t pkt;
+    const coap_resource_t *resource;
+    size_t len = coap_build_hdr((coap_hdr_t *)&buf[0], COAP_TYPE_NON,
+                                NULL, 0, method, 0x1234);
+    coap_pkt_init(&pkt, &buf[0], sizeof(buf), len);
+    coap_opt_add_string(&pkt, COAP_OPT_URI_PATH, path, '/');
+
+    *linear = -ENOENT;
+    if (coap_get_uri_path(&pkt, uri) <= 0) {
+        *linear = -EBADMSG;
+    }
+    for (unsigned i = 0; (*linear != -EBADMSG) &&
+                         (i < ARRAY_SIZE(_trie_resources)); i++) {
+        if (coap_match_path(&_trie_resources[i], uri) != 0) {
+            continue;
+        }
+        if (_trie_resources[i].methods & coap_method2flag(method)) {
+            *linear = i;
+            break;
+        }
+        *linear = -ENOTSUP;
+    }
+
+    int res = coap_resource_trie_find(trie, &pkt, &resource);
+    if (res == 0) {
+        res = resource - _trie_resources;
+    }
+
+    return res;
+}
+
+#define TRIE_ASSERT(exp, method, path) \
+    do { \
+        int linear; \
+        TEST_ASSERT_EQUAL_INT(exp, _trie_lookup(&trie, method, path, &linear)); \
+        TEST_ASSERT_EQUAL_INT(exp, linear); \
+    } while (0)
+
+/*
+ * Resource index lookups, including duplicate paths and subtree matches.
+ */
+static void test_nanocoap__resource_trie(void)
+{
+    coap_resource_trie_node_t nodes[16];
+    coap_resource_trie_t trie;
+
+    TEST_ASSERT_EQUAL_INT(0, coap_resource_trie_init(&trie, nodes, ARRAY_SIZE(nodes),
+                                                     _trie_resources,
+                                                     ARRAY_SIZE(_trie_resources)));
+    TEST_ASSERT_EQUAL_INT(9, trie.nodes_used);
+
+    TRIE_ASSERT(0, COAP_METHOD_GET, "/a");
+    TRIE_ASSERT(1, COAP_METHOD_GET, "/a/b");
+    TRIE_ASSERT(2, COAP_METHOD_POST, "/a/b");
+    TRIE_ASSERT(-ENOTSUP, COAP_METHOD_PUT, "/a/b");
+    TRIE_ASSERT(3, COAP_METHOD_GET, "/a/c");
+    TRIE_ASSERT(3, COAP_METHOD_GET, "/a/b/c");
+    TRIE_ASSERT(4, COAP_METHOD_GET, "/resource");
+    TRIE_ASSERT(4, COAP_METHOD_GET, "/res/x");
+    TRIE_ASSERT(5, COAP_METHOD_PUT, "/resource");
+    TRIE_ASSERT(-ENOENT, COAP_METHOD_GET, "/re");
+    TRIE_ASSERT(-ENOENT, COAP_METHOD_GET, "/x/y");
+    TRIE_ASSERT(6, COAP_METHOD_GET, "/x/y/z");
+    TRIE_ASSERT(-ENOTSUP, COAP_METHOD_DELETE, "/x/y/z");
+    TRIE_ASSERT(-ENOENT, COAP_METHOD_GET, "/");
+
+    /* the longest path the linear lookup can handle, and one more */
+    char path[CONFIG_NANOCOAP_URI_MAX + 1];
+    memset(path, 'x', sizeof(path) - 1);
+    memcpy(path, "/res/", 5);
+    path[CONFIG_NANOCOAP_URI_MAX - 1] = '\0';
+    TRIE_ASSERT(4, COAP_METHOD_GET, path);
+    path[CONFIG_NANOCOAP_URI_MAX - 1] = 'x';
+    path[CONFIG_NANOCOAP_URI_MAX] = '\0';
+    TRIE_ASSERT(-EBADMSG, COAP_METHOD_GET, path);
+
+    /* the index does not fit */
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, coap_resource_trie_init(&trie, nodes, 8,
+                                                           _trie_resources,
+                                                           ARRAY_SIZE(_trie_resources)));
+}
+
 Test *tests_nanocoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -1325,6 +1427,7 @@ Test *tests_nanocoap_tests(void)
         new_TestFixture(test_nanocoap__token_length_ext_269),
         new_TestFixture(test_nanocoap___rst_message),
         new_TestFixture(test_nanocoap__out_of_bounds_option),
+        new_TestFixture(test_nanocoap__resource_trie),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_tests, NULL, NULL, fixtures);
@@ -213,6 +213,90 @@ static void test_add(void)
     }
 }
 
+static void _fill_io_buffer(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+}
+
+static void test_add_get_wrap(void)
+{
+    uint8_t out[BUFFER_SIZE];
+
+    _fill_io_buffer();
+    /* move the positions close to the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3, tsrb_add(&_tsrb, _io_buffer,
+                                                    BUFFER_SIZE - 3));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3, tsrb_drop(&_tsrb, BUFFER_SIZE));
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_peek(&_tsrb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, _io_buffer, sizeof(out)));
+    memset(out, 0, sizeof(out));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, _io_buffer, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
+static void test_spsc_add_get(void)
+{
+    uint8_t out[BUFFER_SIZE];
+
+    _fill_io_buffer();
+    TEST_ASSERT_EQUAL_INT(0, tsrb_spsc_get(&_tsrb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(5, tsrb_spsc_add(&_tsrb, _io_buffer, 5));
+    TEST_ASSERT_EQUAL_INT(5, tsrb_spsc_get(&_tsrb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, _io_buffer, 5));
+
+    /* wraps around the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_spsc_add(&_tsrb, _io_buffer,
+                                                     sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_spsc_add(&_tsrb, _io_buffer, 1));
+    TEST_ASSERT_EQUAL_INT(3, tsrb_spsc_get(&_tsrb, out, 3));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3,
+                          tsrb_spsc_get(&_tsrb, out + 3, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(out, _io_buffer, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
+static void test_reserve_commit(void)
+{
+    uint8_t *wbuf;
+    const uint8_t *rbuf;
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_read_reserve(&_tsrb, &rbuf));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_write_reserve(&_tsrb, &wbuf));
+    TEST_ASSERT(wbuf == _tsrb_buffer);
+    memset(wbuf, TEST_INPUT, 10);
+    tsrb_write_commit(&_tsrb, 10);
+    TEST_ASSERT_EQUAL_INT(10, tsrb_avail(&_tsrb));
+
+    TEST_ASSERT_EQUAL_INT(10, tsrb_read_reserve(&_tsrb, &rbuf));
+    TEST_ASSERT(rbuf == _tsrb_buffer);
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, rbuf[9]);
+    tsrb_read_commit(&_tsrb, 8);
+    /* the free space wraps around, only the part up to the end is returned */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 10, tsrb_write_reserve(&_tsrb, &wbuf));
+    TEST_ASSERT(wbuf == &_tsrb_buffer[10]);
+    tsrb_write_commit(&_tsrb, BUFFER_SIZE - 10);
+    TEST_ASSERT_EQUAL_INT(8, tsrb_write_reserve(&_tsrb, &wbuf));
+    TEST_ASSERT(wbuf == _tsrb_buffer);
+    tsrb_write_commit(&_tsrb, 8);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_write_reserve(&_tsrb, &wbuf));
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 8, tsrb_read_reserve(&_tsrb, &rbuf));
+    TEST_ASSERT(rbuf == &_tsrb_buffer[8]);
+    tsrb_read_commit(&_tsrb, BUFFER_SIZE - 8);
+    TEST_ASSERT_EQUAL_INT(8, tsrb_read_reserve(&_tsrb, &rbuf));
+    TEST_ASSERT(rbuf == _tsrb_buffer);
+    tsrb_read_commit(&_tsrb, 8);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -228,6 +312,9 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_add_get_wrap),
+        new_TestFixture(test_spsc_add_get),
+        new_TestFixture(test_reserve_commit),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);